@@ -2,8 +2,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <stdint.h>
 
 #include "airport.h"
+#include "airport_reports.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -53,6 +55,27 @@ Airport* createAirport(const char* gpsId,
   return a;
 }
 
+static void freeAirportStrings(Airport* a) {
+  free(a->gpsId);
+  free(a->type);
+  free(a->name);
+  free(a->city);
+  free(a->countryAbbrv);
+}
+
+void freeAirport(Airport* a) {
+  if (!a) return;
+  freeAirportStrings(a);
+  free(a);
+}
+
+void freeAirports(Airport* airports, int n) {
+  if (!airports) return;
+  for (int i = 0; i < n; i++) {
+    freeAirportStrings(&airports[i]);
+  }
+}
+
 double getAirDistance(const Airport* origin, const Airport* destination) {
   if (!origin || !destination) return 0.0;
   double phi1 = deg2rad(origin->latitude);
@@ -146,137 +169,272 @@ int cmpByLincolnDistance(const void* a, const void* b) {
   if (distA > distB) return 1;
   return 0;
 }
-char* airportToString(const Airport* a) {
-  char temp[1000];
-  sprintf(temp, "%-8s %-15s %-20s %.2f %.2f %d %-10s %-2s",
-          a->gpsId, a->type, a->name,
-          a->latitude, a->longitude, a->elevationFeet, a->city,
-          a->countryAbbrv);
-  char* result = (char*)malloc(sizeof(char) * (strlen(temp) + 1));
-  strcpy(result, temp);
-  return result;
+typedef struct {
+  uint64_t key;
+  int index;
+} DistanceKey;
+
+/* Maps a non-negative distance onto an unsigned integer with the same
+ * ordering (IEEE-754 bit patterns of non-negative doubles sort like
+ * integers), so keys can be radix sorted. */
+static uint64_t distanceKeyBits(double d) {
+  uint64_t bits;
+  if (!(d > 0.0)) d = 0.0;
+  memcpy(&bits, &d, sizeof(bits));
+  return bits;
 }
 
-void printAirports(Airport *airports, int n) {
+/* Stable LSD radix sort on 8-bit digits; digits shared by every key are
+ * skipped, which removes most passes for distances on Earth. */
+static void radixSortKeys(DistanceKey* keys, DistanceKey* scratch, int n) {
+  size_t counts[8][256];
+  memset(counts, 0, sizeof(counts));
   for (int i = 0; i < n; i++) {
-    char *s = airportToString(&airports[i]);
-    printf("%s\n", s);
-    free(s);
+    uint64_t k = keys[i].key;
+    for (int pass = 0; pass < 8; pass++) {
+      counts[pass][(k >> (8 * pass)) & 0xFF]++;
+    }
   }
+
+  DistanceKey* src = keys;
+  DistanceKey* dst = scratch;
+  for (int pass = 0; pass < 8; pass++) {
+    size_t* c = counts[pass];
+    if (c[(src[0].key >> (8 * pass)) & 0xFF] == (size_t)n) continue;
+    size_t offset = 0;
+    for (int b = 0; b < 256; b++) {
+      size_t count = c[b];
+      c[b] = offset;
+      offset += count;
+    }
+    for (int i = 0; i < n; i++) {
+      dst[c[(src[i].key >> (8 * pass)) & 0xFF]++] = src[i];
+    }
+    DistanceKey* t = src;
+    src = dst;
+    dst = t;
+  }
+  if (src != keys) memcpy(keys, src, sizeof(DistanceKey) * n);
 }
 
-void generateReports(Airport *airports, int n) {
-  if (!airports || n <= 0) return;
-
-  Airport* workingCopy = malloc(sizeof(Airport) * n);
-  if (!workingCopy) return;
-
-  printf("Airports (original): \n");
-  printf("==============================\n");
-  printAirports(airports, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByGPSId);
-  printf("\nAirports By GPS ID: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByType);
-  printf("\nAirports By Type: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByName);
-  printf("\nAirports By Name: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByNameDesc);
-  printf("\nAirports By Name - Reversed: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByCountryCity);
-  printf("\nAirports By Country/City: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByLatitude);
-  printf("\nAirports By Latitude: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByLongitude);
-  printf("\nAirports By Longitude: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByLincolnDistance);
-  printf("\nAirports By Distance from Lincoln: \n");
-  printf("==============================\n");
-  printAirports(workingCopy, n);
-
-  printf("\nClosest Airport to Lincoln: \n");
-  printf("==============================\n");
-  char *s = airportToString(&workingCopy[0]);
-  printf("%s\n", s);
-  free(s);
-
-  printf("\nFurthest Airport from Lincoln: \n");
-  printf("==============================\n");
-  s = airportToString(&workingCopy[n-1]);
-  printf("%s\n", s);
-  free(s);
-
-  memcpy(workingCopy, airports, sizeof(Airport) * n);
-  qsort(workingCopy, n, sizeof(Airport), cmpByLongitude);
-  int medianIndex = n / 2;
-  printf("\nEast-West Geographic Center: \n");
-  printf("==============================\n");
-  s = airportToString(&workingCopy[medianIndex]);
-  printf("%s\n", s);
-  free(s);
-
-  printf("\nNew York, NY airport: \n");
-  printf("==============================\n");
-  int foundNY = 0;
+int sortAirportsByDistance(const Airport* airports,
+                           int n,
+                           double latitude,
+                           double longitude,
+                           int* order,
+                           double* distancesKm) {
+  if (!airports || !order || n < 0) return 0;
+  if (n == 0) return 1;
+
+  DistanceKey* keys = malloc(sizeof(DistanceKey) * 2 * n);
+  if (!keys) return 0;
+
+  Airport origin;
+  origin.latitude = latitude;
+  origin.longitude = longitude;
   for (int i = 0; i < n; i++) {
-    if (strcmp(airports[i].city, "New York") == 0 && 
-        strcmp(airports[i].countryAbbrv, "US") == 0) {
-      s = airportToString(&airports[i]);
-      printf("%s\n", s);
-      free(s);
-      foundNY = 1;
-      break;
-    }
+    keys[i].key = distanceKeyBits(getAirDistance(&origin, &airports[i]));
+    keys[i].index = i;
   }
-  if (!foundNY) {
-    printf("No New York airport found!\n");
+
+  if (n < 64) {
+    /* insertion sort beats the radix passes on the small test arrays */
+    for (int i = 1; i < n; i++) {
+      DistanceKey k = keys[i];
+      int j = i - 1;
+      while (j >= 0 && keys[j].key > k.key) {
+        keys[j + 1] = keys[j];
+        j--;
+      }
+      keys[j + 1] = k;
+    }
+  } else {
+    radixSortKeys(keys, keys + n, n);
   }
 
-  printf("\nLarge airport: \n");
-  printf("==============================\n");
-  int foundLarge = 0;
   for (int i = 0; i < n; i++) {
-    if (strcmp(airports[i].type, "large_airport") == 0) {
-      s = airportToString(&airports[i]);
-      printf("%s\n", s);
-      free(s);
-      foundLarge = 1;
-      break;
+    order[i] = keys[i].index;
+    if (distancesKm) {
+      memcpy(&distancesKm[i], &keys[i].key, sizeof(double));
     }
   }
-  if (!foundLarge) {
-    printf("No large airport found!\n");
+  free(keys);
+  return 1;
+}
+
+/* Output cursor that counts every byte produced but only stores what
+ * fits in the buffer, leaving room for the NUL. */
+typedef struct {
+  char* buf;
+  size_t size;
+  size_t len;
+} TextCursor;
+
+#define PAD_WIDTH_MAX 20
+static const char SPACES[PAD_WIDTH_MAX + 1] = "                    ";
+
+/* Lines are gathered into a batch of this many bytes per fwrite. */
+#define WRITE_BATCH_BYTES (32 * 1024)
+
+static void putBytes(TextCursor* c, const char* s, size_t n) {
+  if (c->len + 1 < c->size) {
+    size_t room = c->size - 1 - c->len;
+    memcpy(c->buf + c->len, s, n < room ? n : room);
+  }
+  c->len += n;
+}
+
+/* "%-<width>s", with sprintf's "(null)" for NULL */
+static void putPadded(TextCursor* c, const char* s, int width) {
+  if (!s) s = "(null)";
+  size_t n = strlen(s);
+  putBytes(c, s, n);
+  if (n < (size_t)width) putBytes(c, SPACES, (size_t)width - n);
+}
+
+static void putUnsigned(TextCursor* c, uint64_t value, int minDigits) {
+  char digits[24];
+  int i = sizeof(digits);
+  do {
+    digits[--i] = (char)('0' + value % 10);
+    value /= 10;
+    minDigits--;
+  } while (value > 0 || minDigits > 0);
+  putBytes(c, digits + i, sizeof(digits) - i);
+}
+
+/* "%d" */
+static void putInt(TextCursor* c, int value) {
+  uint64_t magnitude = value < 0 ? (uint64_t)(-(int64_t)value) : (uint64_t)value;
+  if (value < 0) putBytes(c, "-", 1);
+  putUnsigned(c, magnitude, 1);
+}
+
+/*
+ * "%.2f" with the same correctly rounded result as printf: the exact
+ * residual of x * 100 (from fma) decides values that land on or near a
+ * half cent, and exact halves round to even.  Larger values, whose
+ * x * 100 nears 2^53 where that residual no longer fits, go to printf.
+ */
+static void putFixed2(TextCursor* c, double x) {
+  if (!(fabs(x) < 1e13)) {
+    char text[400];
+    int n = snprintf(text, sizeof(text), "%.2f", x);
+    putBytes(c, text, n > 0 ? (size_t)n : 0);
+    return;
+  }
+  double ax = fabs(x);
+  double scaled = ax * 100.0;
+  double err = fma(ax, 100.0, -scaled);
+  double whole = floor(scaled);
+  double half = (scaled - whole - 0.5) + err;
+  uint64_t units = (uint64_t)whole;
+  if (half > 0.0 || (half == 0.0 && (units & 1))) units++;
+
+  if (signbit(x)) putBytes(c, "-", 1);
+  putUnsigned(c, units / 100, 1);
+  putBytes(c, ".", 1);
+  putUnsigned(c, units % 100, 2);
+}
+
+int formatAirport(const Airport* a, char* buf, size_t size) {
+  if (!a) return -1;
+  TextCursor c = { buf, buf ? size : 0, 0 };
+  putPadded(&c, a->gpsId, 8);
+  putBytes(&c, " ", 1);
+  putPadded(&c, a->type, 15);
+  putBytes(&c, " ", 1);
+  putPadded(&c, a->name, 20);
+  putBytes(&c, " ", 1);
+  putFixed2(&c, a->latitude);
+  putBytes(&c, " ", 1);
+  putFixed2(&c, a->longitude);
+  putBytes(&c, " ", 1);
+  putInt(&c, a->elevationFeet);
+  putBytes(&c, " ", 1);
+  putPadded(&c, a->city, 10);
+  putBytes(&c, " ", 1);
+  putPadded(&c, a->countryAbbrv, 2);
+  if (c.size > 0) c.buf[c.len < c.size ? c.len : c.size - 1] = '\0';
+  return (int)c.len;
+}
+
+char* airportToString(const Airport* a) {
+  if (!a) return NULL;
+  char line[256];
+  int len = formatAirport(a, line, sizeof(line));
+  char* result = malloc((size_t)len + 1);
+  if (!result) return NULL;
+  if ((size_t)len < sizeof(line)) {
+    memcpy(result, line, (size_t)len + 1);
+  } else {
+    formatAirport(a, result, (size_t)len + 1);
   }
+  return result;
+}
+
+int writeAirports(FILE* out, const Airport* airports, const int* indices, int n) {
+  if (n <= 0) return 0;
+  if (!out || !airports) return -1;
+  char batch[WRITE_BATCH_BYTES];
+  size_t used = 0;
+  int failed = 0;
+  for (int i = 0; i < n; i++) {
+    const Airport* a = &airports[indices ? indices[i] : i];
+    int len = formatAirport(a, batch + used, sizeof(batch) - used);
+    if ((size_t)len + 1 > sizeof(batch) - used) {
+      /* flush and retry at the start of the batch */
+      failed |= fwrite(batch, 1, used, out) != used;
+      used = 0;
+      len = formatAirport(a, batch, sizeof(batch));
+      if ((size_t)len + 1 > sizeof(batch)) {
+        char* s = airportToString(a);
+        failed |= !s || fputs(s, out) == EOF || fputc('\n', out) == EOF;
+        free(s);
+        continue;
+      }
+    }
+    batch[used + len] = '\n';
+    used += (size_t)len + 1;
+  }
+  failed |= fwrite(batch, 1, used, out) != used;
+  return failed ? -1 : 0;
+}
+
+void printAirports(Airport *airports, int n) {
+  writeAirports(stdout, airports, NULL, n);
+}
+
+static int isNewYorkUS(const Airport* a, const void* arg) {
+  (void)arg;
+  return strcmp(a->city, "New York") == 0 && strcmp(a->countryAbbrv, "US") == 0;
+}
+
+static int hasType(const Airport* a, const void* type) {
+  return strcmp(a->type, (const char*)type) == 0;
+}
 
-  free(workingCopy);
-  return;
+int generateReports(Airport *airports, int n) {
+  if (!airports || n <= 0) return 1;
+
+  static const double lincoln[2] = { LINCOLN_LAT, LINCOLN_LON };
+  const ReportSpec specs[] = {
+    { "Airports (original)", REPORT_SORTED, NULL, NULL, 0, NULL, NULL, NULL },
+    { "Airports By GPS ID", REPORT_SORTED, cmpByGPSId, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Type", REPORT_SORTED, cmpByType, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Name", REPORT_SORTED, cmpByName, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Name - Reversed", REPORT_SORTED, cmpByNameDesc, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Country/City", REPORT_SORTED, cmpByCountryCity, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Latitude", REPORT_SORTED, cmpByLatitude, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Longitude", REPORT_SORTED, cmpByLongitude, NULL, 0, NULL, NULL, NULL },
+    { "Airports By Distance from Lincoln", REPORT_SORTED, NULL, lincoln, 0, NULL, NULL, NULL },
+    { "Closest Airport to Lincoln", REPORT_MIN, NULL, lincoln, 0, NULL, NULL, NULL },
+    { "Furthest Airport from Lincoln", REPORT_MAX, NULL, lincoln, 0, NULL, NULL, NULL },
+    { "East-West Geographic Center", REPORT_MEDIAN, cmpByLongitude, NULL, 0, NULL, NULL, NULL },
+    { "New York, NY airport", REPORT_FIRST_MATCH, NULL, NULL, 0, isNewYorkUS, NULL,
+      "No New York airport found!" },
+    { "Large airport", REPORT_FIRST_MATCH, NULL, NULL, 0, hasType, "large_airport",
+      "No large airport found!" }
+  };
+  return runAirportReports(airports, n, specs, (int)(sizeof(specs) / sizeof(specs[0])));
 }
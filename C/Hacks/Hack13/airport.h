@@ -18,6 +18,9 @@
 #ifndef HACK13_AIRPORT_H
 #define HACK13_AIRPORT_H
 
+#include <stddef.h>
+#include <stdio.h>
+
 typedef struct {
   char* gpsId;
   char* type;
@@ -58,12 +61,43 @@ void initAirport(Airport* airport,
                  const char* city,
                  const char* countryAbbrv);
 
+/**
+ * Frees an Airport created by createAirport, including its strings.
+ * Safe to pass NULL.
+ */
+void freeAirport(Airport* a);
+
+/**
+ * Frees the strings of the n Airports in the given array, each of
+ * which must have been set up with initAirport.  The array itself is
+ * not freed, so stack arrays can be released too.  Airports set up
+ * with initAirportInArena are released with their arena instead.
+ */
+void freeAirports(Airport* airports, int n);
+
 /**
  * Constructs a new string representation of the given
  * Airport structure.
  */
 char* airportToString(const Airport* a);
 
+/**
+ * Formats the same text as airportToString into the caller's buffer
+ * without allocating.  Like snprintf, at most size bytes are written
+ * (including the terminating NUL) and the return value is the full
+ * length of the text, so a return value >= size means it was
+ * truncated.
+ */
+int formatAirport(const Airport* a, char* buf, size_t size);
+
+/**
+ * Writes one formatted line per airport to out, batching the lines
+ * into large fwrite calls.  When indices is not NULL the airports
+ * written are airports[indices[0]], ..., airports[indices[n-1]];
+ * otherwise the first n.  Returns 0 on success or -1 on a write error.
+ */
+int writeAirports(FILE* out, const Airport* airports, const int* indices, int n);
+
 /**
  * Prints all the airports in the given array of n
  * Airports.
@@ -136,10 +170,29 @@ int cmpByLongitude(const void* a, const void* b);
  */
 int cmpByLincolnDistance(const void* a, const void* b);
 
+/**
+ * Orders the n airports by ascending air distance from the point
+ * (latitude, longitude).  Each distance is computed once into a key
+ * array and the (index, key) pairs are then radix sorted, so the sort
+ * costs n distance evaluations instead of ~2 n log n comparator calls.
+ * The airport array is left untouched: order[i] receives the index of
+ * the i-th closest airport and, when distancesKm is not NULL,
+ * distancesKm[i] its distance.  Both arrays must hold n elements.  Ties
+ * keep their original relative order.  Returns 1 on success or 0 on
+ * invalid input or allocation failure.
+ */
+int sortAirportsByDistance(const Airport* airports,
+                           int n,
+                           double latitude,
+                           double longitude,
+                           int* order,
+                           double* distancesKm);
+
 /**
  * A function that generates and prints several reports on the
- * given array of Airport structures.
+ * given array of Airport structures.  Returns 1 on success, or 0
+ * (with nothing printed) if memory ran out.
  */
-void generateReports(Airport *airports, int n);
+int generateReports(Airport *airports, int n);
 
 #endif /* HACK13_AIRPORT_H */
@@ -0,0 +1,115 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Interactive airport lookups
+ *
+ * Description:
+ * Loads an OurAirports-format CSV file (data/airports_sample.csv by
+ * default), builds the hash indexes once and answers lookups typed on
+ * standard input, printing each answer with the time the lookup took.
+ *
+ * Commands:
+ *   id <gpsId>               the airport with that GPS id
+ *   city <country> <city>    airports in that city (city may have spaces)
+ *   type <type>              airports of that type
+ *   help                     this list
+ *   quit                     exit (end of input works too)
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "airport.h"
+#include "airport_csv.h"
+#include "airport_index.h"
+
+/* Grouped answers print at most this many airports. */
+#define MAX_LISTED 20
+
+static double nowMicros(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void printHelp(void) {
+  printf("Commands:\n"
+         "  id <gpsId>\n"
+         "  city <country> <city>\n"
+         "  type <type>\n"
+         "  help\n"
+         "  quit\n");
+}
+
+static void printMatches(const Airport* airports, const int* rows, int count, double micros) {
+  int listed = count < MAX_LISTED ? count : MAX_LISTED;
+  writeAirports(stdout, airports, rows, listed);
+  if (count > listed) printf("... and %d more\n", count - listed);
+  printf("%d match%s in %.2f us\n", count, count == 1 ? "" : "es", micros);
+}
+
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "data/airports_sample.csv";
+  int n = 0;
+  Airport* airports = loadAirportsCsv(path, &n);
+  if (!airports) {
+    fprintf(stderr, "Unable to load airports from %s\n", path);
+    return 1;
+  }
+
+  double start = nowMicros();
+  AirportIndex* index = createAirportIndex(airports, n);
+  double buildMicros = nowMicros() - start;
+  if (!index) {
+    fprintf(stderr, "Unable to index airports\n");
+    free(airports);
+    return 1;
+  }
+  printf("Indexed %d airports from %s in %.1f ms\n", n, path, buildMicros / 1e3);
+  printHelp();
+
+  int rows[MAX_LISTED];
+  char line[512];
+  for (;;) {
+    printf("> ");
+    fflush(stdout);
+    if (!fgets(line, sizeof(line), stdin)) break;
+    line[strcspn(line, "\r\n")] = '\0';
+
+    char* command = strtok(line, " \t");
+    if (!command) continue;
+    char* arg = strtok(NULL, " \t");
+    char* rest = strtok(NULL, "");
+
+    if (strcmp(command, "quit") == 0 || strcmp(command, "exit") == 0) {
+      break;
+    } else if (strcmp(command, "id") == 0 && arg) {
+      start = nowMicros();
+      int row = airportIndexFindGpsId(index, arg);
+      double micros = nowMicros() - start;
+      printMatches(airports, &row, row >= 0, micros);
+    } else if (strcmp(command, "city") == 0 && arg && rest) {
+      rest += strspn(rest, " \t");
+      start = nowMicros();
+      int count = airportIndexFindCity(index, arg, rest, rows, MAX_LISTED);
+      double micros = nowMicros() - start;
+      printMatches(airports, rows, count, micros);
+    } else if (strcmp(command, "type") == 0 && arg) {
+      start = nowMicros();
+      int count = airportIndexFindType(index, arg, rows, MAX_LISTED);
+      double micros = nowMicros() - start;
+      printMatches(airports, rows, count, micros);
+    } else {
+      printHelp();
+    }
+  }
+
+  freeAirportIndex(index);
+  free(airports);
+  return 0;
+}
@@ -12,14 +12,30 @@
  * Notes:
  * - Demonstrates all required sorting/searching functionality.
  * - Uses representative airports from different locations.
+ * - When given the path of an OurAirports-format CSV file, reports on
+ *   the airports in that file instead (e.g. data/airports_sample.csv).
  */
 
 #include <stdlib.h>
 #include <stdio.h>
 #include "airport.h"
+#include "airport_csv.h"
+
+int main(int argc, char** argv) {
+
+  if (argc > 1) {
+    int n = 0;
+    Airport* loaded = loadAirportsCsv(argv[1], &n);
+    if (!loaded) {
+      fprintf(stderr, "Unable to load airports from %s\n", argv[1]);
+      return 1;
+    }
+    int ok = generateReports(loaded, n);
+    if (!ok) fprintf(stderr, "Out of memory generating the reports\n");
+    free(loaded);
+    return ok ? 0 : 1;
+  }
 
-int main(void) {
-  
   /* Create array with 6 diverse airports for testing */
   Airport airports[6];
   
@@ -48,7 +64,9 @@ int main(void) {
               51.4700, -0.4543, 83, "London", "GB");
   
   /* Generate all reports */
-  generateReports(airports, 6);
-  
-  return 0;
+  int ok = generateReports(airports, 6);
+  if (!ok) fprintf(stderr, "Out of memory generating the reports\n");
+
+  freeAirports(airports, 6);
+  return ok ? 0 : 1;
 }
@@ -0,0 +1,142 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Arena-backed airport construction
+ *
+ * Description:
+ * Implements the bump allocator and arena-backed Airport construction
+ * declared in airport_arena.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "airport_arena.h"
+
+#define DEFAULT_BLOCK_BYTES (64 * 1024)
+
+/* Alignment of airportArenaAlloc results; strings are packed. */
+#define ARENA_ALIGN 16
+
+struct AirportArenaBlock {
+  AirportArenaBlock* next;
+  size_t used;
+  size_t capacity;
+  /* keeps data aligned to ARENA_ALIGN */
+  union {
+    long double ld;
+    void* p;
+    long long ll;
+  } align;
+};
+
+static char* blockData(AirportArenaBlock* block) {
+  return (char*)(block + 1);
+}
+
+/* Bytes reserved for the arena header in front of its first block. */
+static size_t arenaHeaderBytes(void) {
+  return (sizeof(AirportArena) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static void initBlock(AirportArenaBlock* block, size_t capacity) {
+  block->next = NULL;
+  block->used = 0;
+  block->capacity = capacity;
+}
+
+AirportArena* createAirportArena(size_t blockBytes) {
+  if (blockBytes == 0) blockBytes = DEFAULT_BLOCK_BYTES;
+  /* the first block sits right behind the arena header */
+  AirportArena* arena = malloc(arenaHeaderBytes() + sizeof(AirportArenaBlock) + blockBytes);
+  if (!arena) return NULL;
+  arena->blocks = (AirportArenaBlock*)((char*)arena + arenaHeaderBytes());
+  arena->blockBytes = blockBytes;
+  arena->numBlocks = 1;
+  initBlock(arena->blocks, blockBytes);
+  return arena;
+}
+
+/* Bumps bytes off the current block, starting at a multiple of align
+ * (a power of two no larger than ARENA_ALIGN). */
+static void* arenaBump(AirportArena* arena, size_t bytes, size_t align) {
+  AirportArenaBlock* block = arena->blocks;
+  size_t start = (block->used + align - 1) & ~(align - 1);
+  if (start > block->capacity || block->capacity - start < bytes) {
+    size_t capacity = bytes > arena->blockBytes ? bytes : arena->blockBytes;
+    AirportArenaBlock* fresh = malloc(sizeof(AirportArenaBlock) + capacity);
+    if (!fresh) return NULL;
+    initBlock(fresh, capacity);
+    if (bytes > arena->blockBytes) {
+      /* oversized: keep filling the current block afterwards */
+      fresh->next = block->next;
+      block->next = fresh;
+    } else {
+      fresh->next = block;
+      arena->blocks = fresh;
+    }
+    arena->numBlocks++;
+    block = fresh;
+    start = 0;
+  }
+  block->used = start + bytes;
+  return blockData(block) + start;
+}
+
+void* airportArenaAlloc(AirportArena* arena, size_t bytes) {
+  if (!arena) return NULL;
+  return arenaBump(arena, bytes, ARENA_ALIGN);
+}
+
+char* airportArenaStrCopy(AirportArena* arena, const char* src) {
+  if (!arena || !src) return NULL;
+  size_t len = strlen(src) + 1;
+  char* copy = arenaBump(arena, len, 1);
+  if (copy) memcpy(copy, src, len);
+  return copy;
+}
+
+Airport* createAirportsInArena(AirportArena* arena, int n) {
+  if (!arena || n <= 0) return NULL;
+  Airport* airports = airportArenaAlloc(arena, sizeof(Airport) * (size_t)n);
+  if (airports) memset(airports, 0, sizeof(Airport) * (size_t)n);
+  return airports;
+}
+
+int initAirportInArena(AirportArena* arena,
+                       Airport* airport,
+                       const char* gpsId,
+                       const char* type,
+                       const char* name,
+                       double latitude,
+                       double longitude,
+                       int elevationFeet,
+                       const char* city,
+                       const char* countryAbbrv) {
+  if (!arena || !airport) return 0;
+  airport->gpsId = airportArenaStrCopy(arena, gpsId);
+  airport->type = airportArenaStrCopy(arena, type);
+  airport->name = airportArenaStrCopy(arena, name);
+  airport->latitude = latitude;
+  airport->longitude = longitude;
+  airport->elevationFeet = elevationFeet;
+  airport->city = airportArenaStrCopy(arena, city);
+  airport->countryAbbrv = airportArenaStrCopy(arena, countryAbbrv);
+  return (!gpsId || airport->gpsId) && (!type || airport->type) &&
+         (!name || airport->name) && (!city || airport->city) &&
+         (!countryAbbrv || airport->countryAbbrv);
+}
+
+void freeAirportArena(AirportArena* arena) {
+  if (!arena) return;
+  /* the first block is part of the arena's own allocation */
+  AirportArenaBlock* embedded = (AirportArenaBlock*)((char*)arena + arenaHeaderBytes());
+  AirportArenaBlock* block = arena->blocks;
+  while (block) {
+    AirportArenaBlock* next = block->next;
+    if (block != embedded) free(block);
+    block = next;
+  }
+  free(arena);
+}
@@ -0,0 +1,82 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Arena-backed airport construction
+ *
+ * Description:
+ * An AirportArena is a bump allocator for batches of airports.  Airport
+ * arrays and every string copied by initAirportInArena are carved out
+ * of large blocks, so building n airports costs a handful of mallocs
+ * instead of 5n, and the whole batch is released with a single call to
+ * freeAirportArena.
+ *
+ * Notes:
+ * - Nothing allocated from an arena may be passed to free(),
+ *   freeAirport or freeAirports.
+ * - Pointers into the arena stay valid until freeAirportArena.
+ */
+
+#ifndef HACK13_AIRPORT_ARENA_H
+#define HACK13_AIRPORT_ARENA_H
+
+#include <stddef.h>
+
+#include "airport.h"
+
+typedef struct AirportArenaBlock AirportArenaBlock;
+
+typedef struct {
+  AirportArenaBlock* blocks; /* block being filled, then older blocks */
+  size_t blockBytes;         /* usable bytes of a regular block */
+  int numBlocks;             /* blocks allocated so far */
+} AirportArena;
+
+/**
+ * Creates an arena whose blocks hold blockBytes bytes each (0 picks a
+ * default of 64 KB).  The arena and its first block share one malloc.
+ * Returns NULL on allocation failure.
+ */
+AirportArena* createAirportArena(size_t blockBytes);
+
+/**
+ * Returns bytes of arena memory aligned for any type, or NULL on
+ * allocation failure.  Requests larger than a block get a block of
+ * their own.
+ */
+void* airportArenaAlloc(AirportArena* arena, size_t bytes);
+
+/**
+ * Copies the string src into the arena; returns NULL when src is NULL
+ * or on allocation failure.
+ */
+char* airportArenaStrCopy(AirportArena* arena, const char* src);
+
+/**
+ * Allocates a zeroed array of n Airports from the arena, or NULL on
+ * invalid input or allocation failure.
+ */
+Airport* createAirportsInArena(AirportArena* arena, int n);
+
+/**
+ * Like initAirport, but the deep copies of the strings come from the
+ * arena.  Returns 1 on success or 0 on invalid input or allocation
+ * failure.
+ */
+int initAirportInArena(AirportArena* arena,
+                       Airport* airport,
+                       const char* gpsId,
+                       const char* type,
+                       const char* name,
+                       double latitude,
+                       double longitude,
+                       int elevationFeet,
+                       const char* city,
+                       const char* countryAbbrv);
+
+/**
+ * Frees the arena and everything allocated from it.  Safe to pass NULL.
+ */
+void freeAirportArena(AirportArena* arena);
+
+#endif /* HACK13_AIRPORT_ARENA_H */
@@ -0,0 +1,340 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - OurAirports CSV loader
+ *
+ * Description:
+ * Implements the memory-mapped, single-pass OurAirports CSV loader
+ * declared in airport_csv.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "airport_csv.h"
+
+/* Roles a CSV column can play; text roles come first. */
+enum {
+  ROLE_GPS_ID,
+  ROLE_TYPE,
+  ROLE_NAME,
+  ROLE_CITY,
+  ROLE_COUNTRY,
+  NUM_TEXT_ROLES,
+  ROLE_LATITUDE = NUM_TEXT_ROLES,
+  ROLE_LONGITUDE,
+  ROLE_ELEVATION,
+  NUM_ROLES
+};
+
+static const char* ROLE_HEADERS[NUM_ROLES] = {
+  "ident", "type", "name", "municipality", "iso_country",
+  "latitude_deg", "longitude_deg", "elevation_ft"
+};
+
+/* More header columns than this are parsed but never used. */
+#define MAX_COLUMNS 64
+
+typedef struct {
+  const char* data;
+  size_t size;
+} MappedFile;
+
+typedef struct {
+  signed char roles[MAX_COLUMNS]; /* role of each column, -1 if unused */
+  int numColumns;
+} CsvLayout;
+
+typedef struct {
+  const char* text[NUM_TEXT_ROLES];
+  double latitude;
+  double longitude;
+  int elevationFeet;
+  size_t bytes; /* bytes of the destination buffer used by text */
+} CsvRow;
+
+static int mapFile(const char* path, MappedFile* file) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return 0;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
+    return 0;
+  }
+  void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) return 0;
+  posix_madvise(data, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+  file->data = data;
+  file->size = (size_t)st.st_size;
+  return 1;
+}
+
+static void unmapFile(MappedFile* file) {
+  munmap((void*)file->data, file->size);
+}
+
+/* Upper bound on the number of records: one per line. */
+static int countLines(const MappedFile* file) {
+  int lines = 0;
+  const char* p = file->data;
+  const char* end = file->data + file->size;
+  while (p < end && (p = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+    lines++;
+    p++;
+  }
+  return lines + 1;
+}
+
+/*
+ * Scans one field starting at *pos.  When out is not NULL the unquoted
+ * contents are written there (not NUL-terminated).  Returns the length
+ * of the contents and sets *endOfRow when the field ended its record.
+ */
+static size_t scanField(const char** pos, const char* end, char* out, int* endOfRow) {
+  const char* p = *pos;
+  size_t len = 0;
+
+  if (p < end && *p == '"') {
+    p++;
+    for (;;) {
+      const char* quote = memchr(p, '"', (size_t)(end - p));
+      if (!quote) quote = end;
+      if (out) memcpy(out + len, p, (size_t)(quote - p));
+      len += (size_t)(quote - p);
+      p = quote;
+      if (p >= end) break;
+      if (p + 1 < end && p[1] == '"') {
+        /* "" is an escaped quote inside a quoted field */
+        if (out) out[len] = '"';
+        len++;
+        p += 2;
+      } else {
+        p++;
+        break;
+      }
+    }
+    while (p < end && *p != ',' && *p != '\n' && *p != '\r') p++;
+  } else {
+    const char* start = p;
+    while (p < end && *p != ',' && *p != '\n' && *p != '\r') p++;
+    len = (size_t)(p - start);
+    if (out) memcpy(out, start, len);
+  }
+
+  if (p < end && *p == ',') {
+    *endOfRow = 0;
+    p++;
+  } else {
+    *endOfRow = 1;
+    if (p < end && *p == '\r') p++;
+    if (p < end && *p == '\n') p++;
+  }
+  *pos = p;
+  return len;
+}
+
+static const double POW10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * Parses a decimal number from the NUL-terminated string s.  Plain
+ * "-ddd.ddd" values whose digits fit in 53 bits are converted with one
+ * correctly rounded division; anything else falls back to strtod.
+ * Empty fields parse as 0.
+ */
+static double parseNumber(const char* s) {
+  const char* p = s;
+  int negative = 0;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    p++;
+  }
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int fraction = 0;
+  int seenPoint = 0;
+  for (;; p++) {
+    if (*p >= '0' && *p <= '9') {
+      if (digits < 19) {
+        mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+        digits++;
+        fraction += seenPoint;
+      } else {
+        return strtod(s, NULL);
+      }
+    } else if (*p == '.' && !seenPoint) {
+      seenPoint = 1;
+    } else {
+      break;
+    }
+  }
+  if (*p != '\0' || mantissa >= ((uint64_t)1 << 53) || fraction > 22) {
+    return digits ? strtod(s, NULL) : 0.0;
+  }
+  double value = (double)mantissa / POW10[fraction];
+  return negative ? -value : value;
+}
+
+static int readHeader(const char** pos, const char* end, CsvLayout* layout) {
+  char name[64];
+  int found[NUM_ROLES] = { 0 };
+  int endOfRow = 0;
+  layout->numColumns = 0;
+  while (!endOfRow) {
+    const char* fieldStart = *pos;
+    size_t len = scanField(pos, end, NULL, &endOfRow);
+    int role = -1;
+    if (len < sizeof(name)) {
+      *pos = fieldStart;
+      scanField(pos, end, name, &endOfRow);
+      name[len] = '\0';
+      for (int r = 0; r < NUM_ROLES; r++) {
+        if (strcmp(name, ROLE_HEADERS[r]) == 0) role = r;
+      }
+    }
+    if (layout->numColumns < MAX_COLUMNS) {
+      layout->roles[layout->numColumns++] = (signed char)role;
+      if (role >= 0) found[role] = 1;
+    }
+  }
+  for (int r = 0; r < NUM_ROLES; r++) {
+    if (!found[r]) return 0;
+  }
+  return 1;
+}
+
+/*
+ * Parses the record at *pos, decoding its text fields into dst.
+ * Returns 1 when a record was read, 0 at the end of the data.
+ */
+static int parseRow(const char** pos, const char* end, const CsvLayout* layout,
+                    char* dst, CsvRow* row) {
+  /* skip blank lines */
+  while (*pos < end && (**pos == '\n' || **pos == '\r')) (*pos)++;
+  if (*pos >= end) return 0;
+
+  size_t used = 0;
+  for (int r = 0; r < NUM_TEXT_ROLES; r++) row->text[r] = "";
+  row->latitude = 0.0;
+  row->longitude = 0.0;
+  row->elevationFeet = 0;
+
+  int endOfRow = 0;
+  for (int column = 0; !endOfRow; column++) {
+    int role = column < layout->numColumns ? layout->roles[column] : -1;
+    if (role < 0) {
+      scanField(pos, end, NULL, &endOfRow);
+      continue;
+    }
+    char* out = dst + used;
+    size_t len = scanField(pos, end, out, &endOfRow);
+    out[len] = '\0';
+    if (role < NUM_TEXT_ROLES) {
+      row->text[role] = out;
+      used += len + 1;
+    } else if (role == ROLE_LATITUDE) {
+      row->latitude = parseNumber(out);
+    } else if (role == ROLE_LONGITUDE) {
+      row->longitude = parseNumber(out);
+    } else {
+      row->elevationFeet = (int)parseNumber(out);
+    }
+  }
+  row->bytes = used;
+  return 1;
+}
+
+Airport* loadAirportsCsv(const char* path, int* n) {
+  if (!path || !n) return NULL;
+  *n = 0;
+  MappedFile file;
+  if (!mapFile(path, &file)) return NULL;
+
+  const char* pos = file.data;
+  const char* end = file.data + file.size;
+  CsvLayout layout;
+  if (!readHeader(&pos, end, &layout)) {
+    unmapFile(&file);
+    return NULL;
+  }
+
+  /* decoded text never exceeds the raw bytes plus one NUL per field */
+  size_t maxRows = (size_t)countLines(&file);
+  size_t arraySize = maxRows * sizeof(Airport);
+  Airport* airports = malloc(arraySize + file.size + 1);
+  if (!airports) {
+    unmapFile(&file);
+    return NULL;
+  }
+  char* arena = (char*)airports + arraySize;
+  size_t used = 0;
+
+  int count = 0;
+  CsvRow row;
+  while ((size_t)count < maxRows && parseRow(&pos, end, &layout, arena + used, &row)) {
+    Airport* a = &airports[count++];
+    a->gpsId = (char*)row.text[ROLE_GPS_ID];
+    a->type = (char*)row.text[ROLE_TYPE];
+    a->name = (char*)row.text[ROLE_NAME];
+    a->latitude = row.latitude;
+    a->longitude = row.longitude;
+    a->elevationFeet = row.elevationFeet;
+    a->city = (char*)row.text[ROLE_CITY];
+    a->countryAbbrv = (char*)row.text[ROLE_COUNTRY];
+    used += row.bytes;
+  }
+
+  unmapFile(&file);
+  *n = count;
+  return airports;
+}
+
+AirportTable* loadAirportTableCsv(const char* path) {
+  if (!path) return NULL;
+  MappedFile file;
+  if (!mapFile(path, &file)) return NULL;
+
+  const char* pos = file.data;
+  const char* end = file.data + file.size;
+  CsvLayout layout;
+  AirportTable* table = NULL;
+  char* scratch = NULL;
+  if (readHeader(&pos, end, &layout)) {
+    table = createAirportTable(countLines(&file), file.size);
+    scratch = malloc(file.size + 1);
+  }
+  if (!table || !scratch) {
+    freeAirportTable(table);
+    free(scratch);
+    unmapFile(&file);
+    return NULL;
+  }
+
+  CsvRow row;
+  while (parseRow(&pos, end, &layout, scratch, &row)) {
+    if (airportTableAdd(table, row.text[ROLE_GPS_ID], row.text[ROLE_TYPE],
+                        row.text[ROLE_NAME], row.latitude, row.longitude,
+                        row.elevationFeet, row.text[ROLE_CITY],
+                        row.text[ROLE_COUNTRY]) < 0) {
+      fprintf(stderr, "loadAirportTableCsv: table full, stopping at %d rows\n",
+              table->size);
+      break;
+    }
+  }
+
+  free(scratch);
+  unmapFile(&file);
+  return table;
+}
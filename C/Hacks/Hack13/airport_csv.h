@@ -0,0 +1,41 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - OurAirports CSV loader
+ *
+ * Description:
+ * Loads airports.csv files in the OurAirports format
+ * (https://ourairports.com/data/) by memory-mapping the file and
+ * parsing it in a single streaming pass.  Columns are located by their
+ * header names (ident, type, name, latitude_deg, longitude_deg,
+ * elevation_ft, municipality, iso_country); quoted fields with embedded
+ * commas, quotes and newlines are supported.
+ *
+ * NOTE: loadAirportsCsv returns one malloc'd block holding both the
+ * Airport array and all of its strings; the caller releases everything
+ * with a single free() on the returned pointer.  On NULL input, an
+ * unreadable file or a missing header column both loaders return NULL.
+ */
+
+#ifndef HACK13_AIRPORT_CSV_H
+#define HACK13_AIRPORT_CSV_H
+
+#include "airport.h"
+#include "airport_table.h"
+
+/**
+ * Loads every airport in the CSV file at path into a newly allocated
+ * array and stores the number of airports in *n.  The array and its
+ * strings share one allocation: free() the returned pointer once and
+ * do not free the individual strings.
+ */
+Airport* loadAirportsCsv(const char* path, int* n);
+
+/**
+ * Loads every airport in the CSV file at path into a newly created
+ * AirportTable (release with freeAirportTable).
+ */
+AirportTable* loadAirportTableCsv(const char* path);
+
+#endif /* HACK13_AIRPORT_CSV_H */
@@ -0,0 +1,267 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport hash indexes
+ *
+ * Description:
+ * Implements the open-addressing GPS id index and the grouped
+ * (country, city) and type indexes declared in airport_index.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "airport_index.h"
+
+#define INITIAL_SLOTS 64
+
+/* A grouping key: one or two strings (second is NULL for one). */
+typedef struct {
+  const char* first;
+  const char* second;
+} GroupKey;
+
+typedef void (*KeyFn)(const Airport* a, GroupKey* key);
+
+static const char* orEmpty(const char* s) {
+  return s ? s : "";
+}
+
+static unsigned int hashBytes(unsigned int h, const char* str) {
+  for (; *str; str++) {
+    h ^= (unsigned char)*str;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static unsigned int hashKey(const GroupKey* key) {
+  unsigned int h = hashBytes(2166136261u, key->first);
+  if (key->second) {
+    /* a separator byte keeps ("AB", "C") apart from ("A", "BC") */
+    h ^= 0xffu;
+    h *= 16777619u;
+    h = hashBytes(h, key->second);
+  }
+  return h;
+}
+
+static int keysEqual(const GroupKey* a, const GroupKey* b) {
+  if (strcmp(a->first, b->first) != 0) return 0;
+  if (!a->second || !b->second) return a->second == b->second;
+  return strcmp(a->second, b->second) == 0;
+}
+
+static void cityKey(const Airport* a, GroupKey* key) {
+  key->first = orEmpty(a->countryAbbrv);
+  key->second = orEmpty(a->city);
+}
+
+static void typeKey(const Airport* a, GroupKey* key) {
+  key->first = orEmpty(a->type);
+  key->second = NULL;
+}
+
+static void gpsKey(const Airport* a, GroupKey* key) {
+  key->first = orEmpty(a->gpsId);
+  key->second = NULL;
+}
+
+/*
+ * Probes a table whose slots hold entry + 1 (0 = empty) for key.  An
+ * entry is a row when rowOfEntry is NULL and a group whose first row is
+ * rowOfEntry[entry] otherwise.  Returns the slot holding the key or the
+ * empty slot where it belongs.
+ */
+static int probe(const int* slots, int numSlots, const int* rowOfEntry,
+                 const Airport* airports, KeyFn keyOf, const GroupKey* key) {
+  unsigned int mask = (unsigned int)numSlots - 1;
+  unsigned int slot = hashKey(key) & mask;
+  while (slots[slot] != 0) {
+    int entry = slots[slot] - 1;
+    GroupKey other;
+    keyOf(&airports[rowOfEntry ? rowOfEntry[entry] : entry], &other);
+    if (keysEqual(key, &other)) break;
+    slot = (slot + 1) & mask;
+  }
+  return (int)slot;
+}
+
+/* Rebuilds a slot table with twice as many slots, re-probing every
+ * occupied slot. */
+static int growSlots(int** slots, int* numSlots, const int* rowOfEntry,
+                     const Airport* airports, KeyFn keyOf) {
+  int newCount = *numSlots ? *numSlots * 2 : INITIAL_SLOTS;
+  int* fresh = calloc(newCount, sizeof(int));
+  if (!fresh) return 0;
+  for (int s = 0; s < *numSlots; s++) {
+    int value = (*slots)[s];
+    if (value == 0) continue;
+    GroupKey key;
+    keyOf(&airports[rowOfEntry ? rowOfEntry[value - 1] : value - 1], &key);
+    /* every key is distinct, so the probe only stops at empty slots */
+    fresh[probe(fresh, newCount, rowOfEntry, airports, keyOf, &key)] = value;
+  }
+  free(*slots);
+  *slots = fresh;
+  *numSlots = newCount;
+  return 1;
+}
+
+/* Grows the GPS id table so that one more id keeps it at most half full. */
+static int reserveGpsId(AirportIndex* index) {
+  return (index->gpsCount + 1) * 2 <= index->gpsSlotCount ||
+         growSlots(&index->gpsSlots, &index->gpsSlotCount, NULL, index->airports, gpsKey);
+}
+
+/* Inserts the row's GPS id; reserveGpsId must have made room. */
+static void addGpsId(AirportIndex* index, int row) {
+  GroupKey key;
+  gpsKey(&index->airports[row], &key);
+  int slot = probe(index->gpsSlots, index->gpsSlotCount, NULL, index->airports, gpsKey, &key);
+  if (index->gpsSlots[slot] == 0) {
+    index->gpsSlots[slot] = row + 1;
+    index->gpsCount++;
+  }
+}
+
+/* Grows a group table so that one more group keeps it at most half full. */
+static int reserveGroup(AirportGroupIndex* g, const Airport* airports, KeyFn keyOf) {
+  return (g->numGroups + 1) * 2 <= g->numSlots ||
+         growSlots(&g->slots, &g->numSlots, g->groupFirst, airports, keyOf);
+}
+
+/* Appends the row to its group; reserveGroup must have made room. */
+static void addToGroup(AirportGroupIndex* g, const Airport* airports, int row, KeyFn keyOf) {
+  GroupKey key;
+  keyOf(&airports[row], &key);
+  int slot = probe(g->slots, g->numSlots, g->groupFirst, airports, keyOf, &key);
+  g->next[row] = -1;
+  if (g->slots[slot] != 0) {
+    int group = g->slots[slot] - 1;
+    g->next[g->groupLast[group]] = row;
+    g->groupLast[group] = row;
+    g->groupSize[group]++;
+  } else {
+    /* group arrays are sized like the row arrays, so there is room */
+    int group = g->numGroups++;
+    g->groupFirst[group] = row;
+    g->groupLast[group] = row;
+    g->groupSize[group] = 1;
+    g->slots[slot] = group + 1;
+  }
+}
+
+static int growArray(int** array, int capacity) {
+  int* grown = realloc(*array, sizeof(int) * capacity);
+  if (!grown) return 0;
+  *array = grown;
+  return 1;
+}
+
+/* Makes every per-row (and per-group) array hold capacity entries. */
+static int reserveRows(AirportIndex* index, int capacity) {
+  if (capacity <= index->rowCapacity) return 1;
+  if (capacity < index->rowCapacity * 2) capacity = index->rowCapacity * 2;
+  AirportGroupIndex* groups[2] = { &index->byCity, &index->byType };
+  for (int i = 0; i < 2; i++) {
+    AirportGroupIndex* g = groups[i];
+    if (!growArray(&g->next, capacity) || !growArray(&g->groupFirst, capacity) ||
+        !growArray(&g->groupLast, capacity) || !growArray(&g->groupSize, capacity)) {
+      return 0;
+    }
+  }
+  index->rowCapacity = capacity;
+  return 1;
+}
+
+AirportIndex* createAirportIndex(const Airport* airports, int n) {
+  if ((!airports && n > 0) || n < 0) return NULL;
+  AirportIndex* index = calloc(1, sizeof(AirportIndex));
+  if (!index) return NULL;
+  index->airports = airports;
+  if (!reserveRows(index, n > 0 ? n : INITIAL_SLOTS / 2) ||
+      !airportIndexAdd(index, airports, n)) {
+    freeAirportIndex(index);
+    return NULL;
+  }
+  return index;
+}
+
+int airportIndexAdd(AirportIndex* index, const Airport* airports, int n) {
+  if (!index || n < index->size || (!airports && n > 0)) return 0;
+  if (n == index->size) {
+    index->airports = airports;
+    return 1;
+  }
+  if (!reserveRows(index, n)) return 0;
+  index->airports = airports;
+  for (int row = index->size; row < n; row++) {
+    /* grow every table first, so a failure leaves the row out of all of them */
+    if (!reserveGpsId(index) || !reserveGroup(&index->byCity, airports, cityKey) ||
+        !reserveGroup(&index->byType, airports, typeKey)) {
+      return 0;
+    }
+    addGpsId(index, row);
+    addToGroup(&index->byCity, airports, row, cityKey);
+    addToGroup(&index->byType, airports, row, typeKey);
+    index->size = row + 1;
+  }
+  return 1;
+}
+
+int airportIndexFindGpsId(const AirportIndex* index, const char* gpsId) {
+  if (!index || index->gpsCount == 0) return -1;
+  GroupKey key = { orEmpty(gpsId), NULL };
+  int slot = probe(index->gpsSlots, index->gpsSlotCount, NULL, index->airports, gpsKey, &key);
+  return index->gpsSlots[slot] - 1;
+}
+
+static int findGroup(const AirportGroupIndex* g, const Airport* airports, KeyFn keyOf,
+                     const GroupKey* key, int* rows, int maxRows) {
+  if (g->numGroups == 0) return 0;
+  int slot = probe(g->slots, g->numSlots, g->groupFirst, airports, keyOf, key);
+  if (g->slots[slot] == 0) return 0;
+  int group = g->slots[slot] - 1;
+  int written = 0;
+  for (int row = g->groupFirst[group]; row >= 0 && written < maxRows; row = g->next[row]) {
+    rows[written++] = row;
+  }
+  return g->groupSize[group];
+}
+
+int airportIndexFindCity(const AirportIndex* index,
+                         const char* countryAbbrv,
+                         const char* city,
+                         int* rows,
+                         int maxRows) {
+  if (!index || (!rows && maxRows > 0)) return 0;
+  GroupKey key = { orEmpty(countryAbbrv), orEmpty(city) };
+  return findGroup(&index->byCity, index->airports, cityKey, &key, rows, maxRows);
+}
+
+int airportIndexFindType(const AirportIndex* index,
+                         const char* type,
+                         int* rows,
+                         int maxRows) {
+  if (!index || (!rows && maxRows > 0)) return 0;
+  GroupKey key = { orEmpty(type), NULL };
+  return findGroup(&index->byType, index->airports, typeKey, &key, rows, maxRows);
+}
+
+static void freeGroupIndex(AirportGroupIndex* g) {
+  free(g->slots);
+  free(g->groupFirst);
+  free(g->groupLast);
+  free(g->groupSize);
+  free(g->next);
+}
+
+void freeAirportIndex(AirportIndex* index) {
+  if (!index) return;
+  free(index->gpsSlots);
+  freeGroupIndex(&index->byCity);
+  freeGroupIndex(&index->byType);
+  free(index);
+}
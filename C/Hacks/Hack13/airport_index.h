@@ -0,0 +1,97 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport hash indexes
+ *
+ * Description:
+ * Secondary indexes over an Airport array: an open-addressing hash
+ * table from GPS id to row, and grouped indexes from (country, city)
+ * and from type to the rows sharing that key.  Lookups cost one hash
+ * and a short probe instead of a strcmp scan of the whole array, and
+ * the indexes grow incrementally as airports are appended.
+ *
+ * Notes:
+ * - The index stores row numbers, not copies: it reads the strings of
+ *   the array it was last given, which must stay alive and unmodified
+ *   while the index is used.
+ * - NULL strings index and match like empty strings.
+ * - Grouped lookups report rows in array order.
+ */
+
+#ifndef HACK13_AIRPORT_INDEX_H
+#define HACK13_AIRPORT_INDEX_H
+
+#include "airport.h"
+
+/* One grouped index: key -> list of rows. */
+typedef struct {
+  int* slots;       /* open-addressing table of group + 1, 0 when empty */
+  int numSlots;     /* power of two, kept at most half full */
+  int numGroups;
+  int groupCapacity;
+  int* groupFirst;  /* first row of each group (also its key) */
+  int* groupLast;   /* last row of each group, for appending */
+  int* groupSize;
+  int* next;        /* next row in the same group, -1 at the end */
+} AirportGroupIndex;
+
+typedef struct {
+  const Airport* airports; /* array being indexed (not owned) */
+  int size;                /* rows indexed so far */
+  int rowCapacity;         /* rows the per-row arrays can hold */
+  int* gpsSlots;           /* open-addressing table of row + 1 */
+  int gpsSlotCount;        /* power of two, kept at most half full */
+  int gpsCount;            /* distinct GPS ids stored */
+  AirportGroupIndex byCity;
+  AirportGroupIndex byType;
+} AirportIndex;
+
+/**
+ * Creates the indexes for the n airports of the given array (n may be
+ * 0 to start empty).  Release with freeAirportIndex.  Returns NULL on
+ * invalid input or allocation failure.
+ */
+AirportIndex* createAirportIndex(const Airport* airports, int n);
+
+/**
+ * Extends the index to cover airports[index->size .. n-1].  airports
+ * is the current array: it may be a grown or moved copy of the array
+ * indexed so far as long as the rows already indexed are unchanged.
+ * Returns 1 on success or 0 on invalid input or allocation failure;
+ * after a failure index->size tells how many rows are indexed.
+ */
+int airportIndexAdd(AirportIndex* index, const Airport* airports, int n);
+
+/**
+ * Returns the row of the airport with the given GPS id, or -1 if there
+ * is none.  With duplicate ids the first row added wins.
+ */
+int airportIndexFindGpsId(const AirportIndex* index, const char* gpsId);
+
+/**
+ * Returns the number of airports in the given country and city and
+ * writes up to maxRows of their rows, in array order, into rows (which
+ * may be NULL when maxRows is 0).
+ */
+int airportIndexFindCity(const AirportIndex* index,
+                         const char* countryAbbrv,
+                         const char* city,
+                         int* rows,
+                         int maxRows);
+
+/**
+ * Returns the number of airports of the given type and writes up to
+ * maxRows of their rows, in array order, into rows.
+ */
+int airportIndexFindType(const AirportIndex* index,
+                         const char* type,
+                         int* rows,
+                         int maxRows);
+
+/**
+ * Frees the index (not the airports).  Safe to pass NULL.
+ */
+void freeAirportIndex(AirportIndex* index);
+
+#endif /* HACK13_AIRPORT_INDEX_H */
@@ -0,0 +1,327 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport spatial index
+ *
+ * Description:
+ * Implements the unit-sphere k-d tree declared in airport_kdtree.h.
+ * Nearness is measured by chord length, which orders points exactly as
+ * great-circle distance does, so no trig is needed inside a query.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "airport_kdtree.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define EARTH_RADIUS_KM 6371.0
+
+typedef struct {
+  double p[3];
+  int idx;
+} KdPoint;
+
+typedef struct {
+  double d2;
+  int idx;
+} KdHit;
+
+static void toUnitVector(double latitude, double longitude, double out[3]) {
+  double phi = latitude * M_PI / 180.0;
+  double lambda = longitude * M_PI / 180.0;
+  out[0] = cos(phi) * cos(lambda);
+  out[1] = cos(phi) * sin(lambda);
+  out[2] = sin(phi);
+}
+
+/* Converts a squared chord length on the unit sphere to kilometers. */
+static double chord2ToKm(double d2) {
+  double half = sqrt(d2) / 2.0;
+  if (half > 1.0) half = 1.0;
+  return 2.0 * EARTH_RADIUS_KM * asin(half);
+}
+
+static int hitLess(const KdHit* a, const KdHit* b) {
+  if (a->d2 != b->d2) return a->d2 < b->d2;
+  return a->idx < b->idx;
+}
+
+static int cmpHit(const void* a, const void* b) {
+  const KdHit* aa = (const KdHit*)a;
+  const KdHit* bb = (const KdHit*)b;
+  if (hitLess(aa, bb)) return -1;
+  if (hitLess(bb, aa)) return 1;
+  return 0;
+}
+
+static void swapPoints(KdPoint* a, KdPoint* b) {
+  KdPoint t = *a;
+  *a = *b;
+  *b = t;
+}
+
+/* Partially orders pts[lo, hi) so that pts[k] holds the element that
+ * would be there if the range were sorted along dimension d. */
+static void selectPoint(KdPoint* pts, int lo, int hi, int k, int d) {
+  while (hi - lo > 1) {
+    double pivot = pts[lo + (hi - lo) / 2].p[d];
+    int i = lo, j = hi - 1;
+    while (i <= j) {
+      while (pts[i].p[d] < pivot) i++;
+      while (pts[j].p[d] > pivot) j--;
+      if (i <= j) {
+        swapPoints(&pts[i], &pts[j]);
+        i++;
+        j--;
+      }
+    }
+    if (k <= j) {
+      hi = j + 1;
+    } else if (k >= i) {
+      lo = i;
+    } else {
+      return;
+    }
+  }
+}
+
+static void buildRange(AirportKdTree* tree, KdPoint* pts, int lo, int hi) {
+  while (lo < hi) {
+    double minv[3] = { 2.0, 2.0, 2.0 };
+    double maxv[3] = { -2.0, -2.0, -2.0 };
+    for (int i = lo; i < hi; i++) {
+      for (int d = 0; d < 3; d++) {
+        if (pts[i].p[d] < minv[d]) minv[d] = pts[i].p[d];
+        if (pts[i].p[d] > maxv[d]) maxv[d] = pts[i].p[d];
+      }
+    }
+    int dim = 0;
+    for (int d = 1; d < 3; d++) {
+      if (maxv[d] - minv[d] > maxv[dim] - minv[dim]) dim = d;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    selectPoint(pts, lo, hi, mid, dim);
+    memcpy(&tree->xyz[3 * mid], pts[mid].p, sizeof(pts[mid].p));
+    tree->index[mid] = pts[mid].idx;
+    tree->dim[mid] = (unsigned char)dim;
+
+    buildRange(tree, pts, lo, mid);
+    lo = mid + 1;
+  }
+}
+
+AirportKdTree* createAirportKdTree(const Airport* airports, int n) {
+  if (!airports || n < 1) return NULL;
+
+  AirportKdTree* tree = malloc(sizeof(AirportKdTree));
+  KdPoint* pts = malloc(sizeof(KdPoint) * n);
+  if (!tree || !pts) {
+    free(tree);
+    free(pts);
+    return NULL;
+  }
+  tree->n = n;
+  tree->xyz = malloc(sizeof(double) * 3 * n);
+  tree->index = malloc(sizeof(int) * n);
+  tree->dim = malloc(sizeof(unsigned char) * n);
+  if (!tree->xyz || !tree->index || !tree->dim) {
+    free(pts);
+    freeAirportKdTree(tree);
+    return NULL;
+  }
+
+  for (int i = 0; i < n; i++) {
+    toUnitVector(airports[i].latitude, airports[i].longitude, pts[i].p);
+    pts[i].idx = i;
+  }
+  buildRange(tree, pts, 0, n);
+  free(pts);
+  return tree;
+}
+
+static double dist2To(const AirportKdTree* tree, int slot, const double q[3]) {
+  const double* p = &tree->xyz[3 * slot];
+  double dx = p[0] - q[0];
+  double dy = p[1] - q[1];
+  double dz = p[2] - q[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+/* Bounded max-heap of the k best hits seen so far (worst at heap[0]). */
+typedef struct {
+  KdHit* heap;
+  int size;
+  int k;
+} KnnState;
+
+static void knnOffer(KnnState* s, KdHit hit) {
+  if (s->size < s->k) {
+    int c = s->size++;
+    while (c > 0) {
+      int parent = (c - 1) / 2;
+      if (!hitLess(&s->heap[parent], &hit)) break;
+      s->heap[c] = s->heap[parent];
+      c = parent;
+    }
+    s->heap[c] = hit;
+  } else if (hitLess(&hit, &s->heap[0])) {
+    int c = 0;
+    for (;;) {
+      int child = 2 * c + 1;
+      if (child >= s->size) break;
+      if (child + 1 < s->size && hitLess(&s->heap[child], &s->heap[child + 1])) {
+        child++;
+      }
+      if (!hitLess(&hit, &s->heap[child])) break;
+      s->heap[c] = s->heap[child];
+      c = child;
+    }
+    s->heap[c] = hit;
+  }
+}
+
+static void knnSearch(const AirportKdTree* tree, int lo, int hi,
+                      const double q[3], KnnState* s) {
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    KdHit hit = { dist2To(tree, mid, q), tree->index[mid] };
+    knnOffer(s, hit);
+
+    double diff = q[tree->dim[mid]] - tree->xyz[3 * mid + tree->dim[mid]];
+    int nearLo = diff < 0 ? lo : mid + 1;
+    int nearHi = diff < 0 ? mid : hi;
+    int farLo = diff < 0 ? mid + 1 : lo;
+    int farHi = diff < 0 ? hi : mid;
+
+    knnSearch(tree, nearLo, nearHi, q, s);
+    if (s->size == s->k && diff * diff > s->heap[0].d2) return;
+    lo = farLo;
+    hi = farHi;
+  }
+}
+
+int findNearestAirports(const AirportKdTree* tree,
+                        double latitude,
+                        double longitude,
+                        int k,
+                        int* indices,
+                        double* distancesKm) {
+  if (!tree || !indices || k < 1) return 0;
+  if (k > tree->n) k = tree->n;
+
+  KnnState s;
+  s.heap = malloc(sizeof(KdHit) * k);
+  if (!s.heap) return 0;
+  s.size = 0;
+  s.k = k;
+
+  double q[3];
+  toUnitVector(latitude, longitude, q);
+  knnSearch(tree, 0, tree->n, q, &s);
+
+  qsort(s.heap, s.size, sizeof(KdHit), cmpHit);
+  for (int i = 0; i < s.size; i++) {
+    indices[i] = s.heap[i].idx;
+    if (distancesKm) distancesKm[i] = chord2ToKm(s.heap[i].d2);
+  }
+  int found = s.size;
+  free(s.heap);
+  return found;
+}
+
+typedef struct {
+  KdHit* hits;
+  int size;
+  int capacity;
+  int failed;
+} RadiusState;
+
+static void radiusSearch(const AirportKdTree* tree, int lo, int hi,
+                         const double q[3], double r2, RadiusState* s) {
+  while (lo < hi && !s->failed) {
+    int mid = lo + (hi - lo) / 2;
+    double d2 = dist2To(tree, mid, q);
+    if (d2 <= r2) {
+      if (s->size == s->capacity) {
+        int newCapacity = s->capacity ? s->capacity * 2 : 64;
+        KdHit* grown = realloc(s->hits, sizeof(KdHit) * newCapacity);
+        if (!grown) {
+          s->failed = 1;
+          return;
+        }
+        s->hits = grown;
+        s->capacity = newCapacity;
+      }
+      s->hits[s->size].d2 = d2;
+      s->hits[s->size].idx = tree->index[mid];
+      s->size++;
+    }
+
+    double diff = q[tree->dim[mid]] - tree->xyz[3 * mid + tree->dim[mid]];
+    if (diff * diff <= r2) {
+      radiusSearch(tree, lo, mid, q, r2, s);
+      lo = mid + 1;
+    } else if (diff < 0) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+}
+
+int findAirportsWithinRadius(const AirportKdTree* tree,
+                             double latitude,
+                             double longitude,
+                             double radiusKm,
+                             int** indices,
+                             double** distancesKm) {
+  if (!tree || !indices || radiusKm < 0.0) return -1;
+
+  /* a great-circle radius maps to the chord 2*sin(theta/2) */
+  double theta = radiusKm / EARTH_RADIUS_KM;
+  if (theta > M_PI) theta = M_PI;
+  double chord = 2.0 * sin(theta / 2.0);
+
+  RadiusState s = { NULL, 0, 0, 0 };
+  double q[3];
+  toUnitVector(latitude, longitude, q);
+  radiusSearch(tree, 0, tree->n, q, chord * chord, &s);
+  if (s.failed) {
+    free(s.hits);
+    return -1;
+  }
+
+  qsort(s.hits, s.size, sizeof(KdHit), cmpHit);
+  int* outIdx = malloc(sizeof(int) * (s.size ? s.size : 1));
+  double* outDist = distancesKm ? malloc(sizeof(double) * (s.size ? s.size : 1)) : NULL;
+  if (!outIdx || (distancesKm && !outDist)) {
+    free(outIdx);
+    free(outDist);
+    free(s.hits);
+    return -1;
+  }
+  for (int i = 0; i < s.size; i++) {
+    outIdx[i] = s.hits[i].idx;
+    if (outDist) outDist[i] = chord2ToKm(s.hits[i].d2);
+  }
+  free(s.hits);
+
+  *indices = outIdx;
+  if (distancesKm) *distancesKm = outDist;
+  return s.size;
+}
+
+void freeAirportKdTree(AirportKdTree* tree) {
+  if (!tree) return;
+  free(tree->xyz);
+  free(tree->index);
+  free(tree->dim);
+  free(tree);
+}
@@ -0,0 +1,72 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport spatial index
+ *
+ * Description:
+ * A static k-d tree over an array of Airport structures built on
+ * unit-sphere (x, y, z) coordinates. Supports k-nearest and radius
+ * queries around an arbitrary latitude/longitude without sorting the
+ * whole array per query.
+ *
+ * Notes:
+ * - The tree stores airport indices, not copies; the Airport array must
+ *   outlive any queries against the tree.
+ * - Distances are great-circle kilometers on a sphere of radius 6371 km.
+ */
+
+#ifndef HACK13_AIRPORT_KDTREE_H
+#define HACK13_AIRPORT_KDTREE_H
+
+#include "airport.h"
+
+typedef struct {
+  double* xyz;        /* 3 * n unit-sphere coordinates in tree order */
+  int* index;         /* airport index stored at each tree slot */
+  unsigned char* dim; /* split dimension (0, 1, 2) of each tree slot */
+  int n;              /* number of airports in the tree */
+} AirportKdTree;
+
+/**
+ * Builds a balanced k-d tree over the given n airports.  Returns a
+ * newly allocated tree (caller must call freeAirportKdTree) or NULL on
+ * NULL input, n < 1 or allocation failure.
+ */
+AirportKdTree* createAirportKdTree(const Airport* airports, int n);
+
+/**
+ * Finds the k airports closest to (latitude, longitude).  Up to k
+ * airport indices are written to indices (and, when distancesKm is not
+ * NULL, their distances in kilometers) in ascending order of distance.
+ * Returns the number of results written (min(k, n)), or 0 on invalid
+ * input.
+ */
+int findNearestAirports(const AirportKdTree* tree,
+                        double latitude,
+                        double longitude,
+                        int k,
+                        int* indices,
+                        double* distancesKm);
+
+/**
+ * Finds every airport within radiusKm kilometers of
+ * (latitude, longitude).  On success *indices (and *distancesKm when
+ * not NULL) are set to newly allocated arrays sorted by ascending
+ * distance; the caller must free() them.  Returns the number of
+ * results, or -1 on invalid input or allocation failure (in which case
+ * nothing is allocated).
+ */
+int findAirportsWithinRadius(const AirportKdTree* tree,
+                             double latitude,
+                             double longitude,
+                             double radiusKm,
+                             int** indices,
+                             double** distancesKm);
+
+/**
+ * Frees the given tree and all of its arrays.  Safe to pass NULL.
+ */
+void freeAirportKdTree(AirportKdTree* tree);
+
+#endif /* HACK13_AIRPORT_KDTREE_H */
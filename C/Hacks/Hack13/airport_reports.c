@@ -0,0 +1,302 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport report engine
+ *
+ * Description:
+ * Implements the single-pass report engine declared in
+ * airport_reports.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "airport_reports.h"
+#include "geo_batch.h"
+
+/* Identifies one ordering of one candidate set. */
+typedef struct {
+  const Airport* airports;
+  int (*compare)(const void* a, const void* b);
+  const double* keys; /* distance keys, or NULL */
+} OrderContext;
+
+/* Per-spec state produced by the shared pass. */
+typedef struct {
+  int* candidates;    /* matching indices in array order */
+  int count;
+  int ownsCandidates; /* 0 when sharing the all-airports list */
+  int firstMatch;     /* REPORT_FIRST_MATCH result, -1 if none */
+  const double* keys; /* distance keys for this spec, or NULL */
+  int* sorted;        /* full ordering, shared with equivalent specs */
+  int ownsSorted;
+} SpecState;
+
+/* Total order used for every ordering: the spec key, then the original
+ * index, which makes any sort or selection behave like a stable sort. */
+static int orderLess(const OrderContext* ctx, int a, int b) {
+  int c = 0;
+  if (ctx->keys) {
+    c = (ctx->keys[a] > ctx->keys[b]) - (ctx->keys[a] < ctx->keys[b]);
+  } else if (ctx->compare) {
+    c = ctx->compare(&ctx->airports[a], &ctx->airports[b]);
+  }
+  if (c != 0) return c < 0;
+  return a < b;
+}
+
+/* Bottom-up merge sort of an index array. */
+static void sortIndices(const OrderContext* ctx, int* idx, int* scratch, int n) {
+  int* src = idx;
+  int* dst = scratch;
+  for (int width = 1; width < n; width *= 2) {
+    for (int lo = 0; lo < n; lo += 2 * width) {
+      int mid = lo + width < n ? lo + width : n;
+      int hi = lo + 2 * width < n ? lo + 2 * width : n;
+      int i = lo, j = mid, k = lo;
+      while (i < mid && j < hi) {
+        dst[k++] = orderLess(ctx, src[j], src[i]) ? src[j++] : src[i++];
+      }
+      while (i < mid) dst[k++] = src[i++];
+      while (j < hi) dst[k++] = src[j++];
+    }
+    int* t = src;
+    src = dst;
+    dst = t;
+  }
+  if (src != idx) memcpy(idx, src, sizeof(int) * n);
+}
+
+/* Rearranges idx so idx[k] holds the k-th element in order, with
+ * smaller elements before it and larger ones after (nth_element). */
+static void selectIndex(const OrderContext* ctx, int* idx, int n, int k) {
+  int lo = 0, hi = n - 1;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    /* median of three as the pivot, moved to idx[hi] */
+    if (orderLess(ctx, idx[mid], idx[lo])) { int t = idx[mid]; idx[mid] = idx[lo]; idx[lo] = t; }
+    if (orderLess(ctx, idx[hi], idx[lo])) { int t = idx[hi]; idx[hi] = idx[lo]; idx[lo] = t; }
+    if (orderLess(ctx, idx[mid], idx[hi])) { int t = idx[mid]; idx[mid] = idx[hi]; idx[hi] = t; }
+    int pivot = idx[hi];
+    int store = lo;
+    for (int i = lo; i < hi; i++) {
+      if (orderLess(ctx, idx[i], pivot)) {
+        int t = idx[i]; idx[i] = idx[store]; idx[store] = t;
+        store++;
+      }
+    }
+    idx[hi] = idx[store];
+    idx[store] = pivot;
+    if (store == k) return;
+    if (store < k) lo = store + 1; else hi = store - 1;
+  }
+}
+
+static void printAirportRow(const Airport* a) {
+  writeAirports(stdout, a, NULL, 1);
+}
+
+/* Two specs can share an ordering when they order the same candidates
+ * by the same key. */
+static int sameOrdering(const ReportSpec* a, const SpecState* sa,
+                        const ReportSpec* b, const SpecState* sb) {
+  return a->compare == b->compare && sa->keys == sb->keys &&
+         a->filter == b->filter && a->filterArg == b->filterArg;
+}
+
+static int needsFullSort(const ReportSpec* spec, const SpecState* state) {
+  return spec->kind == REPORT_SORTED &&
+         (spec->topK <= 0 || spec->topK >= state->count);
+}
+
+int runAirportReports(const Airport* airports,
+                      int n,
+                      const ReportSpec* specs,
+                      int numSpecs) {
+  if (!airports || !specs || n <= 0 || numSpecs <= 0) return 1;
+
+  /* everything is allocated before the first report is printed */
+  SpecState* states = calloc(numSpecs, sizeof(SpecState));
+  int* all = malloc(sizeof(int) * n);
+  int* scratch = malloc(sizeof(int) * n);
+  int* work = malloc(sizeof(int) * n);
+  double** keySets = calloc(numSpecs, sizeof(double*));
+  const double** keyOrigins = calloc(numSpecs, sizeof(double*));
+  if (!states || !all || !scratch || !work || !keySets || !keyOrigins) {
+    free(states);
+    free(all);
+    free(scratch);
+    free(work);
+    free(keySets);
+    free(keyOrigins);
+    return 0;
+  }
+  for (int i = 0; i < n; i++) all[i] = i;
+
+  /* set up candidate lists and one distance key array per distinct origin */
+  int numKeySets = 0;
+  int failed = 0;
+  for (int s = 0; s < numSpecs && !failed; s++) {
+    const ReportSpec* spec = &specs[s];
+    SpecState* st = &states[s];
+    st->firstMatch = -1;
+    if (spec->filter && spec->kind != REPORT_FIRST_MATCH) {
+      st->candidates = malloc(sizeof(int) * n);
+      st->ownsCandidates = 1;
+      if (!st->candidates) failed = 1;
+    } else if (!spec->filter) {
+      st->candidates = all;
+      st->count = n;
+    }
+    if (spec->origin && spec->kind != REPORT_FIRST_MATCH) {
+      int k = 0;
+      while (k < numKeySets && (keyOrigins[k][0] != spec->origin[0] ||
+                                keyOrigins[k][1] != spec->origin[1])) {
+        k++;
+      }
+      if (k == numKeySets) {
+        keyOrigins[k] = spec->origin;
+        keySets[k] = malloc(sizeof(double) * n);
+        if (!keySets[k]) failed = 1;
+        numKeySets++;
+      }
+      st->keys = keySets[k];
+    }
+  }
+
+  /* distance keys come from the batch kernel over gathered coordinates */
+  if (!failed && numKeySets > 0) {
+    double* lats = malloc(sizeof(double) * n);
+    double* lons = malloc(sizeof(double) * n);
+    if (lats && lons) {
+      for (int i = 0; i < n; i++) {
+        lats[i] = airports[i].latitude;
+        lons[i] = airports[i].longitude;
+      }
+      for (int k = 0; k < numKeySets; k++) {
+        airDistanceMany(keyOrigins[k][0], keyOrigins[k][1], lats, lons, keySets[k], n);
+      }
+    } else {
+      failed = 1;
+    }
+    free(lats);
+    free(lons);
+  }
+
+  /* the shared pass: every filter, one airport at a time */
+  if (!failed) {
+    for (int i = 0; i < n; i++) {
+      const Airport* a = &airports[i];
+      for (int s = 0; s < numSpecs; s++) {
+        const ReportSpec* spec = &specs[s];
+        SpecState* st = &states[s];
+        if (spec->kind == REPORT_FIRST_MATCH) {
+          if (st->firstMatch < 0 &&
+              (!spec->filter || spec->filter(a, spec->filterArg))) {
+            st->firstMatch = i;
+          }
+        } else if (spec->filter && spec->filter(a, spec->filterArg)) {
+          st->candidates[st->count++] = i;
+        }
+      }
+    }
+  }
+
+  /* full sorts, computed once per distinct ordering */
+  for (int s = 0; s < numSpecs && !failed; s++) {
+    if (!needsFullSort(&specs[s], &states[s]) || states[s].sorted) continue;
+    int* sorted = malloc(sizeof(int) * (states[s].count ? states[s].count : 1));
+    if (!sorted) {
+      failed = 1;
+      break;
+    }
+    OrderContext ctx = { airports, specs[s].compare, states[s].keys };
+    memcpy(sorted, states[s].candidates, sizeof(int) * states[s].count);
+    sortIndices(&ctx, sorted, scratch, states[s].count);
+    states[s].sorted = sorted;
+    states[s].ownsSorted = 1;
+    for (int t = 0; t < numSpecs; t++) {
+      if (t != s && specs[t].kind != REPORT_FIRST_MATCH && !states[t].sorted &&
+          sameOrdering(&specs[s], &states[s], &specs[t], &states[t])) {
+        states[t].sorted = sorted;
+      }
+    }
+  }
+
+  for (int s = 0; s < numSpecs && !failed; s++) {
+    const ReportSpec* spec = &specs[s];
+    SpecState* st = &states[s];
+    OrderContext ctx = { airports, spec->compare, st->keys };
+
+    printf("%s%s: \n", s > 0 ? "\n" : "", spec->title);
+    printf("==============================\n");
+
+    int count = spec->kind == REPORT_FIRST_MATCH ? (st->firstMatch >= 0) : st->count;
+    if (count == 0) {
+      if (spec->emptyMessage) printf("%s\n", spec->emptyMessage);
+      continue;
+    }
+
+    switch (spec->kind) {
+      case REPORT_SORTED: {
+        int rows = spec->topK > 0 && spec->topK < count ? spec->topK : count;
+        if (st->sorted) {
+          writeAirports(stdout, airports, st->sorted, rows);
+        } else {
+          /* top-k: select the k-th, then sort only the prefix */
+          memcpy(work, st->candidates, sizeof(int) * count);
+          selectIndex(&ctx, work, count, rows - 1);
+          sortIndices(&ctx, work, scratch, rows);
+          writeAirports(stdout, airports, work, rows);
+        }
+        break;
+      }
+      case REPORT_MIN:
+      case REPORT_MAX: {
+        int best;
+        if (st->sorted) {
+          best = st->sorted[spec->kind == REPORT_MIN ? 0 : count - 1];
+        } else {
+          best = st->candidates[0];
+          for (int i = 1; i < count; i++) {
+            int c = st->candidates[i];
+            if (spec->kind == REPORT_MIN ? orderLess(&ctx, c, best)
+                                         : orderLess(&ctx, best, c)) {
+              best = c;
+            }
+          }
+        }
+        printAirportRow(&airports[best]);
+        break;
+      }
+      case REPORT_MEDIAN: {
+        if (st->sorted) {
+          printAirportRow(&airports[st->sorted[count / 2]]);
+        } else {
+          memcpy(scratch, st->candidates, sizeof(int) * count);
+          selectIndex(&ctx, scratch, count, count / 2);
+          printAirportRow(&airports[scratch[count / 2]]);
+        }
+        break;
+      }
+      case REPORT_FIRST_MATCH:
+        printAirportRow(&airports[st->firstMatch]);
+        break;
+    }
+  }
+
+  for (int s = 0; s < numSpecs; s++) {
+    if (states[s].ownsCandidates) free(states[s].candidates);
+    if (states[s].ownsSorted) free(states[s].sorted);
+  }
+  for (int k = 0; k < numKeySets; k++) free(keySets[k]);
+  free(keyOrigins);
+  free(keySets);
+  free(scratch);
+  free(work);
+  free(all);
+  free(states);
+  return !failed;
+}
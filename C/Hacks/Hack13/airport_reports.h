@@ -0,0 +1,69 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport report engine
+ *
+ * Description:
+ * A report engine that evaluates a list of report specifications
+ * (ordering key, top-k, filter predicate) over an Airport array.  Keys
+ * and filters are computed in one shared pass, orderings are index
+ * permutations rather than struct copies, and min/max/median reports
+ * use linear scans or partial selection instead of a full sort.
+ *
+ * Notes:
+ * - The airport array is never modified or copied.
+ * - Orderings are stable: airports that compare equal keep their
+ *   original relative order, matching a stable sort of the array.
+ */
+
+#ifndef HACK13_AIRPORT_REPORTS_H
+#define HACK13_AIRPORT_REPORTS_H
+
+#include "airport.h"
+
+/**
+ * What a report prints.
+ */
+typedef enum {
+  REPORT_SORTED,     /* every matching airport (or the first topK) in key order */
+  REPORT_MIN,        /* the first airport in key order */
+  REPORT_MAX,        /* the last airport in key order */
+  REPORT_MEDIAN,     /* the airport at position count / 2 in key order */
+  REPORT_FIRST_MATCH /* the first matching airport in array order */
+} ReportKind;
+
+/**
+ * A filter predicate; returns non-zero when the airport belongs in the
+ * report.  arg is the spec's filterArg.
+ */
+typedef int (*AirportFilter)(const Airport* a, const void* arg);
+
+/**
+ * Describes a single report.  The ordering key is either a distance
+ * from origin (when origin is not NULL; origin[0] is the latitude and
+ * origin[1] the longitude) or the qsort-style Airport comparator
+ * compare.  With neither, airports stay in array order.
+ */
+typedef struct {
+  const char* title;            /* heading printed above the report */
+  ReportKind kind;
+  int (*compare)(const void* a, const void* b);
+  const double* origin;         /* distance key origin, or NULL */
+  int topK;                     /* REPORT_SORTED: rows to print, <= 0 for all */
+  AirportFilter filter;         /* NULL keeps every airport */
+  const void* filterArg;
+  const char* emptyMessage;     /* printed when no airport matches */
+} ReportSpec;
+
+/**
+ * Runs the given reports over the n airports and prints them in spec
+ * order, each under its title.  Does nothing on NULL input or n <= 0.
+ * Returns 1 on success, or 0 (with nothing printed) if memory ran out.
+ */
+int runAirportReports(const Airport* airports,
+                      int n,
+                      const ReportSpec* specs,
+                      int numSpecs);
+
+#endif /* HACK13_AIRPORT_REPORTS_H */
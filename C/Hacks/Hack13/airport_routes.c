@@ -0,0 +1,407 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Distance matrix and route optimizer
+ *
+ * Description:
+ * Implements the tiled, multi-threaded distance matrix and the
+ * Held-Karp / 2-opt / Or-opt route optimizer declared in
+ * airport_routes.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <float.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "airport_routes.h"
+#include "geo_batch.h"
+
+/* Rows and columns per matrix tile: a 64 x 64 tile of doubles (32 KB)
+ * stays in L1/L2 while it is filled and mirrored. */
+#define MATRIX_TILE 64
+
+/* Improvements smaller than this (in km) are treated as ties so the
+ * local search cannot cycle on rounding noise. */
+#define ROUTE_EPSILON 1e-9
+
+/* Upper bound on improvement sweeps of the local search. */
+#define ROUTE_MAX_PASSES 1000
+
+/* Longest segment Or-opt tries to move. */
+#define OR_OPT_MAX_SEGMENT 3
+
+typedef struct {
+  const double* lats;
+  const double* lons;
+  double* matrix;
+  int n;
+  int numBlocks;
+  int nextBlockRow;      /* next block row to hand out */
+  pthread_mutex_t lock;
+} MatrixJob;
+
+/* Fills tile (bi, bj) of the upper triangle and mirrors it below the
+ * diagonal. */
+static void fillTile(MatrixJob* job, int bi, int bj) {
+  int n = job->n;
+  int i0 = bi * MATRIX_TILE;
+  int i1 = i0 + MATRIX_TILE < n ? i0 + MATRIX_TILE : n;
+  int j0 = bj * MATRIX_TILE;
+  int j1 = j0 + MATRIX_TILE < n ? j0 + MATRIX_TILE : n;
+  double* m = job->matrix;
+
+  for (int i = i0; i < i1; i++) {
+    int js = bi == bj ? i + 1 : j0;
+    if (js < j1) {
+      airDistanceMany(job->lats[i], job->lons[i], job->lats + js, job->lons + js,
+                      m + (size_t)i * n + js, (size_t)(j1 - js));
+    }
+    if (bi == bj) m[(size_t)i * n + i] = 0.0;
+  }
+  /* mirror with contiguous writes; the strided reads hit the tile just
+   * written, which is still in cache */
+  for (int j = j0; j < j1; j++) {
+    int ie = bi == bj ? j : i1;
+    for (int i = i0; i < ie; i++) {
+      m[(size_t)j * n + i] = m[(size_t)i * n + j];
+    }
+  }
+}
+
+/* Worker loop: block rows are handed out one at a time, the longest
+ * (top) rows first, so threads finish close together. */
+static void* matrixWorker(void* arg) {
+  MatrixJob* job = arg;
+  for (;;) {
+    pthread_mutex_lock(&job->lock);
+    int bi = job->nextBlockRow++;
+    pthread_mutex_unlock(&job->lock);
+    if (bi >= job->numBlocks) break;
+    for (int bj = bi; bj < job->numBlocks; bj++) fillTile(job, bi, bj);
+  }
+  return NULL;
+}
+
+double* createDistanceMatrix(const Airport* airports, int n, int numThreads) {
+  if (!airports || n <= 0) return NULL;
+
+  double* matrix = malloc(sizeof(double) * (size_t)n * n);
+  double* lats = malloc(sizeof(double) * n);
+  double* lons = malloc(sizeof(double) * n);
+  if (!matrix || !lats || !lons) {
+    free(matrix);
+    free(lats);
+    free(lons);
+    return NULL;
+  }
+  for (int i = 0; i < n; i++) {
+    lats[i] = airports[i].latitude;
+    lons[i] = airports[i].longitude;
+  }
+
+  MatrixJob job;
+  job.lats = lats;
+  job.lons = lons;
+  job.matrix = matrix;
+  job.n = n;
+  job.numBlocks = (n + MATRIX_TILE - 1) / MATRIX_TILE;
+  job.nextBlockRow = 0;
+  pthread_mutex_init(&job.lock, NULL);
+
+  if (numThreads <= 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    numThreads = cpus > 0 ? (int)cpus : 1;
+  }
+  if (numThreads > job.numBlocks) numThreads = job.numBlocks;
+
+  /* the calling thread is worker 0; if a thread cannot be started the
+   * remaining workers simply take more block rows */
+  pthread_t* threads = NULL;
+  int started = 0;
+  if (numThreads > 1) {
+    threads = malloc(sizeof(pthread_t) * (numThreads - 1));
+    for (int t = 0; threads && t < numThreads - 1; t++) {
+      if (pthread_create(&threads[t], NULL, matrixWorker, &job) != 0) break;
+      started++;
+    }
+  }
+  matrixWorker(&job);
+  for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+
+  free(threads);
+  pthread_mutex_destroy(&job.lock);
+  free(lats);
+  free(lons);
+  return matrix;
+}
+
+/* Distance between two stops through the route's matrix. */
+#define DIST(d, size, a, b) ((d)[(size_t)(a) * (size) + (b)])
+
+/*
+ * Held-Karp: dp[mask][j] is the shortest path that leaves the origin,
+ * visits exactly the free stops in mask and ends at free stop j.  end
+ * is the fixed final stop, or -1 when the route may end anywhere.
+ * Returns 0 on allocation failure.
+ */
+static int solveExact(const double* d, int size, int end, int* route, int length) {
+  int freeStops[ROUTE_EXACT_MAX_STOPS];
+  int m = 0;
+  for (int v = 1; v < size; v++) {
+    if (v != end) freeStops[m++] = v;
+  }
+  route[0] = 0;
+  if (end >= 0) route[length - 1] = end;
+  if (m == 0) return 1;
+
+  size_t states = (size_t)1 << m;
+  double* dp = malloc(sizeof(double) * states * m);
+  unsigned char* parent = malloc(states * m);
+  if (!dp || !parent) {
+    free(dp);
+    free(parent);
+    return 0;
+  }
+
+  for (size_t mask = 1; mask < states; mask++) {
+    for (int j = 0; j < m; j++) {
+      if (!(mask & ((size_t)1 << j))) continue;
+      size_t prev = mask ^ ((size_t)1 << j);
+      size_t cell = mask * m + j;
+      if (prev == 0) {
+        dp[cell] = DIST(d, size, 0, freeStops[j]);
+        parent[cell] = (unsigned char)j;
+        continue;
+      }
+      double best = DBL_MAX;
+      int bestK = 0;
+      for (int k = 0; k < m; k++) {
+        if (!(prev & ((size_t)1 << k))) continue;
+        double c = dp[prev * m + k] + DIST(d, size, freeStops[k], freeStops[j]);
+        if (c < best) {
+          best = c;
+          bestK = k;
+        }
+      }
+      dp[cell] = best;
+      parent[cell] = (unsigned char)bestK;
+    }
+  }
+
+  size_t full = states - 1;
+  double best = DBL_MAX;
+  int j = 0;
+  for (int k = 0; k < m; k++) {
+    double c = dp[full * m + k] + (end >= 0 ? DIST(d, size, freeStops[k], end) : 0.0);
+    if (c < best) {
+      best = c;
+      j = k;
+    }
+  }
+  size_t mask = full;
+  for (int pos = m; pos >= 1; pos--) {
+    route[pos] = freeStops[j];
+    int k = parent[mask * m + j];
+    mask ^= (size_t)1 << j;
+    j = k;
+  }
+
+  free(dp);
+  free(parent);
+  return 1;
+}
+
+/* Greedy starting tour: always fly to the closest unvisited stop. */
+static int nearestNeighborRoute(const double* d, int size, int end, int* route, int length) {
+  char* visited = calloc(size, 1);
+  if (!visited) return 0;
+  route[0] = 0;
+  visited[0] = 1;
+  if (end >= 0) {
+    visited[end] = 1;
+    route[length - 1] = end;
+  }
+  int last = end >= 0 ? length - 2 : length - 1;
+  for (int pos = 1; pos <= last; pos++) {
+    int from = route[pos - 1];
+    int best = -1;
+    for (int v = 0; v < size; v++) {
+      if (!visited[v] && (best < 0 || DIST(d, size, from, v) < DIST(d, size, from, best))) {
+        best = v;
+      }
+    }
+    route[pos] = best;
+    visited[best] = 1;
+  }
+  free(visited);
+  return 1;
+}
+
+static void reverseSegment(int* route, int i, int j) {
+  while (i < j) {
+    int t = route[i];
+    route[i++] = route[j];
+    route[j--] = t;
+  }
+}
+
+/* One sweep of 2-opt: reversing route[i+1 .. j] replaces legs (a, b)
+ * and (c, e) with (a, c) and (b, e).  Positions after lastMovable are
+ * fixed. */
+static int twoOptPass(const double* d, int size, int* route, int length, int lastMovable) {
+  int improved = 0;
+  for (int i = 0; i + 2 <= lastMovable; i++) {
+    int a = route[i];
+    for (int j = i + 2; j <= lastMovable; j++) {
+      int b = route[i + 1];
+      int c = route[j];
+      double delta = DIST(d, size, a, c) - DIST(d, size, a, b);
+      if (j + 1 < length) {
+        int e = route[j + 1];
+        delta += DIST(d, size, b, e) - DIST(d, size, c, e);
+      }
+      if (delta < -ROUTE_EPSILON) {
+        reverseSegment(route, i + 1, j);
+        improved = 1;
+      }
+    }
+  }
+  return improved;
+}
+
+/* One sweep of Or-opt: moves segments of 1 to OR_OPT_MAX_SEGMENT stops,
+ * optionally reversed, to the cheapest other position in the route. */
+static int orOptPass(const double* d, int size, int* route, int length,
+                     int lastMovable, int* scratch) {
+  int improved = 0;
+  for (int segLen = 1; segLen <= OR_OPT_MAX_SEGMENT; segLen++) {
+    for (int s = 1; s + segLen - 1 <= lastMovable; s++) {
+      int e = s + segLen - 1;
+      int first = route[s];
+      int last = route[e];
+      int prev = route[s - 1];
+      double removeGain = DIST(d, size, prev, first);
+      if (e + 1 < length) {
+        int next = route[e + 1];
+        removeGain += DIST(d, size, last, next) - DIST(d, size, prev, next);
+      }
+
+      double bestDelta = -ROUTE_EPSILON;
+      int bestP = -1;
+      int bestReversed = 0;
+      for (int p = 0; p <= lastMovable; p++) {
+        if (p >= s - 1 && p <= e) continue;
+        int u = route[p];
+        double forward = DIST(d, size, u, first);
+        double reversed = DIST(d, size, u, last);
+        if (p + 1 < length) {
+          int v = route[p + 1];
+          double uv = DIST(d, size, u, v);
+          forward += DIST(d, size, last, v) - uv;
+          reversed += DIST(d, size, first, v) - uv;
+        }
+        if (forward - removeGain < bestDelta) {
+          bestDelta = forward - removeGain;
+          bestP = p;
+          bestReversed = 0;
+        }
+        if (segLen > 1 && reversed - removeGain < bestDelta) {
+          bestDelta = reversed - removeGain;
+          bestP = p;
+          bestReversed = 1;
+        }
+      }
+      if (bestP < 0) continue;
+
+      /* rebuild the route with the segment after position bestP */
+      int k = 0;
+      for (int i = 0; i < length; i++) {
+        if (i >= s && i <= e) continue;
+        scratch[k++] = route[i];
+        if (i == bestP) {
+          for (int t = 0; t < segLen; t++) {
+            scratch[k++] = route[bestReversed ? e - t : s + t];
+          }
+        }
+      }
+      memcpy(route, scratch, sizeof(int) * length);
+      improved = 1;
+    }
+  }
+  return improved;
+}
+
+static int solveHeuristic(const double* d, int size, int end, int* route, int length) {
+  int* scratch = malloc(sizeof(int) * length);
+  if (!scratch || !nearestNeighborRoute(d, size, end, route, length)) {
+    free(scratch);
+    return 0;
+  }
+  int lastMovable = end >= 0 ? length - 2 : length - 1;
+  for (int pass = 0; pass < ROUTE_MAX_PASSES; pass++) {
+    int improved = twoOptPass(d, size, route, length, lastMovable);
+    improved |= orOptPass(d, size, route, length, lastMovable, scratch);
+    if (!improved) break;
+  }
+  free(scratch);
+  return 1;
+}
+
+double optimizeRoute(const Airport* stops,
+                     int size,
+                     RouteShape shape,
+                     double aveKmsPerHour,
+                     double aveLayoverTimeHrs,
+                     int* order) {
+  if (!stops || !order || size < 1 || aveKmsPerHour <= 0.0) return -1.0;
+
+  /* a round trip is a path whose fixed last stop is the origin again */
+  int end = shape == ROUTE_OPEN_END ? -1 : shape == ROUTE_FIXED_END ? size - 1 : 0;
+  int length = shape == ROUTE_ROUND_TRIP ? size + 1 : size;
+  if (size == 1) end = shape == ROUTE_ROUND_TRIP ? 0 : -1;
+
+  int* route = malloc(sizeof(int) * length);
+  double* d = NULL;
+  if (route && size <= ROUTE_EXACT_MAX_STOPS) {
+    /* small matrices use the exact scalar distance */
+    d = malloc(sizeof(double) * size * size);
+    for (int i = 0; d && i < size; i++) {
+      for (int j = 0; j < size; j++) {
+        DIST(d, size, i, j) = getAirDistance(&stops[i], &stops[j]);
+      }
+    }
+  } else if (route) {
+    d = createDistanceMatrix(stops, size, 0);
+  }
+  int ok = route && d;
+  if (ok) {
+    ok = size <= ROUTE_EXACT_MAX_STOPS ? solveExact(d, size, end, route, length)
+                                       : solveHeuristic(d, size, end, route, length);
+    /* without memory for the exact tables, fall back to the heuristic */
+    if (!ok && size <= ROUTE_EXACT_MAX_STOPS) ok = solveHeuristic(d, size, end, route, length);
+  }
+  if (!ok) {
+    free(route);
+    free(d);
+    return -1.0;
+  }
+
+  /* the same arithmetic as getEstimatedTravelTime over the new order */
+  double totalHours = 0.0;
+  for (int i = 0; i < length - 1; i++) {
+    totalHours += getAirDistance(&stops[route[i]], &stops[route[i + 1]]) / aveKmsPerHour;
+  }
+  if (length > 2 && aveLayoverTimeHrs > 0.0) {
+    totalHours += (length - 2) * aveLayoverTimeHrs;
+  }
+  memcpy(order, route, sizeof(int) * size);
+
+  free(route);
+  free(d);
+  return totalHours;
+}
@@ -0,0 +1,69 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Distance matrix and route optimizer
+ *
+ * Description:
+ * Builds all-pairs air distance matrices for Airport arrays and finds
+ * the cheapest visiting order of a set of stops under the same cost
+ * model as getEstimatedTravelTime (flight time at an average speed
+ * plus an average layover per intermediate stop).
+ *
+ * Notes:
+ * - Matrices are row-major n x n arrays of kilometers: entry
+ *   [i * n + j] is the distance from airports[i] to airports[j].  The
+ *   caller is responsible for calling free() on them.
+ * - Routes of up to ROUTE_EXACT_MAX_STOPS stops are solved exactly
+ *   with Held-Karp dynamic programming; longer routes start from a
+ *   nearest-neighbor tour improved with 2-opt and Or-opt moves, which
+ *   is fast but not guaranteed optimal.
+ */
+
+#ifndef HACK13_AIRPORT_ROUTES_H
+#define HACK13_AIRPORT_ROUTES_H
+
+#include "airport.h"
+
+/* Largest stop count solved exactly (Held-Karp needs ~2^(n-1) * n doubles). */
+#define ROUTE_EXACT_MAX_STOPS 20
+
+/**
+ * Which stops of a route are fixed.  The first stop is always the
+ * origin.
+ */
+typedef enum {
+  ROUTE_OPEN_END,   /* end at whichever stop is cheapest */
+  ROUTE_FIXED_END,  /* the last stop stays the destination */
+  ROUTE_ROUND_TRIP  /* return to the origin after the last stop */
+} RouteShape;
+
+/**
+ * Creates the n x n air distance matrix of the given airports.  The
+ * matrix is filled in cache-sized tiles of its upper triangle, each
+ * row of a tile computed with the batch distance kernel, and mirrored
+ * into the lower triangle; tiles are spread over numThreads threads
+ * (<= 0 uses one per online CPU).  Entries agree with getAirDistance
+ * to within 1 meter and the diagonal is exactly 0.  Returns NULL on
+ * invalid input or allocation failure.
+ */
+double* createDistanceMatrix(const Airport* airports, int n, int numThreads);
+
+/**
+ * Finds the cheapest order in which to visit the size stops, starting
+ * at stops[0], under the given shape.  order receives the size stop
+ * indices in visiting order (order[0] == 0; for ROUTE_FIXED_END
+ * order[size-1] == size-1; a round trip's return to the origin is
+ * implied, not stored).  Returns the estimated travel time in hours of
+ * that order, computed as getEstimatedTravelTime would for the
+ * reordered stops (with the origin appended for a round trip), or -1.0
+ * on invalid input or allocation failure.
+ */
+double optimizeRoute(const Airport* stops,
+                     int size,
+                     RouteShape shape,
+                     double aveKmsPerHour,
+                     double aveLayoverTimeHrs,
+                     int* order);
+
+#endif /* HACK13_AIRPORT_ROUTES_H */
@@ -0,0 +1,214 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Columnar airport table
+ *
+ * Description:
+ * Implements the single-allocation, struct-of-arrays AirportTable
+ * declared in airport_table.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "airport_table.h"
+#include "geo_batch.h"
+
+/* Intern hash tables are kept at most half full. */
+#define INTERN_SLOTS (2 * AIRPORT_TABLE_MAX_CODES)
+
+static size_t alignUp(size_t n) {
+  return (n + 7) & ~(size_t)7;
+}
+
+AirportTable* createAirportTable(int capacity, size_t stringBytes) {
+  if (capacity < 1) return NULL;
+  if (stringBytes == 0) stringBytes = (size_t)capacity * 48;
+  /* offset 0 is reserved for the shared empty string */
+  stringBytes += 1;
+  if (stringBytes > 0xFFFFFFFFu) return NULL;
+
+  size_t n = (size_t)capacity;
+  size_t offsets[13];
+  size_t total = alignUp(sizeof(AirportTable));
+  size_t sizes[13] = {
+    n * sizeof(double), n * sizeof(double), n * sizeof(int),
+    n * sizeof(unsigned short), n * sizeof(unsigned short),
+    n * sizeof(unsigned int), n * sizeof(unsigned int), n * sizeof(unsigned int),
+    AIRPORT_TABLE_MAX_CODES * sizeof(unsigned int),
+    AIRPORT_TABLE_MAX_CODES * sizeof(unsigned int),
+    INTERN_SLOTS * sizeof(unsigned short),
+    INTERN_SLOTS * sizeof(unsigned short),
+    stringBytes
+  };
+  for (int i = 0; i < 13; i++) {
+    offsets[i] = total;
+    total += alignUp(sizes[i]);
+  }
+
+  char* block = malloc(total);
+  if (!block) return NULL;
+
+  AirportTable* table = (AirportTable*)block;
+  table->size = 0;
+  table->capacity = capacity;
+  table->latitude = (double*)(block + offsets[0]);
+  table->longitude = (double*)(block + offsets[1]);
+  table->elevationFeet = (int*)(block + offsets[2]);
+  table->typeCode = (unsigned short*)(block + offsets[3]);
+  table->countryCode = (unsigned short*)(block + offsets[4]);
+  table->gpsIdOffset = (unsigned int*)(block + offsets[5]);
+  table->nameOffset = (unsigned int*)(block + offsets[6]);
+  table->cityOffset = (unsigned int*)(block + offsets[7]);
+  table->numTypes = 0;
+  table->numCountries = 0;
+  table->typeNames = (unsigned int*)(block + offsets[8]);
+  table->countryNames = (unsigned int*)(block + offsets[9]);
+  table->typeSlots = (unsigned short*)(block + offsets[10]);
+  table->countrySlots = (unsigned short*)(block + offsets[11]);
+  table->strings = block + offsets[12];
+  table->stringsCapacity = stringBytes;
+
+  memset(table->typeSlots, 0, INTERN_SLOTS * sizeof(unsigned short));
+  memset(table->countrySlots, 0, INTERN_SLOTS * sizeof(unsigned short));
+  table->strings[0] = '\0';
+  table->stringsUsed = 1;
+  return table;
+}
+
+/* Copies str into the arena and returns its offset, or -1 when full. */
+static long arenaCopy(AirportTable* table, const char* str) {
+  if (!str || !*str) return 0;
+  size_t len = strlen(str) + 1;
+  if (table->stringsUsed + len > table->stringsCapacity) return -1;
+  long offset = (long)table->stringsUsed;
+  memcpy(table->strings + table->stringsUsed, str, len);
+  table->stringsUsed += len;
+  return offset;
+}
+
+static unsigned int hashString(const char* str) {
+  unsigned int h = 2166136261u;
+  for (; *str; str++) {
+    h ^= (unsigned char)*str;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+/* Looks up str in an intern dictionary.  Returns the slot holding it or
+ * the empty slot where it belongs. */
+static unsigned int findSlot(const AirportTable* table,
+                             const unsigned short* slots,
+                             const unsigned int* names,
+                             const char* str) {
+  unsigned int slot = hashString(str) & (INTERN_SLOTS - 1);
+  while (slots[slot] != 0 &&
+         strcmp(table->strings + names[slots[slot] - 1], str) != 0) {
+    slot = (slot + 1) & (INTERN_SLOTS - 1);
+  }
+  return slot;
+}
+
+static int intern(AirportTable* table,
+                  unsigned short* slots,
+                  unsigned int* names,
+                  int* count,
+                  const char* str) {
+  if (!str) str = "";
+  unsigned int slot = findSlot(table, slots, names, str);
+  if (slots[slot] != 0) return slots[slot] - 1;
+  if (*count >= AIRPORT_TABLE_MAX_CODES) return -1;
+
+  long offset = arenaCopy(table, str);
+  if (offset < 0) return -1;
+  names[*count] = (unsigned int)offset;
+  slots[slot] = (unsigned short)(*count + 1);
+  return (*count)++;
+}
+
+int airportTableAdd(AirportTable* table,
+                    const char* gpsId,
+                    const char* type,
+                    const char* name,
+                    double latitude,
+                    double longitude,
+                    int elevationFeet,
+                    const char* city,
+                    const char* countryAbbrv) {
+  if (!table || table->size >= table->capacity) return -1;
+
+  int typeCode = intern(table, table->typeSlots, table->typeNames,
+                        &table->numTypes, type);
+  int countryCode = intern(table, table->countrySlots, table->countryNames,
+                           &table->numCountries, countryAbbrv);
+  if (typeCode < 0 || countryCode < 0) return -1;
+
+  size_t mark = table->stringsUsed;
+  long gpsIdOffset = arenaCopy(table, gpsId);
+  long nameOffset = gpsIdOffset < 0 ? -1 : arenaCopy(table, name);
+  long cityOffset = nameOffset < 0 ? -1 : arenaCopy(table, city);
+  if (cityOffset < 0) {
+    table->stringsUsed = mark;
+    return -1;
+  }
+
+  int row = table->size++;
+  table->latitude[row] = latitude;
+  table->longitude[row] = longitude;
+  table->elevationFeet[row] = elevationFeet;
+  table->typeCode[row] = (unsigned short)typeCode;
+  table->countryCode[row] = (unsigned short)countryCode;
+  table->gpsIdOffset[row] = (unsigned int)gpsIdOffset;
+  table->nameOffset[row] = (unsigned int)nameOffset;
+  table->cityOffset[row] = (unsigned int)cityOffset;
+  return row;
+}
+
+void airportTableView(const AirportTable* table, int row, Airport* view) {
+  if (!table || !view || row < 0 || row >= table->size) return;
+  char* arena = table->strings;
+  view->gpsId = arena + table->gpsIdOffset[row];
+  view->type = arena + table->typeNames[table->typeCode[row]];
+  view->name = arena + table->nameOffset[row];
+  view->latitude = table->latitude[row];
+  view->longitude = table->longitude[row];
+  view->elevationFeet = table->elevationFeet[row];
+  view->city = arena + table->cityOffset[row];
+  view->countryAbbrv = arena + table->countryNames[table->countryCode[row]];
+}
+
+int airportTableViews(const AirportTable* table, Airport* views) {
+  if (!table || !views) return 0;
+  for (int i = 0; i < table->size; i++) {
+    airportTableView(table, i, &views[i]);
+  }
+  return table->size;
+}
+
+int airportTableTypeCode(const AirportTable* table, const char* type) {
+  if (!table || !type) return -1;
+  unsigned int slot = findSlot(table, table->typeSlots, table->typeNames, type);
+  return table->typeSlots[slot] - 1;
+}
+
+int airportTableCountryCode(const AirportTable* table, const char* countryAbbrv) {
+  if (!table || !countryAbbrv) return -1;
+  unsigned int slot = findSlot(table, table->countrySlots, table->countryNames,
+                               countryAbbrv);
+  return table->countrySlots[slot] - 1;
+}
+
+void airportTableDistances(const AirportTable* table,
+                           double latitude,
+                           double longitude,
+                           double* outKm) {
+  if (!table || !outKm) return;
+  airDistanceMany(latitude, longitude, table->latitude, table->longitude,
+                  outKm, (size_t)table->size);
+}
+
+void freeAirportTable(AirportTable* table) {
+  free(table);
+}
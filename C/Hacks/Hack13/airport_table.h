@@ -0,0 +1,119 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Columnar airport table
+ *
+ * Description:
+ * An AirportTable stores a catalog of airports as contiguous columns:
+ * latitude, longitude and elevation arrays, small integer codes for the
+ * interned type and country strings, and offsets into a single string
+ * arena for the GPS id, name and city.  The whole table, including the
+ * string arena, lives in one allocation.
+ *
+ * Notes:
+ * - Airport "views" produced by airportTableView point into the table's
+ *   arena; they must not be modified or freed and are only valid while
+ *   the table is alive.
+ * - NULL strings are stored as empty strings.
+ */
+
+#ifndef HACK13_AIRPORT_TABLE_H
+#define HACK13_AIRPORT_TABLE_H
+
+#include <stddef.h>
+
+#include "airport.h"
+
+/* Maximum number of distinct interned type or country strings. */
+#define AIRPORT_TABLE_MAX_CODES 1024
+
+typedef struct {
+  int size;                    /* rows currently stored */
+  int capacity;                /* maximum number of rows */
+  double* latitude;            /* latitude column, degrees */
+  double* longitude;           /* longitude column, degrees */
+  int* elevationFeet;          /* elevation column, feet */
+  unsigned short* typeCode;    /* interned type code per row */
+  unsigned short* countryCode; /* interned country code per row */
+  unsigned int* gpsIdOffset;   /* arena offset of each GPS id */
+  unsigned int* nameOffset;    /* arena offset of each name */
+  unsigned int* cityOffset;    /* arena offset of each city */
+  int numTypes;                /* distinct type strings interned */
+  int numCountries;            /* distinct country strings interned */
+  unsigned int* typeNames;     /* arena offset of each type code */
+  unsigned int* countryNames;  /* arena offset of each country code */
+  unsigned short* typeSlots;   /* open-addressing intern table (code + 1) */
+  unsigned short* countrySlots;
+  char* strings;               /* string arena */
+  size_t stringsUsed;          /* bytes of the arena in use */
+  size_t stringsCapacity;      /* total bytes in the arena */
+} AirportTable;
+
+/**
+ * Creates an empty table able to hold capacity rows and stringBytes
+ * bytes of name/id/city text (0 picks a default of 48 bytes per row).
+ * The table and all of its columns come from a single malloc; release
+ * it with freeAirportTable.  Returns NULL on invalid input or
+ * allocation failure.
+ */
+AirportTable* createAirportTable(int capacity, size_t stringBytes);
+
+/**
+ * Appends an airport to the table, copying its strings into the arena
+ * and interning type and countryAbbrv.  Returns the new row index, or
+ * -1 if the table, its arena or its code dictionaries are full.
+ */
+int airportTableAdd(AirportTable* table,
+                    const char* gpsId,
+                    const char* type,
+                    const char* name,
+                    double latitude,
+                    double longitude,
+                    int elevationFeet,
+                    const char* city,
+                    const char* countryAbbrv);
+
+/**
+ * Fills view with the fields of the given row so existing Airport
+ * functions (airportToString, getAirDistance, the comparators, ...)
+ * can run over the table.  Does nothing on NULL input or an invalid
+ * row.
+ */
+void airportTableView(const AirportTable* table, int row, Airport* view);
+
+/**
+ * Fills views[0 .. size-1] with a view of every row and returns the
+ * number of rows written.  views must hold table->size elements.
+ */
+int airportTableViews(const AirportTable* table, Airport* views);
+
+/**
+ * Returns the interned code of the given type string, or -1 if no row
+ * uses it.  Comparing codes avoids a strcmp per row when filtering.
+ */
+int airportTableTypeCode(const AirportTable* table, const char* type);
+
+/**
+ * Returns the interned code of the given country abbreviation, or -1
+ * if no row uses it.
+ */
+int airportTableCountryCode(const AirportTable* table, const char* countryAbbrv);
+
+/**
+ * Writes the air distance in kilometers from (latitude, longitude) to
+ * every row of the table into outKm (table->size elements), running
+ * the vectorized airDistanceMany kernel straight over the coordinate
+ * columns.
+ */
+void airportTableDistances(const AirportTable* table,
+                           double latitude,
+                           double longitude,
+                           double* outKm);
+
+/**
+ * Frees the table with a single call.  Safe to pass NULL.
+ */
+void freeAirportTable(AirportTable* table);
+
+#endif /* HACK13_AIRPORT_TABLE_H */
@@ -0,0 +1,149 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport arena allocation benchmark
+ *
+ * Description:
+ * Builds and releases a synthetic catalog twice, once with initAirport
+ * and freeAirports and once with initAirportInArena and
+ * freeAirportArena, counting the malloc/free calls each needs and
+ * timing both phases.  Exits non-zero when either way leaks (more
+ * allocations than frees) or the copies differ from the source.
+ *
+ * NOTE: the counters replace malloc/calloc/realloc/free for the whole
+ * program and forward to glibc's __libc_* entry points, so the strdup
+ * calls inside libc are counted too.  On other C libraries only the
+ * timings are reported.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "../airport_arena.h"
+#include "bench_utils.h"
+
+#ifdef __GLIBC__
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void __libc_free(void* ptr);
+
+static size_t allocCalls = 0;
+static size_t freeCalls = 0;
+
+void* malloc(size_t size) {
+  allocCalls++;
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  allocCalls++;
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  if (!ptr) allocCalls++;
+  return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+  if (ptr) freeCalls++;
+  __libc_free(ptr);
+}
+#define COUNTING 1
+#else
+static size_t allocCalls = 0;
+static size_t freeCalls = 0;
+#define COUNTING 0
+#endif
+
+static int sameAirport(const Airport* a, const Airport* b) {
+  return strcmp(a->gpsId, b->gpsId) == 0 && strcmp(a->type, b->type) == 0 &&
+         strcmp(a->name, b->name) == 0 && strcmp(a->city, b->city) == 0 &&
+         strcmp(a->countryAbbrv, b->countryAbbrv) == 0 &&
+         a->latitude == b->latitude && a->longitude == b->longitude &&
+         a->elevationFeet == b->elevationFeet;
+}
+
+static void report(const char* label, size_t allocs, size_t frees,
+                   double buildSecs, double releaseSecs) {
+  printf("%-24s: %8zu mallocs, %8zu frees, build %7.2f ms, release %7.2f ms\n",
+         label, allocs, frees, buildSecs * 1e3, releaseSecs * 1e3);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+    return 1;
+  }
+
+  Airport* source = makeSyntheticAirports(n, 2025u);
+  if (!source) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+  int failures = 0;
+
+  printf("Airport construction (n = %d)\n", n);
+  printf("==============================\n");
+
+  /* one heap string per field: 5n + 1 mallocs */
+  size_t allocsBefore = allocCalls;
+  size_t freesBefore = freeCalls;
+  double start = benchNow();
+  Airport* heap = malloc(sizeof(Airport) * n);
+  for (int i = 0; heap && i < n; i++) {
+    const Airport* s = &source[i];
+    initAirport(&heap[i], s->gpsId, s->type, s->name, s->latitude, s->longitude,
+                s->elevationFeet, s->city, s->countryAbbrv);
+  }
+  double built = benchNow();
+  for (int i = 0; heap && i < n; i++) failures += !sameAirport(&heap[i], &source[i]);
+  double releaseStart = benchNow();
+  freeAirports(heap, n);
+  free(heap);
+  double released = benchNow();
+  size_t heapAllocs = allocCalls - allocsBefore;
+  size_t heapFrees = freeCalls - freesBefore;
+  report("initAirport/freeAirports", heapAllocs, heapFrees, built - start,
+         released - releaseStart);
+
+  /* the arena only mallocs its blocks */
+  allocsBefore = allocCalls;
+  freesBefore = freeCalls;
+  start = benchNow();
+  AirportArena* arena = createAirportArena(0);
+  Airport* pooled = createAirportsInArena(arena, n);
+  for (int i = 0; pooled && i < n; i++) {
+    const Airport* s = &source[i];
+    failures += !initAirportInArena(arena, &pooled[i], s->gpsId, s->type, s->name,
+                                    s->latitude, s->longitude, s->elevationFeet,
+                                    s->city, s->countryAbbrv);
+  }
+  built = benchNow();
+  failures += !pooled;
+  for (int i = 0; pooled && i < n; i++) failures += !sameAirport(&pooled[i], &source[i]);
+  releaseStart = benchNow();
+  freeAirportArena(arena);
+  released = benchNow();
+  size_t arenaAllocs = allocCalls - allocsBefore;
+  size_t arenaFrees = freeCalls - freesBefore;
+  report("initAirportInArena", arenaAllocs, arenaFrees, built - start,
+         released - releaseStart);
+
+  if (COUNTING) {
+    printf("allocations saved         : %.0fx fewer\n",
+           (double)heapAllocs / (arenaAllocs ? arenaAllocs : 1));
+    failures += heapAllocs != heapFrees || arenaAllocs != arenaFrees;
+  } else {
+    printf("allocation counts unavailable on this C library\n");
+  }
+  printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+  freeSyntheticAirports(source, n);
+  return failures ? 1 : 0;
+}
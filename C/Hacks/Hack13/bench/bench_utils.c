@@ -0,0 +1,80 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Benchmark helpers
+ *
+ * Description:
+ * Implements the timer and synthetic airport generator used by the
+ * Hack13 benchmarks.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "bench_utils.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+static const char* TYPES[] = {
+  "small_airport", "heliport", "medium_airport", "closed",
+  "seaplane_base", "large_airport", "balloonport"
+};
+static const char* COUNTRIES[] = {
+  "US", "CA", "BR", "AU", "DE", "FR", "GB", "RU", "MX", "JP", "CN", "IN"
+};
+
+double benchNow(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double nextUnit(unsigned int* state) {
+  /* 32-bit xorshift; good enough for spreading points around */
+  unsigned int x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return (x >> 8) / 16777216.0;
+}
+
+void randomLatLon(unsigned int* state, double* latitude, double* longitude) {
+  *latitude = asin(2.0 * nextUnit(state) - 1.0) * 180.0 / M_PI;
+  *longitude = nextUnit(state) * 360.0 - 180.0;
+}
+
+Airport* makeSyntheticAirports(int n, unsigned int seed) {
+  Airport* airports = malloc(sizeof(Airport) * n);
+  if (!airports) return NULL;
+  unsigned int state = seed ? seed : 1u;
+  char gpsId[16];
+  char name[48];
+  char city[32];
+  for (int i = 0; i < n; i++) {
+    double lat, lon;
+    randomLatLon(&state, &lat, &lon);
+    snprintf(gpsId, sizeof(gpsId), "X%05d", i);
+    snprintf(name, sizeof(name), "Synthetic Field %d", i);
+    snprintf(city, sizeof(city), "City %d", i % 5000);
+    int elevation = (int)(nextUnit(&state) * 9000.0);
+    const char* type = TYPES[i % (int)(sizeof(TYPES) / sizeof(TYPES[0]))];
+    const char* country = COUNTRIES[(i / 7) % (int)(sizeof(COUNTRIES) / sizeof(COUNTRIES[0]))];
+    initAirport(&airports[i], gpsId, type, name, lat, lon, elevation, city, country);
+  }
+  return airports;
+}
+
+void freeSyntheticAirports(Airport* airports, int n) {
+  if (!airports) return;
+  freeAirports(airports, n);
+  free(airports);
+}
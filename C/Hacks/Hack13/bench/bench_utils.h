@@ -0,0 +1,44 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Benchmark helpers
+ *
+ * Description:
+ * Shared helpers for the Hack13 benchmarks: a monotonic timer and a
+ * generator for reproducible synthetic Airport arrays sized like the
+ * OurAirports catalog.
+ *
+ * NOTE: makeSyntheticAirports returns malloc'd memory; release it with
+ * freeSyntheticAirports.
+ */
+
+#ifndef HACK13_BENCH_UTILS_H
+#define HACK13_BENCH_UTILS_H
+
+#include "../airport.h"
+
+/**
+ * Returns a monotonic wall-clock time in seconds.
+ */
+double benchNow(void);
+
+/**
+ * Creates n airports scattered uniformly over the globe using a fixed
+ * seed so every run sees the same data.  Returns NULL on allocation
+ * failure.
+ */
+Airport* makeSyntheticAirports(int n, unsigned int seed);
+
+/**
+ * Releases an array created by makeSyntheticAirports.
+ */
+void freeSyntheticAirports(Airport* airports, int n);
+
+/**
+ * Returns a uniformly distributed random point on the globe drawn from
+ * the given seed state.
+ */
+void randomLatLon(unsigned int* state, double* latitude, double* longitude);
+
+#endif /* HACK13_BENCH_UTILS_H */
@@ -0,0 +1,106 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - CSV loader benchmark
+ *
+ * Description:
+ * Writes a synthetic OurAirports-format airports.csv (70k rows by
+ * default, including quoted fields with commas and escaped quotes) and
+ * measures the load throughput of loadAirportsCsv and
+ * loadAirportTableCsv.  Exits non-zero if the loaded data is wrong.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "../airport_csv.h"
+#include "../airport_table.h"
+#include "bench_utils.h"
+
+static int writeFixture(const char* path, const Airport* airports, int n) {
+  FILE* out = fopen(path, "w");
+  if (!out) return 0;
+  fprintf(out, "\"id\",\"ident\",\"type\",\"name\",\"latitude_deg\",\"longitude_deg\","
+               "\"elevation_ft\",\"continent\",\"iso_country\",\"iso_region\","
+               "\"municipality\",\"scheduled_service\",\"gps_code\",\"iata_code\","
+               "\"local_code\",\"home_link\",\"wikipedia_link\",\"keywords\"\n");
+  for (int i = 0; i < n; i++) {
+    const Airport* a = &airports[i];
+    fprintf(out, "%d,\"%s\",\"%s\",\"%s, \"\"Field\"\"\",%.8f,%.8f,%d,\"NA\",\"%s\","
+                 "\"%s-01\",\"%s\",\"no\",\"%s\",,\"%s\",,"
+                 "\"https://en.wikipedia.org/wiki/Airport_%d\",\"kw%d, other\"\n",
+            i + 1, a->gpsId, a->type, a->name, a->latitude, a->longitude,
+            a->elevationFeet, a->countryAbbrv, a->countryAbbrv, a->city,
+            a->gpsId, a->gpsId, i, i);
+  }
+  fclose(out);
+  return 1;
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  const char* path = argc > 2 ? argv[2] : "/tmp/hack13_airports_bench.csv";
+  int runs = 5;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numRows] [csvPath]\n", argv[0]);
+    return 1;
+  }
+
+  Airport* expected = makeSyntheticAirports(n, 2025u);
+  if (!expected || !writeFixture(path, expected, n)) {
+    fprintf(stderr, "unable to write fixture %s\n", path);
+    return 1;
+  }
+
+  printf("OurAirports CSV load (n = %d, %s)\n", n, path);
+  printf("==============================\n");
+
+  int failures = 0;
+  double best = 1e9;
+  for (int r = 0; r < runs; r++) {
+    int loadedCount = 0;
+    double start = benchNow();
+    Airport* loaded = loadAirportsCsv(path, &loadedCount);
+    double secs = benchNow() - start;
+    if (secs < best) best = secs;
+    if (!loaded || loadedCount != n) {
+      failures++;
+    } else if (r == 0) {
+      for (int i = 0; i < n; i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "%s, \"Field\"", expected[i].name);
+        if (strcmp(loaded[i].gpsId, expected[i].gpsId) != 0 ||
+            strcmp(loaded[i].name, name) != 0 ||
+            strcmp(loaded[i].city, expected[i].city) != 0 ||
+            loaded[i].elevationFeet != expected[i].elevationFeet ||
+            loaded[i].latitude - expected[i].latitude > 1e-8 ||
+            expected[i].latitude - loaded[i].latitude > 1e-8) {
+          failures++;
+        }
+      }
+    }
+    free(loaded);
+  }
+  printf("loadAirportsCsv     : %8.2f ms  (%.2f M rows/s)\n",
+         best * 1e3, n / best / 1e6);
+
+  best = 1e9;
+  for (int r = 0; r < runs; r++) {
+    double start = benchNow();
+    AirportTable* table = loadAirportTableCsv(path);
+    double secs = benchNow() - start;
+    if (secs < best) best = secs;
+    if (!table || table->size != n) failures++;
+    freeAirportTable(table);
+  }
+  printf("loadAirportTableCsv : %8.2f ms  (%.2f M rows/s)\n",
+         best * 1e3, n / best / 1e6);
+  printf("correctness checks  : %s\n", failures ? "FAILED" : "passed");
+
+  freeSyntheticAirports(expected, n);
+  remove(path);
+  return failures ? 1 : 0;
+}
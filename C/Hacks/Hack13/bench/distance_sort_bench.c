@@ -0,0 +1,78 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Distance sort benchmark
+ *
+ * Description:
+ * Times qsort with cmpByLincolnDistance against sortAirportsByDistance
+ * on a synthetic catalog and checks both produce the same distance
+ * order.  Exits non-zero on a mismatch.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "bench_utils.h"
+
+#define LINCOLN_LAT 40.846176
+#define LINCOLN_LON -96.75471
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  int runs = 5;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+    return 1;
+  }
+
+  Airport* airports = makeSyntheticAirports(n, 2025u);
+  Airport* workingCopy = malloc(sizeof(Airport) * n);
+  int* order = malloc(sizeof(int) * n);
+  double* dists = malloc(sizeof(double) * n);
+  if (!airports || !workingCopy || !order || !dists) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+
+  printf("Sort by distance from Lincoln (n = %d)\n", n);
+  printf("==============================\n");
+
+  double start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    memcpy(workingCopy, airports, sizeof(Airport) * n);
+    qsort(workingCopy, n, sizeof(Airport), cmpByLincolnDistance);
+  }
+  double qsortSecs = (benchNow() - start) / runs;
+
+  start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    sortAirportsByDistance(airports, n, LINCOLN_LAT, LINCOLN_LON, order, dists);
+  }
+  double keyedSecs = (benchNow() - start) / runs;
+
+  printf("qsort + cmpByLincolnDistance : %9.3f ms\n", qsortSecs * 1e3);
+  printf("sortAirportsByDistance       : %9.3f ms\n", keyedSecs * 1e3);
+  printf("speedup                      : %9.1fx\n", qsortSecs / keyedSecs);
+
+  Airport lincoln;
+  lincoln.latitude = LINCOLN_LAT;
+  lincoln.longitude = LINCOLN_LON;
+  int failures = 0;
+  for (int i = 0; i < n; i++) {
+    double expected = getAirDistance(&lincoln, &workingCopy[i]);
+    if (dists[i] != expected ||
+        getAirDistance(&lincoln, &airports[order[i]]) != expected) {
+      failures++;
+    }
+  }
+  printf("correctness checks           : %s\n", failures ? "FAILED" : "passed");
+
+  free(dists);
+  free(order);
+  free(workingCopy);
+  freeSyntheticAirports(airports, n);
+  return failures ? 1 : 0;
+}
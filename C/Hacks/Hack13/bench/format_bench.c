@@ -0,0 +1,156 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport formatting benchmark
+ *
+ * Description:
+ * Measures rows per second for the old airportToString/printf/free
+ * loop against writeAirports, both writing to /dev/null, and checks
+ * that formatAirport produces exactly the sprintf text on random and
+ * rounding-edge coordinates, NULL and oversized strings, and truncated
+ * buffers.  Exits non-zero on a mismatch.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "bench_utils.h"
+
+#define LEGACY_FORMAT "%-8s %-15s %-20s %.2f %.2f %d %-10s %-2s"
+
+/* The formatting path writeAirports replaced. */
+static char* legacyToString(const Airport* a) {
+  char temp[1000];
+  sprintf(temp, LEGACY_FORMAT, a->gpsId, a->type, a->name, a->latitude,
+          a->longitude, a->elevationFeet, a->city, a->countryAbbrv);
+  char* result = malloc(strlen(temp) + 1);
+  strcpy(result, temp);
+  return result;
+}
+
+static int checkOne(const Airport* a) {
+  char expected[2048];
+  char actual[2048];
+  int expectedLen = snprintf(expected, sizeof(expected), LEGACY_FORMAT, a->gpsId,
+                             a->type, a->name, a->latitude, a->longitude,
+                             a->elevationFeet, a->city, a->countryAbbrv);
+  int len = formatAirport(a, actual, sizeof(actual));
+  if (len != expectedLen || strcmp(expected, actual) != 0) {
+    fprintf(stderr, "mismatch:\n  sprintf: '%s'\n  format : '%s'\n", expected, actual);
+    return 1;
+  }
+  /* every truncation must match snprintf's (truncating on purpose) */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-truncation"
+  for (size_t size = 0; size < 12; size++) {
+    char small[16];
+    memset(small, 'x', sizeof(small));
+    char reference[16];
+    memset(reference, 'x', sizeof(reference));
+    snprintf(reference, size, LEGACY_FORMAT, a->gpsId, a->type, a->name, a->latitude,
+             a->longitude, a->elevationFeet, a->city, a->countryAbbrv);
+    if (formatAirport(a, size ? small : NULL, size) != expectedLen ||
+        memcmp(small, reference, sizeof(small)) != 0) {
+      fprintf(stderr, "truncation mismatch at size %zu\n", size);
+      return 1;
+    }
+  }
+#pragma GCC diagnostic pop
+  return 0;
+}
+
+static int checkFormatting(const Airport* airports, int n) {
+  int failures = 0;
+  for (int i = 0; i < n; i++) failures += checkOne(&airports[i]);
+
+  /* values on and next to half-cent boundaries, signed zeros, extremes */
+  static const double edges[] = {
+    0.0, -0.0, 0.005, 0.015, 0.125, 0.375, 2.675, 1.005, -1.005, -0.001,
+    -0.004999, 0.994999, 0.995, 99.995, -179.995, 179.99999999, 41.3030,
+    -95.8940, 9999999999999.995, 840187717154709.45, 1e14, -1e15, 1e300, 1e-300
+  };
+  int numEdges = (int)(sizeof(edges) / sizeof(edges[0]));
+  Airport a = airports[0];
+  for (int i = 0; i < numEdges; i++) {
+    a.latitude = edges[i];
+    a.longitude = -edges[numEdges - 1 - i];
+    a.elevationFeet = i % 2 ? -2147483647 - 1 : 2147483647;
+    failures += checkOne(&a);
+  }
+  unsigned int state = 99u;
+  for (int i = 0; i < 200000; i++) {
+    double lat, lon;
+    randomLatLon(&state, &lat, &lon);
+    /* exact multiples of 1/1000 hit the printf tie rules */
+    a.latitude = i % 2 ? lat : (int)(lat * 1000.0) / 1000.0;
+    a.longitude = i % 3 ? lon : (int)(lon * 1000.0) / 1000.0;
+    failures += checkOne(&a);
+  }
+  /* large values, where x * 100 passes 2^53 */
+  for (int i = 0; i < 100000; i++) {
+    state = state * 1103515245u + 12345u;
+    a.latitude = (state >> 1) / 2147483648.0 * 1e15;
+    a.longitude = -a.latitude / (1 + i % 100);
+    failures += checkOne(&a);
+  }
+
+  /* NULL fields print "(null)" and long names overflow the padding */
+  char longName[600];
+  memset(longName, 'n', sizeof(longName) - 1);
+  longName[sizeof(longName) - 1] = '\0';
+  a.gpsId = NULL;
+  a.name = longName;
+  failures += checkOne(&a);
+  char* s = airportToString(&a);
+  failures += !s || strlen(s) < sizeof(longName);
+  free(s);
+  return failures;
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  int runs = 10;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+    return 1;
+  }
+  Airport* airports = makeSyntheticAirports(n, 2025u);
+  FILE* sink = fopen("/dev/null", "w");
+  if (!airports || !sink) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+
+  double start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    for (int i = 0; i < n; i++) {
+      char* s = legacyToString(&airports[i]);
+      fprintf(sink, "%s\n", s);
+      free(s);
+    }
+  }
+  fflush(sink);
+  double legacySecs = benchNow() - start;
+
+  start = benchNow();
+  for (int r = 0; r < runs; r++) writeAirports(sink, airports, NULL, n);
+  fflush(sink);
+  double batchSecs = benchNow() - start;
+
+  double rows = (double)n * runs;
+  printf("Airport formatting (n = %d x %d runs, output to /dev/null)\n", n, runs);
+  printf("==============================\n");
+  printf("sprintf + malloc + printf : %9.2f M rows/s\n", rows / legacySecs / 1e6);
+  printf("writeAirports             : %9.2f M rows/s\n", rows / batchSecs / 1e6);
+  printf("speedup                   : %9.1fx\n", legacySecs / batchSecs);
+
+  int failures = checkFormatting(airports, n);
+  printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+  fclose(sink);
+  freeSyntheticAirports(airports, n);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Batch distance kernel benchmark
+ *
+ * Description:
+ * Compares a scalar getAirDistance loop with the airDistanceMany and
+ * haversineDistanceMany batch kernels on random points, and reports
+ * their error against libm.  Exits non-zero if an error bound from
+ * geo_batch.h is exceeded.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "../airport.h"
+#include "../geo_batch.h"
+#include "bench_utils.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define LINCOLN_LAT 40.846176
+#define LINCOLN_LON -96.75471
+
+/* Reference haversine distance computed with libm. */
+static double haversineRef(double lat1, double lon1, double lat2, double lon2) {
+  double p1 = lat1 * M_PI / 180.0, p2 = lat2 * M_PI / 180.0;
+  double dp = p2 - p1, dl = (lon2 - lon1) * M_PI / 180.0;
+  double a = sin(dp / 2) * sin(dp / 2) + cos(p1) * cos(p2) * sin(dl / 2) * sin(dl / 2);
+  return 2.0 * 6371.0 * asin(sqrt(a));
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 1000000;
+  int runs = 10;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numPoints]\n", argv[0]);
+    return 1;
+  }
+
+  Airport* points = malloc(sizeof(Airport) * n);
+  double* lats = malloc(sizeof(double) * n);
+  double* lons = malloc(sizeof(double) * n);
+  double* scalar = malloc(sizeof(double) * n);
+  double* batch = malloc(sizeof(double) * n);
+  double* hav = malloc(sizeof(double) * n);
+  if (!points || !lats || !lons || !scalar || !batch || !hav) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+  unsigned int state = 7u;
+  for (int i = 0; i < n; i++) {
+    randomLatLon(&state, &lats[i], &lons[i]);
+    points[i].latitude = lats[i];
+    points[i].longitude = lons[i];
+  }
+  Airport origin;
+  origin.latitude = LINCOLN_LAT;
+  origin.longitude = LINCOLN_LON;
+
+  double start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    for (int i = 0; i < n; i++) scalar[i] = getAirDistance(&origin, &points[i]);
+  }
+  double scalarSecs = (benchNow() - start) / runs;
+
+  start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    airDistanceMany(LINCOLN_LAT, LINCOLN_LON, lats, lons, batch, n);
+  }
+  double batchSecs = (benchNow() - start) / runs;
+
+  start = benchNow();
+  for (int r = 0; r < runs; r++) {
+    haversineDistanceMany(LINCOLN_LAT, LINCOLN_LON, lats, lons, hav, n);
+  }
+  double havSecs = (benchNow() - start) / runs;
+
+  double maxErr = 0.0, maxHavErr = 0.0;
+  for (int i = 0; i < n; i++) {
+    double e = fabs(batch[i] - scalar[i]);
+    if (e > maxErr) maxErr = e;
+    e = fabs(hav[i] - haversineRef(LINCOLN_LAT, LINCOLN_LON, lats[i], lons[i]));
+    if (e > maxHavErr) maxHavErr = e;
+  }
+
+  /* short range: points within ~50 km of the origin */
+  double maxRel = 0.0;
+  for (int i = 0; i < 10000; i++) {
+    double lat = LINCOLN_LAT + (i % 100 - 50) * 0.004;
+    double lon = LINCOLN_LON + (i / 100 - 50) * 0.004;
+    double d;
+    haversineDistanceMany(LINCOLN_LAT, LINCOLN_LON, &lat, &lon, &d, 1);
+    double ref = haversineRef(LINCOLN_LAT, LINCOLN_LON, lat, lon);
+    if (ref > 0.0 && fabs(d - ref) / ref > maxRel) maxRel = fabs(d - ref) / ref;
+  }
+
+  printf("Great-circle distance kernels (n = %d)\n", n);
+  printf("==============================\n");
+  printf("scalar getAirDistance loop : %8.2f ns/point\n", scalarSecs / n * 1e9);
+  printf("airDistanceMany            : %8.2f ns/point (%.1fx)\n",
+         batchSecs / n * 1e9, scalarSecs / batchSecs);
+  printf("haversineDistanceMany      : %8.2f ns/point (%.1fx)\n",
+         havSecs / n * 1e9, scalarSecs / havSecs);
+  printf("max |error| law of cosines : %8.2e km\n", maxErr);
+  printf("max |error| haversine      : %8.2e km\n", maxHavErr);
+  printf("max rel. error < 50 km     : %8.2e\n", maxRel);
+
+  int failed = maxErr > 1e-3 || maxHavErr > 1e-3 || maxRel > 1e-9;
+  printf("error bounds               : %s\n", failed ? "FAILED" : "passed");
+
+  free(points);
+  free(lats);
+  free(lons);
+  free(scalar);
+  free(batch);
+  free(hav);
+  return failed;
+}
@@ -0,0 +1,186 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport hash index benchmark
+ *
+ * Description:
+ * Builds the GPS id, (country, city) and type indexes over a synthetic
+ * catalog, both at once and incrementally across a realloc of the
+ * array, and times lookups against linear strcmp scans.  Every answer
+ * is checked against the scan, also after an add that ran out of memory
+ * part way and was retried.  Exits non-zero on a mismatch.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "../airport_index.h"
+#include "bench_utils.h"
+
+/* calloc is wrapped at link time so one call can be made to fail */
+static int callocsUntilFailure = -1;
+
+void* __real_calloc(size_t count, size_t size);
+
+void* __wrap_calloc(size_t count, size_t size) {
+  if (callocsUntilFailure >= 0 && callocsUntilFailure-- == 0) return NULL;
+  return __real_calloc(count, size);
+}
+
+static int scanGpsId(const Airport* airports, int n, const char* gpsId) {
+  for (int i = 0; i < n; i++) {
+    if (strcmp(airports[i].gpsId, gpsId) == 0) return i;
+  }
+  return -1;
+}
+
+static int scanCity(const Airport* airports, int n, const char* country, const char* city,
+                    int* rows) {
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    if (strcmp(airports[i].countryAbbrv, country) == 0 && strcmp(airports[i].city, city) == 0) {
+      rows[count++] = i;
+    }
+  }
+  return count;
+}
+
+static int scanType(const Airport* airports, int n, const char* type, int* rows) {
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    if (strcmp(airports[i].type, type) == 0) rows[count++] = i;
+  }
+  return count;
+}
+
+/* Compares every kind of lookup of two indexes against the scans. */
+static int checkIndex(const AirportIndex* index, const Airport* airports, int n,
+                      int* rows, int* expected) {
+  int failures = 0;
+  for (int i = 0; i < n; i += 97) {
+    const Airport* a = &airports[i];
+    failures += airportIndexFindGpsId(index, a->gpsId) != scanGpsId(airports, n, a->gpsId);
+    int count = airportIndexFindCity(index, a->countryAbbrv, a->city, rows, n);
+    failures += count != scanCity(airports, n, a->countryAbbrv, a->city, expected) ||
+                memcmp(rows, expected, sizeof(int) * count) != 0;
+  }
+  static const char* types[] = { "small_airport", "heliport", "closed", "no_such_type" };
+  for (int t = 0; t < 4; t++) {
+    int count = airportIndexFindType(index, types[t], rows, n);
+    failures += count != scanType(airports, n, types[t], expected) ||
+                memcmp(rows, expected, sizeof(int) * count) != 0;
+  }
+  failures += airportIndexFindGpsId(index, "NOPE") != -1;
+  failures += airportIndexFindCity(index, "US", "Atlantis", rows, n) != 0;
+  return failures;
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  if (n < 2) {
+    fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+    return 1;
+  }
+  Airport* airports = makeSyntheticAirports(n, 2025u);
+  int* rows = malloc(sizeof(int) * n);
+  int* expected = malloc(sizeof(int) * n);
+  if (!airports || !rows || !expected) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+  int failures = 0;
+
+  printf("Airport hash indexes (n = %d)\n", n);
+  printf("==============================\n");
+
+  double start = benchNow();
+  AirportIndex* index = createAirportIndex(airports, n);
+  double buildSecs = benchNow() - start;
+  if (!index) {
+    fprintf(stderr, "createAirportIndex failed\n");
+    return 1;
+  }
+  failures += checkIndex(index, airports, n, rows, expected);
+
+  /* incremental: index half, grow (and move) the array, add the rest */
+  int half = n / 2;
+  Airport* growing = malloc(sizeof(Airport) * half);
+  memcpy(growing, airports, sizeof(Airport) * half);
+  start = benchNow();
+  AirportIndex* incremental = createAirportIndex(growing, half);
+  growing = realloc(growing, sizeof(Airport) * n);
+  memcpy(growing + half, airports + half, sizeof(Airport) * (n - half));
+  failures += !incremental || !airportIndexAdd(incremental, growing, n);
+  double incrementalSecs = benchNow() - start;
+  failures += incremental ? checkIndex(incremental, growing, n, rows, expected) : 1;
+
+  /* a failed add indexes no part of a row, so retrying it is safe */
+  int small = n < 3000 ? n : 3000, failed = 0;
+  for (int k = 0; k < 40; k++) {
+    AirportIndex* retried = createAirportIndex(airports, 0);
+    if (!retried) {
+      failures++;
+      break;
+    }
+    callocsUntilFailure = k;
+    failed += !airportIndexAdd(retried, airports, small);
+    callocsUntilFailure = -1;
+    failures += !airportIndexAdd(retried, airports, small) || retried->size != small ||
+                checkIndex(retried, airports, small, rows, expected);
+    freeAirportIndex(retried);
+  }
+  failures += failed == 0;
+
+  int queries = 200000;
+  unsigned int state = 7u;
+  volatile int sink = 0;
+  start = benchNow();
+  for (int q = 0; q < queries; q++) {
+    state = state * 1103515245u + 12345u;
+    sink += airportIndexFindGpsId(index, airports[state % (unsigned int)n].gpsId);
+  }
+  double gpsNanos = (benchNow() - start) / queries * 1e9;
+
+  start = benchNow();
+  for (int q = 0; q < queries; q++) {
+    state = state * 1103515245u + 12345u;
+    const Airport* a = &airports[state % (unsigned int)n];
+    sink += airportIndexFindCity(index, a->countryAbbrv, a->city, rows, n);
+  }
+  double cityNanos = (benchNow() - start) / queries * 1e9;
+
+  int scans = 200;
+  start = benchNow();
+  for (int q = 0; q < scans; q++) {
+    state = state * 1103515245u + 12345u;
+    sink += scanGpsId(airports, n, airports[state % (unsigned int)n].gpsId);
+  }
+  double scanGpsNanos = (benchNow() - start) / scans * 1e9;
+
+  start = benchNow();
+  for (int q = 0; q < scans; q++) {
+    state = state * 1103515245u + 12345u;
+    const Airport* a = &airports[state % (unsigned int)n];
+    sink += scanCity(airports, n, a->countryAbbrv, a->city, rows);
+  }
+  double scanCityNanos = (benchNow() - start) / scans * 1e9;
+
+  printf("build (all at once)       : %9.2f ms\n", buildSecs * 1e3);
+  printf("build (half + add half)   : %9.2f ms\n", incrementalSecs * 1e3);
+  printf("gpsId lookup              : %9.3f us (scan %9.3f us, %.0fx)\n",
+         gpsNanos / 1e3, scanGpsNanos / 1e3, scanGpsNanos / gpsNanos);
+  printf("country/city lookup       : %9.3f us (scan %9.3f us, %.0fx)\n",
+         cityNanos / 1e3, scanCityNanos / 1e3, scanCityNanos / cityNanos);
+  printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+  freeAirportIndex(incremental);
+  freeAirportIndex(index);
+  free(growing);
+  free(expected);
+  free(rows);
+  freeSyntheticAirports(airports, n);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Airport spatial index benchmark
+ *
+ * Description:
+ * Compares nearest/furthest-airport lookups done by copying and
+ * qsorting with cmpByLincolnDistance against the k-d tree in
+ * airport_kdtree.h on a 70k airport synthetic catalog.  Exits non-zero
+ * if the two paths disagree.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../airport.h"
+#include "../airport_kdtree.h"
+#include "bench_utils.h"
+
+#define LINCOLN_LAT 40.846176
+#define LINCOLN_LON -96.75471
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  int sortRuns = 5;
+  int queries = 100000;
+  int k = 10;
+  if (n < k) {
+    fprintf(stderr, "Usage: %s [numAirports >= %d]\n", argv[0], k);
+    return 1;
+  }
+
+  Airport* airports = makeSyntheticAirports(n, 2025u);
+  Airport* workingCopy = malloc(sizeof(Airport) * n);
+  if (!airports || !workingCopy) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+  Airport lincoln;
+  lincoln.latitude = LINCOLN_LAT;
+  lincoln.longitude = LINCOLN_LON;
+
+  printf("k-d tree vs qsort nearest-airport benchmark (n = %d)\n", n);
+  printf("==============================\n");
+
+  double start = benchNow();
+  for (int r = 0; r < sortRuns; r++) {
+    memcpy(workingCopy, airports, sizeof(Airport) * n);
+    qsort(workingCopy, n, sizeof(Airport), cmpByLincolnDistance);
+  }
+  double sortSecs = (benchNow() - start) / sortRuns;
+  printf("qsort by Lincoln distance : %10.3f ms/query\n", sortSecs * 1e3);
+
+  start = benchNow();
+  AirportKdTree* tree = createAirportKdTree(airports, n);
+  double buildSecs = benchNow() - start;
+  if (!tree) {
+    fprintf(stderr, "tree build failed\n");
+    return 1;
+  }
+  printf("k-d tree build            : %10.3f ms (once)\n", buildSecs * 1e3);
+
+  /* correctness: the tree must agree with the sorted order around Lincoln */
+  int* nearest = malloc(sizeof(int) * n);
+  double* dists = malloc(sizeof(double) * n);
+  int failures = 0;
+  int got = findNearestAirports(tree, LINCOLN_LAT, LINCOLN_LON, k, nearest, dists);
+  for (int i = 0; i < got; i++) {
+    double expected = getAirDistance(&lincoln, &workingCopy[i]);
+    if (dists[i] - expected > 1e-6 || expected - dists[i] > 1e-6) failures++;
+  }
+  got = findNearestAirports(tree, LINCOLN_LAT, LINCOLN_LON, n, nearest, dists);
+  if (got != n || getAirDistance(&lincoln, &airports[nearest[n - 1]]) !=
+                  getAirDistance(&lincoln, &workingCopy[n - 1])) {
+    failures++;
+  }
+
+  unsigned int state = 99u;
+  double lat, lon;
+  start = benchNow();
+  for (int q = 0; q < queries; q++) {
+    randomLatLon(&state, &lat, &lon);
+    findNearestAirports(tree, lat, lon, 1, nearest, dists);
+  }
+  double nnSecs = (benchNow() - start) / queries;
+  printf("k-d tree nearest (k = 1)  : %10.3f us/query\n", nnSecs * 1e6);
+
+  start = benchNow();
+  for (int q = 0; q < queries; q++) {
+    randomLatLon(&state, &lat, &lon);
+    findNearestAirports(tree, lat, lon, k, nearest, dists);
+  }
+  double knnSecs = (benchNow() - start) / queries;
+  printf("k-d tree nearest (k = %2d) : %10.3f us/query\n", k, knnSecs * 1e6);
+
+  long totalHits = 0;
+  start = benchNow();
+  for (int q = 0; q < queries; q++) {
+    int* hits = NULL;
+    randomLatLon(&state, &lat, &lon);
+    int found = findAirportsWithinRadius(tree, lat, lon, 250.0, &hits, NULL);
+    if (found > 0) totalHits += found;
+    free(hits);
+  }
+  double radiusSecs = (benchNow() - start) / queries;
+  printf("k-d tree radius (250 km)  : %10.3f us/query (%.1f hits avg)\n",
+         radiusSecs * 1e6, (double)totalHits / queries);
+  printf("speedup nearest vs qsort  : %10.0fx\n", sortSecs / nnSecs);
+
+  /* correctness: radius results must match a brute-force scan */
+  for (int q = 0; q < 50; q++) {
+    randomLatLon(&state, &lat, &lon);
+    Airport probe;
+    probe.latitude = lat;
+    probe.longitude = lon;
+    int surelyInside = 0, maybeInside = 0;
+    for (int i = 0; i < n; i++) {
+      double d = getAirDistance(&probe, &airports[i]);
+      if (d <= 500.0 - 1e-6) surelyInside++;
+      if (d <= 500.0 + 1e-6) maybeInside++;
+    }
+    int* hits = NULL;
+    int found = findAirportsWithinRadius(tree, lat, lon, 500.0, &hits, NULL);
+    free(hits);
+    if (found < surelyInside || found > maybeInside) failures++;
+  }
+
+  printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+  free(nearest);
+  free(dists);
+  freeAirportKdTree(tree);
+  free(workingCopy);
+  freeSyntheticAirports(airports, n);
+  return failures ? 1 : 0;
+}
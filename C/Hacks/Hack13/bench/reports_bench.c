@@ -0,0 +1,78 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Report engine benchmark
+ *
+ * Description:
+ * Times generateReports (the single-pass report engine) against the
+ * previous nine memcpy+qsort passes on a synthetic catalog.  Report
+ * output is sent to /dev/null so only the work is measured.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../airport.h"
+#include "bench_utils.h"
+
+/* The report path generateReports replaced: copy and re-sort per report. */
+static void legacyReports(Airport* airports, int n) {
+  int (*cmps[])(const void*, const void*) = {
+    cmpByGPSId, cmpByType, cmpByName, cmpByNameDesc, cmpByCountryCity,
+    cmpByLatitude, cmpByLongitude, cmpByLincolnDistance, cmpByLongitude
+  };
+  Airport* workingCopy = malloc(sizeof(Airport) * n);
+  printAirports(airports, n);
+  for (int c = 0; c < 9; c++) {
+    memcpy(workingCopy, airports, sizeof(Airport) * n);
+    qsort(workingCopy, n, sizeof(Airport), cmps[c]);
+    if (c < 8) printAirports(workingCopy, n);
+  }
+  printAirports(&workingCopy[n / 2], 1);
+  for (int i = 0; i < n; i++) {
+    if (strcmp(airports[i].city, "New York") == 0) break;
+  }
+  for (int i = 0; i < n; i++) {
+    if (strcmp(airports[i].type, "large_airport") == 0) break;
+  }
+  free(workingCopy);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 70000;
+  if (n < 1) {
+    fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+    return 1;
+  }
+  Airport* airports = makeSyntheticAirports(n, 2025u);
+  if (!airports) return 1;
+
+  FILE* console = fdopen(dup(fileno(stdout)), "w");
+  if (!console || !freopen("/dev/null", "w", stdout)) return 1;
+
+  double start = benchNow();
+  legacyReports(airports, n);
+  double legacySecs = benchNow() - start;
+
+  start = benchNow();
+  generateReports(airports, n);
+  double engineSecs = benchNow() - start;
+
+  start = benchNow();
+  for (int r = 0; r < 9; r++) printAirports(airports, n);
+  double printSecs = benchNow() - start;
+
+  fprintf(console, "Airport reports (n = %d, output to /dev/null)\n", n);
+  fprintf(console, "==============================\n");
+  fprintf(console, "memcpy + qsort per report : %9.1f ms\n", legacySecs * 1e3);
+  fprintf(console, "report engine             : %9.1f ms\n", engineSecs * 1e3);
+  fprintf(console, "  (of which printing ~     : %9.1f ms)\n", printSecs * 1e3);
+  fprintf(console, "speedup                   : %9.2fx\n", legacySecs / engineSecs);
+  fclose(console);
+
+  freeSyntheticAirports(airports, n);
+  return 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Distance matrix and route benchmark
+ *
+ * Description:
+ * Times the all-pairs distance matrix against a naive getAirDistance
+ * double loop on 1k-5k airport subsets, then times optimizeRoute on
+ * exact and heuristic stop counts.  Checks the matrix against the
+ * scalar distances, the exact solver against brute force, and every
+ * reported cost against getEstimatedTravelTime.  Exits non-zero on a
+ * failed check.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "../airport.h"
+#include "../airport_routes.h"
+#include "bench_utils.h"
+
+#define SPEED_KMH 800.0
+#define LAYOVER_HRS 1.5
+
+static const char* SHAPE_NAMES[] = { "open end", "fixed end", "round trip" };
+
+/* Cost of the stops in the given order, computed by the original API. */
+static double orderCost(const Airport* stops, int size, RouteShape shape, const int* order) {
+  Airport* tour = malloc(sizeof(Airport) * (size + 1));
+  if (!tour) return -1.0;
+  for (int i = 0; i < size; i++) tour[i] = stops[order[i]];
+  int length = size;
+  if (shape == ROUTE_ROUND_TRIP) tour[length++] = stops[order[0]];
+  double hours = getEstimatedTravelTime(tour, length, SPEED_KMH, LAYOVER_HRS);
+  free(tour);
+  return hours;
+}
+
+static int isValidOrder(const int* order, int size, RouteShape shape) {
+  char* seen = calloc(size, 1);
+  int ok = seen && order[0] == 0 && (shape != ROUTE_FIXED_END || order[size - 1] == size - 1);
+  for (int i = 0; ok && i < size; i++) {
+    ok = order[i] >= 0 && order[i] < size && !seen[order[i]];
+    if (ok) seen[order[i]] = 1;
+  }
+  free(seen);
+  return ok;
+}
+
+/* Tries every order of positions pos .. last and keeps the cheapest. */
+static void bruteForce(const Airport* stops, int size, RouteShape shape,
+                       int* order, int pos, int last, double* best) {
+  if (pos > last) {
+    double c = orderCost(stops, size, shape, order);
+    if (c < *best) *best = c;
+    return;
+  }
+  for (int i = pos; i <= last; i++) {
+    int t = order[pos]; order[pos] = order[i]; order[i] = t;
+    bruteForce(stops, size, shape, order, pos + 1, last, best);
+    t = order[pos]; order[pos] = order[i]; order[i] = t;
+  }
+}
+
+static int benchMatrix(const Airport* airports, int n) {
+  double start = benchNow();
+  double* naive = malloc(sizeof(double) * (size_t)n * n);
+  if (!naive) return 1;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      naive[(size_t)i * n + j] = getAirDistance(&airports[i], &airports[j]);
+    }
+  }
+  double naiveSecs = benchNow() - start;
+
+  start = benchNow();
+  double* single = createDistanceMatrix(airports, n, 1);
+  double singleSecs = benchNow() - start;
+
+  start = benchNow();
+  double* threaded = createDistanceMatrix(airports, n, 0);
+  double threadedSecs = benchNow() - start;
+
+  int failures = !single || !threaded;
+  double maxErr = 0.0;
+  for (size_t k = 0; !failures && k < (size_t)n * n; k++) {
+    double err = fabs(threaded[k] - naive[k]);
+    if (err > maxErr) maxErr = err;
+    if (threaded[k] != single[k]) failures++;
+  }
+  for (int i = 0; !failures && i < n; i++) {
+    if (threaded[(size_t)i * n + i] != 0.0) failures++;
+  }
+  if (maxErr > 1e-3) failures++;
+
+  printf("n = %d\n", n);
+  printf("  naive getAirDistance loop   : %9.1f ms\n", naiveSecs * 1e3);
+  printf("  createDistanceMatrix (1 thr): %9.1f ms (%.1fx)\n", singleSecs * 1e3, naiveSecs / singleSecs);
+  printf("  createDistanceMatrix (all)  : %9.1f ms (%.1fx)\n", threadedSecs * 1e3, naiveSecs / threadedSecs);
+  printf("  max error                   : %9.2e km\n", maxErr);
+
+  free(naive);
+  free(single);
+  free(threaded);
+  return failures;
+}
+
+int main(int argc, char** argv) {
+  int sizes[] = { 1000, 2500, 5000 };
+  int numSizes = 3;
+  if (argc > 1) {
+    sizes[0] = atoi(argv[1]);
+    numSizes = 1;
+    if (sizes[0] < 1) {
+      fprintf(stderr, "Usage: %s [numAirports]\n", argv[0]);
+      return 1;
+    }
+  }
+  int failures = 0;
+
+  printf("All-pairs distance matrix\n");
+  printf("==============================\n");
+  for (int s = 0; s < numSizes; s++) {
+    Airport* airports = makeSyntheticAirports(sizes[s], 2025u + s);
+    if (!airports) {
+      fprintf(stderr, "allocation failed\n");
+      return 1;
+    }
+    failures += benchMatrix(airports, sizes[s]);
+    freeSyntheticAirports(airports, sizes[s]);
+  }
+
+  Airport* stops = makeSyntheticAirports(1000, 7u);
+  int* order = malloc(sizeof(int) * 1000);
+  int* identity = malloc(sizeof(int) * 1000);
+  if (!stops || !order || !identity) {
+    fprintf(stderr, "allocation failed\n");
+    return 1;
+  }
+  for (int i = 0; i < 1000; i++) identity[i] = i;
+
+  printf("\nExact routes (Held-Karp) vs brute force, 9 stops\n");
+  printf("==============================\n");
+  for (int shape = ROUTE_OPEN_END; shape <= ROUTE_ROUND_TRIP; shape++) {
+    int size = 9;
+    double hours = optimizeRoute(stops, size, shape, SPEED_KMH, LAYOVER_HRS, order);
+    double best = 1e300;
+    int* perm = malloc(sizeof(int) * size);
+    memcpy(perm, identity, sizeof(int) * size);
+    bruteForce(stops, size, shape, perm, 1, shape == ROUTE_FIXED_END ? size - 2 : size - 1, &best);
+    free(perm);
+    int ok = isValidOrder(order, size, shape) && fabs(hours - best) < 1e-9 &&
+             orderCost(stops, size, shape, order) == hours;
+    printf("  %-10s: %8.3f hrs (brute force %8.3f) %s\n", SHAPE_NAMES[shape], hours, best,
+           ok ? "ok" : "MISMATCH");
+    failures += !ok;
+  }
+
+  printf("\noptimizeRoute timings (open end)\n");
+  printf("==============================\n");
+  int routeSizes[] = { 12, 16, 20, 50, 200, 1000 };
+  for (int r = 0; r < 6; r++) {
+    int size = routeSizes[r];
+    double start = benchNow();
+    double hours = optimizeRoute(stops, size, ROUTE_OPEN_END, SPEED_KMH, LAYOVER_HRS, order);
+    double secs = benchNow() - start;
+    double given = orderCost(stops, size, ROUTE_OPEN_END, identity);
+    int ok = hours >= 0.0 && isValidOrder(order, size, ROUTE_OPEN_END) &&
+             orderCost(stops, size, ROUTE_OPEN_END, order) == hours && hours <= given;
+    printf("  %4d stops (%s): %9.1f ms, %9.1f hrs vs %9.1f hrs in given order %s\n",
+           size, size <= ROUTE_EXACT_MAX_STOPS ? "exact    " : "heuristic", secs * 1e3,
+           hours, given, ok ? "ok" : "FAILED");
+    failures += !ok;
+  }
+
+  printf("\ncorrectness checks           : %s\n", failures ? "FAILED" : "passed");
+
+  free(identity);
+  free(order);
+  freeSyntheticAirports(stops, 1000);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Batch great-circle distance kernels
+ *
+ * Description:
+ * Implements the vectorizable distance kernels declared in geo_batch.h.
+ * Every helper is branch-free (selects instead of ifs) so the per-point
+ * loops auto-vectorize at -O3 -fno-math-errno -fno-trapping-math (see
+ * GEO_FLAGS in the makefile).
+ */
+
+#include <math.h>
+
+#include "geo_batch.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define EARTH_RADIUS_KM 6371.0
+#define DEG_TO_RAD (M_PI / 180.0)
+#define HALF_PI (M_PI / 2.0)
+
+/* Adding and subtracting 1.5 * 2^52 rounds a double to the nearest
+ * integer without a libm call, valid for |x| < 2^51. */
+#define ROUND_MAGIC 6755399441055744.0
+
+/* pi/2 split in two parts (Cody-Waite) so x - q*pi/2 stays exact. */
+#define PIO2_HI 1.57079632679489655800e+00
+#define PIO2_LO 6.12323399573676603587e-17
+
+static inline double roundNearest(double x) {
+  return (x + ROUND_MAGIC) - ROUND_MAGIC;
+}
+
+/* Taylor polynomials for |r| <= pi/4, accurate to a few ulps. */
+static inline double sinCore(double r) {
+  double r2 = r * r;
+  double p = -1.0 / 1307674368000.0;
+  p = p * r2 + 1.0 / 6227020800.0;
+  p = p * r2 - 1.0 / 39916800.0;
+  p = p * r2 + 1.0 / 362880.0;
+  p = p * r2 - 1.0 / 5040.0;
+  p = p * r2 + 1.0 / 120.0;
+  p = p * r2 - 1.0 / 6.0;
+  return r + r * r2 * p;
+}
+
+static inline double cosCore(double r) {
+  double r2 = r * r;
+  double p = 1.0 / 20922789888000.0;
+  p = p * r2 - 1.0 / 87178291200.0;
+  p = p * r2 + 1.0 / 479001600.0;
+  p = p * r2 - 1.0 / 3628800.0;
+  p = p * r2 + 1.0 / 40320.0;
+  p = p * r2 - 1.0 / 720.0;
+  p = p * r2 + 1.0 / 24.0;
+  p = p * r2 - 0.5;
+  return 1.0 + r2 * p;
+}
+
+/*
+ * sin(x + quarter * pi/2) for |x| < 2^50 and quarter in {0, 1}: reduce
+ * x to r in [-pi/4, pi/4] plus a quadrant, then pick +-sin(r) or
+ * +-cos(r) with selects.
+ */
+static inline double sinQuadrant(double x, double quarter) {
+  double q = roundNearest(x * (2.0 / M_PI));
+  double r = (x - q * PIO2_HI) - q * PIO2_LO;
+  q += quarter;
+  double m = q - 4.0 * roundNearest(q * 0.25); /* m in {-2, -1, 0, 1, 2} */
+  double s = sinCore(r);
+  double c = cosCore(r);
+  double odd = fabs(m) == 1.0 ? c : s;
+  int negate = m == -1.0 || fabs(m) == 2.0;
+  return negate ? -odd : odd;
+}
+
+static inline double polySin(double x) {
+  return sinQuadrant(x, 0.0);
+}
+
+static inline double polyCos(double x) {
+  return sinQuadrant(x, 1.0);
+}
+
+/*
+ * acos(x) for x in [-1, 1] (Abramowitz & Stegun 4.4.46, error < 2e-8
+ * radians, i.e. under 0.13 m on the Earth's surface).
+ */
+static inline double polyAcos(double x) {
+  x = x > 1.0 ? 1.0 : x;
+  x = x < -1.0 ? -1.0 : x;
+  double ax = fabs(x);
+  double p = -0.0012624911;
+  p = p * ax + 0.0066700901;
+  p = p * ax - 0.0170881256;
+  p = p * ax + 0.0308918810;
+  p = p * ax - 0.0501743046;
+  p = p * ax + 0.0889789874;
+  p = p * ax - 0.2145988016;
+  p = p * ax + 1.5707963050;
+  double r = sqrt(1.0 - ax) * p;
+  return x < 0.0 ? M_PI - r : r;
+}
+
+/*
+ * asin(y) for y in [0, 1].  Small arguments (short distances) use the
+ * Taylor series through y^15, which keeps the result accurate relative
+ * to its size; larger ones use 4.4.46 through pi/2 - acos(y).
+ */
+static inline double polyAsin(double y) {
+  y = y > 1.0 ? 1.0 : y;
+  y = y < 0.0 ? 0.0 : y;
+  double y2 = y * y;
+  double t = 143.0 / 10240.0;
+  t = t * y2 + 231.0 / 13312.0;
+  t = t * y2 + 63.0 / 2816.0;
+  t = t * y2 + 35.0 / 1152.0;
+  t = t * y2 + 5.0 / 112.0;
+  t = t * y2 + 3.0 / 40.0;
+  t = t * y2 + 1.0 / 6.0;
+  double series = y + y * y2 * t;
+  double complement = HALF_PI - polyAcos(y);
+  return y < 0.25 ? series : complement;
+}
+
+void airDistanceMany(double originLat,
+                     double originLon,
+                     const double* restrict lats,
+                     const double* restrict lons,
+                     double* restrict out,
+                     size_t n) {
+  if (!lats || !lons || !out) return;
+  const double phi1 = originLat * DEG_TO_RAD;
+  const double sinPhi1 = sin(phi1);
+  const double cosPhi1 = cos(phi1);
+  for (size_t i = 0; i < n; i++) {
+    double phi2 = lats[i] * DEG_TO_RAD;
+    double deltaLambda = (lons[i] - originLon) * DEG_TO_RAD;
+    double cosval = sinPhi1 * polySin(phi2) +
+                    cosPhi1 * polyCos(phi2) * polyCos(deltaLambda);
+    out[i] = polyAcos(cosval) * EARTH_RADIUS_KM;
+  }
+}
+
+void haversineDistanceMany(double originLat,
+                           double originLon,
+                           const double* restrict lats,
+                           const double* restrict lons,
+                           double* restrict out,
+                           size_t n) {
+  if (!lats || !lons || !out) return;
+  const double phi1 = originLat * DEG_TO_RAD;
+  const double cosPhi1 = cos(phi1);
+  for (size_t i = 0; i < n; i++) {
+    double phi2 = lats[i] * DEG_TO_RAD;
+    double sinHalfDPhi = polySin((phi2 - phi1) * 0.5);
+    double sinHalfDLambda = polySin((lons[i] - originLon) * DEG_TO_RAD * 0.5);
+    double a = sinHalfDPhi * sinHalfDPhi +
+               cosPhi1 * polyCos(phi2) * sinHalfDLambda * sinHalfDLambda;
+    out[i] = 2.0 * EARTH_RADIUS_KM * polyAsin(sqrt(a));
+  }
+}
@@ -0,0 +1,49 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Batch great-circle distance kernels
+ *
+ * Description:
+ * Computes great-circle distances from one origin to many points at a
+ * time.  The kernels use branch-free polynomial sin/cos/acos/asin
+ * approximations so the compiler can vectorize the loops (SSE/AVX on
+ * x86-64, NEON on ARM) instead of calling scalar libm per point.
+ *
+ * NOTE: Coordinates are in degrees and distances in kilometers on a
+ * sphere of radius 6371 km.  airDistanceMany matches getAirDistance
+ * (spherical law of cosines) to within 1 meter; haversineDistanceMany
+ * has an absolute error under 1 meter and a relative error under 1e-9
+ * for points closer than about 3000 km.  On n == 0 or NULL arrays the
+ * functions do nothing.
+ */
+
+#ifndef HACK13_GEO_BATCH_H
+#define HACK13_GEO_BATCH_H
+
+#include <stddef.h>
+
+/**
+ * Writes the law-of-cosines distance from (originLat, originLon) to
+ * each (lats[i], lons[i]) into out[i] for i in [0, n).
+ */
+void airDistanceMany(double originLat,
+                     double originLon,
+                     const double* lats,
+                     const double* lons,
+                     double* out,
+                     size_t n);
+
+/**
+ * Writes the haversine distance from (originLat, originLon) to each
+ * (lats[i], lons[i]) into out[i] for i in [0, n).  Prefer this variant
+ * when short distances matter.
+ */
+void haversineDistanceMany(double originLat,
+                           double originLon,
+                           const double* lats,
+                           const double* lons,
+                           double* out,
+                           size_t n);
+
+#endif /* HACK13_GEO_BATCH_H */
@@ -28,6 +28,7 @@ int main(void) {
   initAirport(&airports[9], "KIXA", "one_strip", "Halifax-Northampton", 36.32979965, -77.63523102, 145, "Roanoke Rapids", "US");
 
   generateReports(airports, 10);
-  
+
+  freeAirports(airports, 10);
   return 0;
 }
@@ -28,5 +28,7 @@ int main(void) {
   initAirport(&airports[9], "KR-0515", "heli", "Cheonmi-ri South", 38.247439, 127.871211, 0, "Cheonmi-ri", "KR");
 
   generateReports(airports, 10);
+
+  freeAirports(airports, 10);
   return 0;
 }
@@ -28,5 +28,7 @@ int main(void) {
   initAirport(&airports[9], "ULKK", "medium_airport", "Kotlas Airport", 61.2358017, 46.69749832, 184, "Kotlas", "RU");
 
   generateReports(airports, 10);
+
+  freeAirports(airports, 10);
   return 0;
 }
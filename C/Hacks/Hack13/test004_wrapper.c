@@ -0,0 +1,42 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Test wrapper for the columnar AirportTable
+ *
+ * Description:
+ * Loads the airports of test case 001 into an AirportTable and runs
+ * generateReports over Airport views of the table.  The output must
+ * match test001_wrapper.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "airport.h"
+#include "airport_table.h"
+
+int main(void) {
+  AirportTable* table = createAirportTable(10, 0);
+  if (!table) {
+    fprintf(stderr, "createAirportTable failed\n");
+    return 1;
+  }
+
+  airportTableAdd(table, "OMA1", "normal", "Eppley Airfield", 41.3030, -95.8940, 150, "Omaha", "US");
+  airportTableAdd(table, "CHI0", "huge", "O'Hare", 41.9742, -87.9073, 125, "Chicago", "US");
+  airportTableAdd(table, "YYZA", "medium", "Pearson", 43.6, -79.6, 25, "Toronto", "CN");
+  airportTableAdd(table, "NYNY", "intl", "LaGuardia", 40.7769, -73.8740, 50, "New York", "US");
+  airportTableAdd(table, "YACS", "small_airport", "Acacia Downs", -31.41670036, 141.8999939, 0, "None", "AU");
+  airportTableAdd(table, "9TX0", "heliport", "Houston Police", 29.65660095, -95.32019806, 40, "Houston", "US");
+  airportTableAdd(table, "EDDH", "large_airport", "Hamburg Airport", 53.63040161, 9.988229752, 53, "Hamburg", "DE");
+  airportTableAdd(table, "99KS", "tiny", "Elm Creek", 37.40930176, -98.6493988, 1600, "Medicine Lodge", "US");
+  airportTableAdd(table, "26MA", "tiny_airport", "Pepperell Airport", 42.69620132, -71.55010223, 176, "Pepperell", "US");
+  airportTableAdd(table, "KIXA", "one_strip", "Halifax-Northampton", 36.32979965, -77.63523102, 145, "Roanoke Rapids", "US");
+
+  Airport views[10];
+  int n = airportTableViews(table, views);
+  generateReports(views, n);
+
+  freeAirportTable(table);
+  return 0;
+}
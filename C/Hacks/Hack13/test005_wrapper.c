@@ -0,0 +1,42 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Hack13 - Test wrapper for arena-backed airports
+ *
+ * Description:
+ * Builds the airports of test case 001 in an AirportArena and runs
+ * generateReports over them.  The output must match test001_wrapper,
+ * and the whole batch is released with one freeAirportArena call.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "airport.h"
+#include "airport_arena.h"
+
+int main(void) {
+  AirportArena* arena = createAirportArena(0);
+  Airport* airports = createAirportsInArena(arena, 10);
+  if (!airports) {
+    fprintf(stderr, "createAirportsInArena failed\n");
+    freeAirportArena(arena);
+    return 1;
+  }
+
+  initAirportInArena(arena, &airports[0], "OMA1", "normal", "Eppley Airfield", 41.3030, -95.8940, 150, "Omaha", "US");
+  initAirportInArena(arena, &airports[1], "CHI0", "huge", "O'Hare", 41.9742, -87.9073, 125, "Chicago", "US");
+  initAirportInArena(arena, &airports[2], "YYZA", "medium", "Pearson", 43.6, -79.6, 25, "Toronto", "CN");
+  initAirportInArena(arena, &airports[3], "NYNY", "intl", "LaGuardia", 40.7769, -73.8740, 50, "New York", "US");
+  initAirportInArena(arena, &airports[4], "YACS", "small_airport", "Acacia Downs", -31.41670036, 141.8999939, 0, "None", "AU");
+  initAirportInArena(arena, &airports[5], "9TX0", "heliport", "Houston Police", 29.65660095, -95.32019806, 40, "Houston", "US");
+  initAirportInArena(arena, &airports[6], "EDDH", "large_airport", "Hamburg Airport", 53.63040161, 9.988229752, 53, "Hamburg", "DE");
+  initAirportInArena(arena, &airports[7], "99KS", "tiny", "Elm Creek", 37.40930176, -98.6493988, 1600, "Medicine Lodge", "US");
+  initAirportInArena(arena, &airports[8], "26MA", "tiny_airport", "Pepperell Airport", 42.69620132, -71.55010223, 176, "Pepperell", "US");
+  initAirportInArena(arena, &airports[9], "KIXA", "one_strip", "Halifax-Northampton", 36.32979965, -77.63523102, 145, "Roanoke Rapids", "US");
+
+  generateReports(airports, 10);
+
+  freeAirportArena(arena);
+  return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Growable byte buffer
+ *
+ * Description:
+ * Implements the doubling byte buffer declared in byte_buffer.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "byte_buffer.h"
+
+/* Capacity of a buffer initialized without a hint. */
+#define DEFAULT_CAPACITY 4096
+
+/* Resizes the allocation to exactly cap bytes (cap > len). */
+static int resize(ByteBuffer *buffer, size_t cap) {
+    char *grown = realloc(buffer->ptr, cap);
+    if (!grown) return 0;
+    buffer->ptr = grown;
+    buffer->cap = cap;
+    return 1;
+}
+
+int initByteBuffer(ByteBuffer *buffer, size_t capacityHint) {
+    size_t cap = capacityHint ? capacityHint + 1 : DEFAULT_CAPACITY;
+    buffer->len = 0;
+    buffer->cap = 0;
+    buffer->ptr = malloc(cap);
+    if (!buffer->ptr) return 0;
+    buffer->cap = cap;
+    buffer->ptr[0] = '\0';
+    return 1;
+}
+
+int byteBufferReserve(ByteBuffer *buffer, size_t total) {
+    if (total == (size_t)-1) return 0;
+    if (total + 1 <= buffer->cap) return 1;
+    return resize(buffer, total + 1);
+}
+
+int byteBufferAppend(ByteBuffer *buffer, const void *bytes, size_t len) {
+    if (len > (size_t)-1 - buffer->len - 1) return 0;
+    size_t needed = buffer->len + len + 1;
+    if (needed > buffer->cap) {
+        size_t cap = buffer->cap ? buffer->cap : DEFAULT_CAPACITY;
+        while (cap < needed) {
+            cap = cap > (size_t)-1 / 2 ? needed : cap * 2;
+        }
+        if (!resize(buffer, cap)) return 0;
+    }
+    memcpy(buffer->ptr + buffer->len, bytes, len);
+    buffer->len += len;
+    buffer->ptr[buffer->len] = '\0';
+    return 1;
+}
+
+char *byteBufferRelease(ByteBuffer *buffer, size_t *len) {
+    char *contents = buffer->ptr;
+    if (len) *len = buffer->len;
+    buffer->ptr = NULL;
+    buffer->len = 0;
+    buffer->cap = 0;
+    return contents;
+}
+
+void freeByteBuffer(ByteBuffer *buffer) {
+    free(buffer->ptr);
+    buffer->ptr = NULL;
+    buffer->len = 0;
+    buffer->cap = 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Growable byte buffer
+ *
+ * Description:
+ * A growable, always NUL-terminated byte buffer for collecting data of
+ * unknown length (such as a cURL download).  Capacity doubles as it
+ * fills, so appending n bytes in any number of pieces costs O(n)
+ * copying and O(log n) reallocations, and the finished text can be
+ * handed to the caller without another copy.
+ *
+ * NOTE: shared by the earthquake_data and rss labs, whose makefiles
+ * build it from here (../common).
+ */
+
+#ifndef BYTE_BUFFER_H
+#define BYTE_BUFFER_H
+
+#include <stddef.h>
+
+typedef struct {
+    char *ptr;   /* the bytes, followed by a '\0' (malloc'd) */
+    size_t len;  /* bytes stored, not counting the '\0' */
+    size_t cap;  /* bytes allocated */
+} ByteBuffer;
+
+/**
+ * Initializes an empty buffer with room for at least
+ * <code>capacityHint</code> bytes (0 for a small default).  Returns 1 on
+ * success or 0 if memory could not be allocated.
+ */
+int initByteBuffer(ByteBuffer *buffer, size_t capacityHint);
+
+/**
+ * Makes room for the buffer to hold <code>total</code> bytes without
+ * reallocating, for example once a Content-Length is known.  Never
+ * shrinks the buffer.  Returns 1 on success or 0 on allocation failure
+ * (the buffer is unchanged).
+ */
+int byteBufferReserve(ByteBuffer *buffer, size_t total);
+
+/**
+ * Appends <code>len</code> bytes, at least doubling the capacity when
+ * they do not fit.  Returns 1 on success or 0 on allocation failure
+ * (the buffer is unchanged).
+ */
+int byteBufferAppend(ByteBuffer *buffer, const void *bytes, size_t len);
+
+/**
+ * Hands the NUL-terminated contents over to the caller, who must
+ * free() them, and stores their length in <code>*len</code> if
+ * <code>len</code> is not <code>NULL</code>.  The buffer is left empty
+ * and must be re-initialized before reuse.
+ */
+char *byteBufferRelease(ByteBuffer *buffer, size_t *len);
+
+/**
+ * Frees the contents of the buffer.
+ */
+void freeByteBuffer(ByteBuffer *buffer);
+
+#endif /* BYTE_BUFFER_H */
@@ -0,0 +1,139 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake batch arena benchmark
+ *
+ * Description:
+ * Counts heap allocations and times building n earthquakes two ways:
+ * one malloc'd array with initEarthquakeData (two string copies per
+ * record), and a batch whose strings go into its arena with
+ * initEarthquakeDataInBatch.  Also reports the allocations of a full
+ * parse, which builds a batch.  Both results must hold the same
+ * earthquakes.  Exits non-zero on a mismatch.
+ *
+ * Allocations are counted by wrapping malloc, calloc and realloc at
+ * link time (see the makefile), so only calls made by this lab's code
+ * are counted.
+ *
+ * Usage: arenaBench [numFeatures]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../earthquake.h"
+#include "../utils/geojson_stream.h"
+#include "bench_utils.h"
+
+static long allocations;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
+
+static EarthquakeData *buildEach(const EarthquakeData *source, int n) {
+    EarthquakeData *data = malloc(sizeof(EarthquakeData) * n);
+    for (int i = 0; data && i < n; i++) {
+        const EarthquakeData *s = &source[i];
+        initEarthquakeData(&data[i], s->id, s->locationName, s->magnitude, s->significance,
+                           s->timestamp, s->latitude, s->longitude, s->depth);
+    }
+    return data;
+}
+
+static EarthquakeData *buildBatch(const EarthquakeData *source, int n) {
+    EarthquakeData *data = createEarthquakeDataBatch(n);
+    for (int i = 0; data && i < n; i++) {
+        const EarthquakeData *s = &source[i];
+        if (!initEarthquakeDataInBatch(data, i, s->id, s->locationName, s->magnitude,
+                                       s->significance, s->timestamp, s->latitude,
+                                       s->longitude, s->depth)) {
+            freeEarthquakeDataBatch(data);
+            return NULL;
+        }
+    }
+    return data;
+}
+
+int main(int argc, char **argv) {
+    int features = argc > 1 ? atoi(argv[1]) : 200000;
+    if (features < 1) {
+        fprintf(stderr, "Usage: %s [numFeatures]\n", argv[0]);
+        return 1;
+    }
+    char *doc = makeSyntheticFeed(features);
+    size_t len = strlen(doc);
+    int n = 0;
+    allocations = 0;
+    double start = benchNow();
+    EarthquakeData *parsed = parseEarthquakeDataStream(doc, len, &n);
+    double parseSecs = benchNow() - start;
+    long parseAllocations = allocations;
+    free(doc);
+    if (!parsed) {
+        fprintf(stderr, "parse failed\n");
+        return 1;
+    }
+
+    printf("Earthquake batch arena (n = %d)\n", n);
+    printf("===============================\n");
+
+    int rounds = 5, failures = 0;
+    double eachBuild = 1e30, eachFree = 1e30, batchBuild = 1e30, batchFree = 1e30;
+    long eachAllocations = 0, batchAllocations = 0;
+    for (int r = 0; r < rounds; r++) {
+        allocations = 0;
+        start = benchNow();
+        EarthquakeData *each = buildEach(parsed, n);
+        double secs = benchNow() - start;
+        eachAllocations = allocations;
+        if (secs < eachBuild) eachBuild = secs;
+
+        allocations = 0;
+        start = benchNow();
+        EarthquakeData *batch = buildBatch(parsed, n);
+        secs = benchNow() - start;
+        batchAllocations = allocations;
+        if (secs < batchBuild) batchBuild = secs;
+
+        failures += !each || !batch || !sameEarthquakes(each, n, batch, n);
+
+        start = benchNow();
+        freeEarthquakes(each, n);
+        secs = benchNow() - start;
+        if (secs < eachFree) eachFree = secs;
+
+        start = benchNow();
+        freeEarthquakeDataBatch(batch);
+        secs = benchNow() - start;
+        if (secs < batchFree) batchFree = secs;
+    }
+
+    printf("initEarthquakeData        : %9ld allocations, build %7.2f ms, free %7.2f ms\n",
+           eachAllocations, eachBuild * 1e3, eachFree * 1e3);
+    printf("batch arena               : %9ld allocations, build %7.2f ms, free %7.2f ms\n",
+           batchAllocations, batchBuild * 1e3, batchFree * 1e3);
+    printf("full parse into a batch   : %9ld allocations, %7.2f ms\n",
+           parseAllocations, parseSecs * 1e3);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    freeEarthquakeDataBatch(parsed);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Benchmark helpers
+ *
+ * Description:
+ * Implements the shared benchmark helpers declared in bench_utils.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+
+#include "bench_utils.h"
+
+double benchNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void freeEarthquakes(EarthquakeData *data, int n) {
+    if (!data) return;
+    for (int i = 0; i < n; i++) {
+        free(data[i].id);
+        free(data[i].locationName);
+    }
+    free(data);
+}
+
+int sameEarthquakes(const EarthquakeData *a, int na, const EarthquakeData *b, int nb) {
+    if (!a || !b || na != nb) return 0;
+    for (int i = 0; i < na; i++) {
+        if (strcmp(a[i].id, b[i].id) != 0 ||
+            strcmp(a[i].locationName, b[i].locationName) != 0 ||
+            a[i].magnitude != b[i].magnitude ||
+            a[i].significance != b[i].significance ||
+            a[i].timestamp != b[i].timestamp ||
+            a[i].latitude != b[i].latitude ||
+            a[i].longitude != b[i].longitude ||
+            a[i].depth != b[i].depth) {
+            fprintf(stderr, "mismatch at feature %d (%s)\n", i, a[i].id);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Appends formatted text to a growing document. */
+static void appendf(char **doc, size_t *len, size_t *cap, const char *format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        int written = vsnprintf(*doc + *len, *cap - *len, format, args);
+        va_end(args);
+        if (written >= 0 && (size_t)written < *cap - *len) {
+            *len += (size_t)written;
+            return;
+        }
+        *cap *= 2;
+        *doc = realloc(*doc, *cap);
+    }
+}
+
+char *makeSyntheticFeed(int n) {
+    size_t cap = 1 << 20, len = 0;
+    char *doc = malloc(cap);
+    unsigned int state = 12345u;
+    appendf(&doc, &len, &cap,
+            "{\"type\":\"FeatureCollection\",\"metadata\":{\"generated\":1751485696000,"
+            "\"url\":\"https://earthquake.usgs.gov/earthquakes/feed/v1.0/summary/all_month.geojson\","
+            "\"title\":\"USGS All Earthquakes, Past Month\",\"status\":200,\"api\":\"1.14.1\","
+            "\"count\":%d},\"features\":[\n", n);
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        double mag = (state % 700) / 100.0 - 0.5;
+        int sig = (int)(state % 1000);
+        double lon = (state % 36000) / 100.0 - 180.0;
+        double lat = ((state >> 8) % 18000) / 100.0 - 90.0;
+        double depth = ((state >> 4) % 60000) / 100.0;
+        long time = 1751485191530L - i * 60000L;
+        const char *place = "12 km SE of Tehachapi, CA";
+        const char *mags = "";
+        char magText[32];
+        snprintf(magText, sizeof(magText), "%.2f", mag);
+        if (i % 97 == 5) place = "Cañada \\\"La Quiebra\\\", Peru \\u00e9\\ud83c\\udf0b\\n";
+        if (i % 101 == 7) mags = "null";
+        const char *placeValue = i % 89 == 3 ? "null" : NULL;
+        if (i % 113 == 11) {
+            /* geometry and id before properties, sig as a float, no place */
+            appendf(&doc, &len, &cap,
+                    "%s {\"id\":\"us%07d\",\"geometry\":{\"type\":\"Point\",\"coordinates\":"
+                    "[%.7f, %.7f ,%.2f]},\"type\":\"Feature\",\"properties\":{\"sig\":%d.0,"
+                    "\"mag\":%s,\"time\":%ld,\"nested\":{\"place\":\"decoy\",\"a\":[[1,2],{}]}}}",
+                    i ? "," : "", i, lon, lat, depth, sig, magText, time);
+            continue;
+        }
+        appendf(&doc, &len, &cap,
+                "%s{\"type\":\"Feature\",\"properties\":{\"mag\":%s,\"place\":",
+                i ? "," : "", *mags ? mags : magText);
+        if (placeValue) appendf(&doc, &len, &cap, "%s", placeValue);
+        else appendf(&doc, &len, &cap, "\"%s\"", place);
+        appendf(&doc, &len, &cap,
+                ",\"time\":%ld,\"updated\":%ld,\"tz\":null,"
+                "\"url\":\"https://earthquake.usgs.gov/earthquakes/eventpage/ci%08d\","
+                "\"detail\":\"https://earthquake.usgs.gov/earthquakes/feed/v1.0/detail/ci%08d.geojson\","
+                "\"felt\":null,\"cdi\":null,\"mmi\":null,\"alert\":null,\"status\":\"automatic\","
+                "\"tsunami\":0,\"sig\":%d,\"net\":\"ci\",\"code\":\"%08d\",\"ids\":\",ci%08d,\","
+                "\"sources\":\",ci,\",\"types\":\",nearby-cities,origin,phase-data,scitech-link,\","
+                "\"nst\":26,\"dmin\":0.07553,\"rms\":0.26,\"gap\":44,\"magType\":\"ml\","
+                "\"type\":\"earthquake\",\"title\":\"M %s - %s\"},"
+                "\"geometry\":{\"type\":\"Point\",\"coordinates\":[%.7f,%.7f,%.2f]},"
+                "\"id\":\"ci%08d\"}\n",
+                time, time + 444133, i, i, sig, i, i, magText, place, lon, lat, depth, i);
+    }
+    appendf(&doc, &len, &cap, "],\"bbox\":[-179.9,-62.5,-3.2,179.9,71.4,615.6]}\n");
+    return doc;
+}
+
+char *readFile(const char *path) {
+    FILE *in = fopen(path, "rb");
+    if (!in) return NULL;
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    rewind(in);
+    char *doc = malloc(size + 1);
+    if (doc && fread(doc, 1, size, in) != (size_t)size) {
+        free(doc);
+        doc = NULL;
+    }
+    if (doc) doc[size] = '\0';
+    fclose(in);
+    return doc;
+}
@@ -0,0 +1,49 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Benchmark helpers
+ *
+ * Description:
+ * Shared helpers for the earthquake_data benchmarks: a monotonic timer,
+ * a generator for reproducible synthetic USGS feeds and comparison of
+ * parsed earthquake arrays.
+ */
+
+#ifndef LAB11_BENCH_UTILS_H
+#define LAB11_BENCH_UTILS_H
+
+#include "../earthquake.h"
+
+/**
+ * Returns a monotonic wall-clock time in seconds.
+ */
+double benchNow(void);
+
+/**
+ * Builds a GeoJSON document of n features shaped like the USGS Summary
+ * format, with every property USGS sends.  A few features exercise
+ * escapes, nulls, missing members and reordered keys.  The same n
+ * always gives the same text.  Returns malloc'd text.
+ */
+char *makeSyntheticFeed(int n);
+
+/**
+ * Reads the whole file at path into a malloc'd NUL-terminated string,
+ * or returns NULL.
+ */
+char *readFile(const char *path);
+
+/**
+ * Returns 1 if the two arrays hold the same earthquakes (every field
+ * equal) and 0 otherwise, reporting the first difference on stderr.
+ */
+int sameEarthquakes(const EarthquakeData *a, int na, const EarthquakeData *b, int nb);
+
+/**
+ * Frees an array of earthquakes whose strings were malloc'd
+ * individually.  Safe to pass NULL.
+ */
+void freeEarthquakes(EarthquakeData *data, int n);
+
+#endif /* LAB11_BENCH_UTILS_H */
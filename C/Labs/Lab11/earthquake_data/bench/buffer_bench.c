@@ -0,0 +1,202 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Download buffer allocation benchmark
+ *
+ * Description:
+ * Downloads a 50 MB local fixture through a file:// URL twice: with the
+ * old exact-fit realloc write callback plus the strcpy in getContent,
+ * and with the current getContent (byte buffer, Content-Length
+ * reservation, no final copy).  The same bytes are also appended in
+ * 16 KB chunks without a length hint, as for a chunked HTTP response,
+ * with each way of growing the buffer.
+ * Counts the allocator calls and times each case, and checks every
+ * result matches the fixture.  Exits non-zero on a mismatch.
+ *
+ * NOTE: the counters replace malloc/calloc/realloc/free for the whole
+ * program and forward to glibc's __libc_* entry points, so cURL's own
+ * allocations are counted too (they are the same in every case).  On
+ * other C libraries only the timings are reported.
+ *
+ * Usage: bufferBench [megabytes]
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <curl/curl.h>
+
+#include "../utils/utils.h"
+#include "byte_buffer.h"
+#include "bench_utils.h"
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static size_t allocCalls = 0;
+static size_t reallocCalls = 0;
+
+void *malloc(size_t size) {
+    allocCalls++;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    allocCalls++;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    if (ptr) reallocCalls++;
+    else allocCalls++;
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr) {
+    __libc_free(ptr);
+}
+#define COUNTING 1
+#else
+static size_t allocCalls = 0;
+static size_t reallocCalls = 0;
+#define COUNTING 0
+#endif
+
+/* The write callback and buffer getContent used before the byte buffer. */
+struct string {
+    char *ptr;
+    size_t len;
+};
+
+static size_t exactFitWrite(void *ptr, size_t size, size_t nmemb, void *userdata) {
+    struct string *s = userdata;
+    size_t new_len = s->len + size * nmemb;
+    s->ptr = realloc(s->ptr, new_len + 1);
+    if (s->ptr == NULL) {
+        fprintf(stderr, "realloc() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(s->ptr + s->len, ptr, size * nmemb);
+    s->ptr[new_len] = '\0';
+    s->len = new_len;
+    return size * nmemb;
+}
+
+static char *exactFitGetContent(const char *url) {
+    char *result = NULL;
+    CURL *curl = curl_easy_init();
+    if (curl) {
+        struct string s = { malloc(1), 0 };
+        s.ptr[0] = '\0';
+        curl_easy_setopt(curl, CURLOPT_URL, url);
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, exactFitWrite);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &s);
+        curl_easy_perform(curl);
+        result = malloc(strlen(s.ptr) + 1);
+        strcpy(result, s.ptr);
+        free(s.ptr);
+        curl_easy_cleanup(curl);
+    }
+    return result;
+}
+
+typedef struct {
+    size_t allocs;
+    size_t reallocs;
+    double start;
+} Counters;
+
+static void startCounting(Counters *c) {
+    c->allocs = allocCalls;
+    c->reallocs = reallocCalls;
+    c->start = benchNow();
+}
+
+static void report(const char *label, const Counters *c) {
+    double secs = benchNow() - c->start;
+    printf("%-32s: %6zu mallocs %6zu reallocs %8.2f ms\n", label,
+           allocCalls - c->allocs, reallocCalls - c->reallocs, secs * 1e3);
+}
+
+int main(int argc, char **argv) {
+    size_t megabytes = argc > 1 ? (size_t)atoi(argv[1]) : 50;
+    if (megabytes < 1) {
+        fprintf(stderr, "Usage: %s [megabytes]\n", argv[0]);
+        return 1;
+    }
+    size_t size = megabytes * 1000 * 1000;
+
+    /* a fixture of JSON-looking text (content does not matter here) */
+    char *fixture = malloc(size + 1);
+    static const char line[] =
+        "{\"type\":\"Feature\",\"properties\":{\"mag\":1.28,\"place\":\"12 km SE of Tehachapi, CA\"},"
+        "\"id\":\"ci41012799\"},\n";
+    for (size_t i = 0; i < size; i++) fixture[i] = line[i % (sizeof(line) - 1)];
+    fixture[size] = '\0';
+
+    char path[] = "/tmp/bufferBenchXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0 || write(fd, fixture, size) != (ssize_t)size) {
+        perror("fixture");
+        return 1;
+    }
+    close(fd);
+    char url[64];
+    snprintf(url, sizeof(url), "file://%s", path);
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    printf("Download buffers (%zu MB fixture via %s)\n", megabytes, url);
+    printf("=====================================================\n");
+    if (!COUNTING) printf("(allocation counts unavailable on this C library)\n");
+    int failures = 0;
+    Counters c;
+
+    startCounting(&c);
+    char *old = exactFitGetContent(url);
+    report("exact-fit realloc + strcpy", &c);
+    failures += !old || strcmp(old, fixture) != 0;
+    free(old);
+
+    startCounting(&c);
+    char *fresh = getContent(url);
+    report("byte buffer, Content-Length", &c);
+    failures += !fresh || strcmp(fresh, fixture) != 0;
+    free(fresh);
+
+    /* no length hint: 16 KB pieces, as from a chunked response */
+    startCounting(&c);
+    struct string s = { malloc(1), 0 };
+    for (size_t at = 0; at < size; at += 16384) {
+        exactFitWrite(fixture + at, 1, size - at < 16384 ? size - at : 16384, &s);
+    }
+    report("exact-fit, no hint (16 KB)", &c);
+    failures += s.len != size || memcmp(s.ptr, fixture, size + 1) != 0;
+    free(s.ptr);
+
+    startCounting(&c);
+    ByteBuffer buffer;
+    int ok = initByteBuffer(&buffer, 0);
+    for (size_t at = 0; ok && at < size; at += 16384) {
+        size_t chunk = size - at < 16384 ? size - at : 16384;
+        ok = byteBufferAppend(&buffer, fixture + at, chunk);
+    }
+    size_t len = 0;
+    char *chunked = byteBufferRelease(&buffer, &len);
+    report("byte buffer, no hint (16 KB)", &c);
+    failures += !ok || len != size || memcmp(chunked, fixture, size + 1) != 0;
+    free(chunked);
+
+    printf("correctness checks              : %s\n", failures ? "FAILED" : "passed");
+
+    unlink(path);
+    free(fixture);
+    curl_global_cleanup();
+    return failures ? 1 : 0;
+}
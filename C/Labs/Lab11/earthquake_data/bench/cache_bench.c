@@ -0,0 +1,108 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Columnar cache benchmark
+ *
+ * Description:
+ * Compares the two ways earthquakeReport can start up without the
+ * network: parsing the saved GeoJSON feed, and mapping the binary cache
+ * written from it.  Checks that the cache round-trips every field, that
+ * the freshness check follows the fetch time, and that caches for
+ * another source, from another version or truncated are rejected.
+ * Exits non-zero on a failure.
+ *
+ * Usage: cacheBench [numFeatures]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../earthquake.h"
+#include "../utils/geojson_stream.h"
+#include "../utils/earthquake_cache.h"
+#include "bench_utils.h"
+
+static const char *SOURCE = "https://earthquake.usgs.gov/earthquakes/feed/v1.0/summary/all_month.geojson";
+
+/* Overwrites size bytes at offset of the file at path. */
+static void patchFile(const char *path, long offset, const void *bytes, size_t size) {
+    FILE *f = fopen(path, "r+b");
+    fseek(f, offset, SEEK_SET);
+    fwrite(bytes, 1, size, f);
+    fclose(f);
+}
+
+int main(int argc, char **argv) {
+    int features = argc > 1 ? atoi(argv[1]) : 60000;
+    if (features < 1) {
+        fprintf(stderr, "Usage: %s [numFeatures]\n", argv[0]);
+        return 1;
+    }
+    char *doc = makeSyntheticFeed(features);
+    size_t len = strlen(doc);
+    char path[] = "/tmp/cacheBenchXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+    int failures = 0;
+
+    printf("Earthquake cache (%d features, %.1f MB of GeoJSON)\n", features, len / 1e6);
+    printf("=================================================\n");
+
+    double start = benchNow();
+    int n = 0;
+    EarthquakeData *parsed = parseEarthquakeDataStream(doc, len, &n);
+    double parseSecs = benchNow() - start;
+
+    start = benchNow();
+    failures += !writeEarthquakeCache(path, SOURCE, time(NULL), parsed, n);
+    double writeSecs = benchNow() - start;
+
+    /* what earthquakeReport does on a fresh cache */
+    start = benchNow();
+    int fresh = earthquakeCacheIsFresh(path, SOURCE, 60);
+    EarthquakeCache *cache = openEarthquakeCache(path, SOURCE);
+    EarthquakeData *rows = earthquakeCacheRows(cache);
+    double loadSecs = benchNow() - start;
+
+    failures += !fresh || !cache || !rows || !sameEarthquakes(parsed, n, rows, cache ? cache->n : 0);
+    long cacheBytes = cache ? (long)cache->mapBytes : 0;
+    free(rows);
+    closeEarthquakeCache(cache);
+
+    /* staleness, other sources and damaged files */
+    failures += earthquakeCacheIsFresh(path, SOURCE, 0);
+    failures += earthquakeCacheIsFresh(path, "file:///other.geojson", 60);
+    failures += openEarthquakeCache(path, "file:///other.geojson") != NULL;
+    failures += !writeEarthquakeCache(path, SOURCE, time(NULL) - 120, parsed, n) ||
+                earthquakeCacheIsFresh(path, SOURCE, 60) || !earthquakeCacheIsFresh(path, SOURCE, 300);
+    unsigned int version = EARTHQUAKE_CACHE_VERSION + 1;
+    patchFile(path, 8, &version, sizeof(version));
+    failures += openEarthquakeCache(path, SOURCE) != NULL || earthquakeCacheIsFresh(path, SOURCE, 300);
+    failures += !writeEarthquakeCache(path, SOURCE, time(NULL), parsed, n) ||
+                truncate(path, cacheBytes - 1) != 0 || openEarthquakeCache(path, SOURCE) != NULL;
+
+    /* an empty feed round-trips too */
+    failures += !writeEarthquakeCache(path, SOURCE, time(NULL), NULL, 0);
+    cache = openEarthquakeCache(path, SOURCE);
+    failures += !cache || cache->n != 0;
+    closeEarthquakeCache(cache);
+
+    printf("parse GeoJSON             : %9.2f ms\n", parseSecs * 1e3);
+    printf("write cache               : %9.2f ms (%.1f MB)\n", writeSecs * 1e3, cacheBytes / 1e6);
+    printf("check + map + rows        : %9.2f ms (%.0fx faster than parsing)\n",
+           loadSecs * 1e3, parseSecs / loadSecs);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    unlink(path);
+    freeEarthquakeDataBatch(parsed);
+    free(doc);
+    return failures ? 1 : 0;
+}
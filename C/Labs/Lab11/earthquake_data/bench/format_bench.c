@@ -0,0 +1,224 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake formatting benchmark
+ *
+ * Description:
+ * Times formatting and printing a large synthetic array of earthquakes:
+ * the old formatter (gmtime + strftime + snprintf + a heap copy per
+ * row) against earthquakeDataFormat with a day cache, and
+ * earthquakeDataPrintAll against writing the same bytes already
+ * formatted to a temporary file.  That write is the I/O floor; printing
+ * stays a few times above it, since every number is still rounded
+ * exactly as printf rounds it.  Every row must format exactly like the
+ * old code, as must timestamps around day, year and century boundaries
+ * and before 1970, and numbers on rounding ties.  Exits non-zero on a
+ * mismatch.
+ *
+ * Usage: formatBench [numRows]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "../earthquake.h"
+#include "bench_utils.h"
+
+/* earthquakeDataToString as it was before the formatter. */
+static char *oldToString(const EarthquakeData *data) {
+    time_t timestamp_s = data->timestamp / 1000;
+    struct tm *timeinfo = gmtime(&timestamp_s);
+    char time_str[30];
+    strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S UTC", timeinfo);
+    char buffer[512];
+    snprintf(buffer, sizeof(buffer), "%-15s %-39s %4.1f (%3d) %24s   (%7.2f, %7.2f) %6.2fkm",
+             data->id ? data->id : "", data->locationName ? data->locationName : "",
+             data->magnitude, data->significance, time_str,
+             data->latitude, data->longitude, data->depth);
+    char *result = malloc(strlen(buffer) + 1);
+    strcpy(result, buffer);
+    return result;
+}
+
+/* Points stdout at a new temporary file; returns the saved descriptor. */
+static int redirectStdout(void) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    FILE *sink = tmpfile();
+    if (sink) {
+        dup2(fileno(sink), STDOUT_FILENO);
+        fclose(sink);  /* the file lives on through stdout's descriptor */
+    }
+    return saved;
+}
+
+static void restoreStdout(int saved) {
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+/* Timestamps (ms) that the day cache and calendar math must get right. */
+static int checkEdges(void) {
+    static const long edges[] = {
+        0L, -1L, -999L, -1000L, -1001L, -86400000L, -86401000L, 86399999L, 86400000L,
+        951782400000L,   /* 2000-02-29 */
+        951868799000L,   /* 2000-02-29 23:59:59 */
+        4107542400000L,  /* 2100-03-01 */
+        4107455999000L,  /* 2100-02-28 23:59:59 */
+        1751485191530L, 253402300799000L, 253402300800000L,  /* last second of 9999, then 10000 */
+        -30610224000000L, -30610224001000L,                 /* 1000-01-01, then 999 */
+        -2208988800000L, -62135596800000L,
+    };
+    int failures = 0;
+    TimestampCache cache = { 0, 0, "" };
+    EarthquakeData row = { "edge", "Somewhere, CA", 1.25, 7, 0, 40.005, -96.125, 0.125 };
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+            row.timestamp = edges[i];
+            char *want = oldToString(&row);
+            char got[EARTHQUAKE_DATA_STRING_SIZE];
+            earthquakeDataFormat(&row, pass ? &cache : NULL, got, sizeof(got));
+            if (strcmp(want, got) != 0) {
+                fprintf(stderr, "mismatch at %ld:\n  %s\n  %s\n", edges[i], want, got);
+                failures++;
+            }
+            free(want);
+        }
+    }
+
+    /* rounding ties, negative zero and values printf must handle itself */
+    static const double values[] = {
+        -0.004, -0.0, 0.05, 0.15, 0.25, 0.35, 2.675, 1.005, 1.015, 999.995, -12.345,
+        -0.05, 0.949999, 9.95, 99.995, 1e10, -1e12, 123456.785, NAN, INFINITY, -INFINITY,
+    };
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        row.magnitude = row.latitude = values[i];
+        row.longitude = -values[i];
+        row.depth = values[i] * 10;
+        char *want = oldToString(&row);
+        char got[EARTHQUAKE_DATA_STRING_SIZE];
+        earthquakeDataFormat(&row, NULL, got, sizeof(got));
+        if (strcmp(want, got) != 0) {
+            fprintf(stderr, "mismatch at %g:\n  %s\n  %s\n", values[i], want, got);
+            failures++;
+        }
+        free(want);
+    }
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (n < 1) {
+        fprintf(stderr, "Usage: %s [numRows]\n", argv[0]);
+        return 1;
+    }
+
+    /* a dump in time order: a few seconds between events, so many share a day */
+    static char ids[64][16];
+    static char places[64][48];
+    for (int i = 0; i < 64; i++) {
+        snprintf(ids[i], sizeof(ids[i]), "us7000%04d", i * 37);
+        snprintf(places[i], sizeof(places[i]), "%d km NE of Town %d, Alaska", i % 40, i);
+    }
+    EarthquakeData *data = malloc(sizeof(EarthquakeData) * n);
+    if (!data) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+    unsigned int state = 7u;
+    long time = 1600000000000L;
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        time += (state >> 8) % 9000;
+        data[i].id = ids[i % 64];
+        data[i].locationName = places[(state >> 4) % 64];
+        data[i].magnitude = ((state >> 5) % 900) / 100.0 - 1.0;
+        data[i].significance = (state >> 3) % 1000;
+        data[i].timestamp = time;
+        data[i].latitude = ((state >> 6) % 18000) / 100.0 - 90.0;
+        data[i].longitude = ((state >> 10) % 36000) / 100.0 - 180.0;
+        data[i].depth = (state % 7000) / 100.0;
+    }
+
+    printf("Earthquake formatting (n = %d)\n", n);
+    printf("==============================\n");
+
+    int failures = checkEdges();
+    TimestampCache cache = { 0, 0, "" };
+    char line[EARTHQUAKE_DATA_STRING_SIZE];
+    for (int i = 0; i < n; i++) {
+        char *want = oldToString(&data[i]);
+        earthquakeDataFormat(&data[i], &cache, line, sizeof(line));
+        failures += strcmp(want, line) != 0;
+        free(want);
+    }
+
+    volatile size_t sink = 0;
+    double start = benchNow();
+    for (int i = 0; i < n; i++) {
+        char *str = oldToString(&data[i]);
+        sink += str[0];
+        free(str);
+    }
+    double oldSecs = benchNow() - start;
+
+    memset(&cache, 0, sizeof(cache));
+    start = benchNow();
+    for (int i = 0; i < n; i++) {
+        sink += (size_t)earthquakeDataFormat(&data[i], &cache, line, sizeof(line));
+    }
+    double newSecs = benchNow() - start;
+
+    /* printing: old per-row path, earthquakeDataPrintAll, and the bytes alone */
+    size_t total = 0;
+    char *text = malloc((size_t)n * 160);
+    for (int i = 0; text && i < n; i++) {
+        int len = earthquakeDataFormat(&data[i], NULL, text + total, 159);
+        text[total + len] = '\n';
+        total += (size_t)len + 1;
+    }
+    int saved = redirectStdout();
+    start = benchNow();
+    for (int i = 0; i < n; i++) {
+        char *str = oldToString(&data[i]);
+        printf("%s\n", str);
+        free(str);
+    }
+    fflush(stdout);
+    double oldPrintSecs = benchNow() - start;
+    restoreStdout(saved);
+
+    saved = redirectStdout();
+    start = benchNow();
+    earthquakeDataPrintAll(data, n);
+    fflush(stdout);
+    double printSecs = benchNow() - start;
+    restoreStdout(saved);
+
+    saved = redirectStdout();
+    start = benchNow();
+    if (text) fwrite(text, 1, total, stdout);
+    fflush(stdout);
+    double writeSecs = benchNow() - start;
+    restoreStdout(saved);
+
+    printf("old format (strftime+heap): %8.1f ns/row\n", oldSecs / n * 1e9);
+    printf("earthquakeDataFormat      : %8.1f ns/row (%.1fx)\n",
+           newSecs / n * 1e9, oldSecs / newSecs);
+    printf("print, old per-row path   : %8.1f ms\n", oldPrintSecs * 1e3);
+    printf("earthquakeDataPrintAll    : %8.1f ms\n", printSecs * 1e3);
+    printf("write preformatted bytes  : %8.1f ms (%.1f MB to a temporary file)\n",
+           writeSecs * 1e3, total / 1e6);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    free(text);
+    free(data);
+    return failures ? 1 : 0;
+}
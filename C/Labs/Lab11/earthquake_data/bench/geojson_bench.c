@@ -0,0 +1,170 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Streaming GeoJSON parser benchmark
+ *
+ * Description:
+ * Times the streaming GeoJSON parser against the previous json-c DOM
+ * parser on a synthetic USGS feed (or a saved feed given on the command
+ * line) and checks that both produce the same earthquakes.  The
+ * document is also fed one byte at a time and in random chunk sizes,
+ * and a few malformed documents must be rejected.  Exits non-zero on a
+ * mismatch.
+ *
+ * Usage: geojsonBench [numFeatures | feed.geojson]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <json.h>
+
+#include "../earthquake.h"
+#include "../utils/geojson_stream.h"
+#include "bench_utils.h"
+
+/* The json-c parser parseEarthquakeData used before the streaming one,
+ * except that it sizes the array by the features actually present. */
+static EarthquakeData *parseWithJsonC(const char *json, int *n) {
+    struct json_object *data = json_tokener_parse(json);
+    struct json_object *features = json_object_object_get(data, "features");
+    int length = (int)json_object_array_length(features);
+    EarthquakeData *result = malloc(sizeof(EarthquakeData) * (length ? length : 1));
+    for (int i = 0; i < length; i++) {
+        struct json_object *feature = json_object_array_get_idx(features, i);
+        struct json_object *properties = json_object_object_get(feature, "properties");
+        struct json_object *coordinates = json_object_object_get(
+            json_object_object_get(feature, "geometry"), "coordinates");
+        initEarthquakeData(&result[i],
+            json_object_get_string(json_object_object_get(feature, "id")),
+            json_object_get_string(json_object_object_get(properties, "place")),
+            json_object_get_double(json_object_object_get(properties, "mag")),
+            json_object_get_int(json_object_object_get(properties, "sig")),
+            json_object_get_int64(json_object_object_get(properties, "time")),
+            json_object_get_double(json_object_array_get_idx(coordinates, 1)),
+            json_object_get_double(json_object_array_get_idx(coordinates, 0)),
+            json_object_get_double(json_object_array_get_idx(coordinates, 2)));
+    }
+    json_object_put(data);
+    *n = length;
+    return result;
+}
+
+/* Parses doc in chunks of at most maxChunk bytes (random sizes when
+ * maxChunk > 1). */
+static EarthquakeData *parseInChunks(const char *doc, size_t len, size_t maxChunk, int *n) {
+    GeoJsonParser *parser = createGeoJsonParser();
+    unsigned int state = 99u;
+    size_t at = 0;
+    int ok = 1;
+    while (ok && at < len) {
+        state = state * 1103515245u + 12345u;
+        size_t chunk = maxChunk > 1 ? 1 + (state >> 8) % maxChunk : 1;
+        if (chunk > len - at) chunk = len - at;
+        ok = geoJsonParserFeed(parser, doc + at, chunk);
+        at += chunk;
+    }
+    EarthquakeData *result = geoJsonParserFinish(parser, n);
+    freeGeoJsonParser(parser);
+    return result;
+}
+
+/* Malformed documents must all be rejected. */
+static int checkMalformed(void) {
+    static const char *bad[] = {
+        "",
+        "[]",
+        "{\"features\":[{\"id\":\"a\"}]",
+        "{\"features\":[{\"id\":\"a\"}]]",
+        "{\"features\":[{\"id\":\"a\",}]}",
+        "{\"features\":[{\"id\":\"a\\q\"}]}",
+        "{\"features\":[{\"properties\":{\"mag\":1.2.3}}]}",
+        "{\"features\":[{\"properties\":{\"mag\":nope}}]}",
+        "{\"features\":[]} x",
+        "{\"features\" [] }",
+    };
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        int n = -1;
+        EarthquakeData *result = parseEarthquakeDataStream(bad[i], strlen(bad[i]), &n);
+        if (result || n != 0) {
+            fprintf(stderr, "accepted malformed document: %s\n", bad[i]);
+            freeEarthquakeDataBatch(result);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    char *doc;
+    const char *source;
+    char label[64];
+    if (argc > 1 && atoi(argv[1]) <= 0) {
+        doc = readFile(argv[1]);
+        source = argv[1];
+    } else {
+        int features = argc > 1 ? atoi(argv[1]) : 12000;
+        doc = makeSyntheticFeed(features);
+        snprintf(label, sizeof(label), "synthetic, %d features", features);
+        source = label;
+    }
+    if (!doc) {
+        fprintf(stderr, "Usage: %s [numFeatures | feed.geojson]\n", argv[0]);
+        return 1;
+    }
+    size_t len = strlen(doc);
+    int failures = 0;
+
+    printf("Streaming GeoJSON parser (%s, %.1f MB)\n", source, len / 1e6);
+    printf("=============================================\n");
+
+    int rounds = 5;
+    int nOld = 0, nNew = 0;
+    EarthquakeData *old = NULL, *fresh = NULL;
+    double best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        if (old) freeEarthquakes(old, nOld);
+        double start = benchNow();
+        old = parseWithJsonC(doc, &nOld);
+        double secs = benchNow() - start;
+        if (secs < best) best = secs;
+    }
+    double oldSecs = best;
+    best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        if (fresh) freeEarthquakeDataBatch(fresh);
+        double start = benchNow();
+        fresh = parseEarthquakeDataStream(doc, len, &nNew);
+        double secs = benchNow() - start;
+        if (secs < best) best = secs;
+    }
+    double newSecs = best;
+    failures += !sameEarthquakes(old, nOld, fresh, nNew);
+
+    int nChunked = 0;
+    EarthquakeData *chunked = parseInChunks(doc, len, 1, &nChunked);
+    failures += !sameEarthquakes(fresh, nNew, chunked, nChunked);
+    freeEarthquakeDataBatch(chunked);
+    chunked = parseInChunks(doc, len, 4096, &nChunked);
+    failures += !sameEarthquakes(fresh, nNew, chunked, nChunked);
+    freeEarthquakeDataBatch(chunked);
+
+    /* every proper prefix is an incomplete document */
+    int nPrefix = -1;
+    EarthquakeData *prefix = parseEarthquakeDataStream(doc, len / 2, &nPrefix);
+    failures += prefix != NULL || nPrefix != 0;
+    failures += checkMalformed();
+
+    printf("features                  : %9d\n", nNew);
+    printf("json-c DOM parse          : %9.2f ms (%6.1f MB/s)\n", oldSecs * 1e3, len / oldSecs / 1e6);
+    printf("streaming parse           : %9.2f ms (%6.1f MB/s, %.1fx)\n",
+           newSecs * 1e3, len / newSecs / 1e6, oldSecs / newSecs);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    freeEarthquakes(old, nOld);
+    freeEarthquakeDataBatch(fresh);
+    free(doc);
+    return failures ? 1 : 0;
+}
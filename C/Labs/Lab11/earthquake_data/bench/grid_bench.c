@@ -0,0 +1,208 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake grid benchmark
+ *
+ * Description:
+ * Builds the lat/lon grid over a synthetic feed and times radius and
+ * k-nearest queries for a few hundred "cities", spread out and
+ * clustered, against full scans with airDistance.  Every answer is checked against
+ * the scan, including points at the poles and on the antimeridian.
+ * Exits non-zero on a mismatch.
+ *
+ * Usage: gridBench [numFeatures]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "../earthquake.h"
+#include "../utils/geojson_stream.h"
+#include "../utils/earthquake_grid.h"
+#include "bench_utils.h"
+
+typedef struct {
+    int row;
+    double distance;
+} Hit;
+
+static int compareHit(const void *a, const void *b) {
+    const Hit *x = a, *y = b;
+    if (x->distance != y->distance) return x->distance < y->distance ? -1 : 1;
+    return x->row - y->row;
+}
+
+/* Every earthquake within radiusKm, nearest first; returns the count. */
+static int scanRadius(const EarthquakeData *data, int n, double lat, double lon,
+                      double radiusKm, Hit *hits) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        double d = airDistance(lat, lon, data[i].latitude, data[i].longitude);
+        if (isnan(d)) d = 0.0;  /* acos just past 1 for identical points */
+        if (d <= radiusKm) {
+            hits[count].row = i;
+            hits[count].distance = d;
+            count++;
+        }
+    }
+    qsort(hits, count, sizeof(Hit), compareHit);
+    return count;
+}
+
+/* Every earthquake sorted by distance; the first k are the nearest. */
+static void scanAll(const EarthquakeData *data, int n, double lat, double lon, Hit *hits) {
+    scanRadius(data, n, lat, lon, 1e9, hits);
+}
+
+static int sameHits(const Hit *hits, const int *rows, const double *distances, int count) {
+    for (int i = 0; i < count; i++) {
+        if (hits[i].row != rows[i] || hits[i].distance != distances[i]) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    int features = argc > 1 ? atoi(argv[1]) : 60000;
+    if (features < 1) {
+        fprintf(stderr, "Usage: %s [numFeatures]\n", argv[0]);
+        return 1;
+    }
+    char *doc = makeSyntheticFeed(features);
+    int n = 0;
+    EarthquakeData *data = parseEarthquakeDataStream(doc, strlen(doc), &n);
+    free(doc);
+
+    /* Lincoln, the poles, both sides of the antimeridian, then random cities */
+    int cities = 400;
+    double *lats = malloc(sizeof(double) * cities);
+    double *lons = malloc(sizeof(double) * cities);
+    Hit *hits = malloc(sizeof(Hit) * (n + 1));
+    int *rows = malloc(sizeof(int) * (n + 1));
+    double *distances = malloc(sizeof(double) * (n + 1));
+    if (!data || !lats || !lons || !hits || !rows || !distances) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+    double fixed[][2] = { { 40.8136, -96.7026 }, { 90.0, 0.0 }, { -90.0, 45.0 },
+                          { 0.0, 179.95 }, { -12.5, -180.0 }, { 89.4, 180.0 } };
+    int numFixed = sizeof(fixed) / sizeof(fixed[0]);
+    unsigned int state = 29u;
+    for (int q = 0; q < cities; q++) {
+        state = state * 1103515245u + 12345u;
+        lats[q] = q < numFixed ? fixed[q][0] : ((state >> 4) % 17000) / 100.0 - 85.0;
+        lons[q] = q < numFixed ? fixed[q][1] : ((state >> 12) % 36000) / 100.0 - 180.0;
+    }
+    /* a city on top of an earthquake, so a zero distance is exercised */
+    lats[numFixed] = data[0].latitude;
+    lons[numFixed] = data[0].longitude;
+
+    printf("Earthquake grid (n = %d, %d cities)\n", n, cities);
+    printf("===================================\n");
+
+    double start = benchNow();
+    EarthquakeGrid *grid = createEarthquakeGrid(data, n);
+    double buildSecs = benchNow() - start;
+    if (!grid) {
+        fprintf(stderr, "createEarthquakeGrid failed\n");
+        return 1;
+    }
+
+    double radius = 500.0;
+    int k = 10, failures = 0;
+    for (int q = 0; q < cities; q += 5) {
+        int want = scanRadius(data, n, lats[q], lons[q], radius, hits);
+        int got = earthquakeGridRadius(grid, lats[q], lons[q], radius, rows, distances, n);
+        failures += got != want || !sameHits(hits, rows, distances, got);
+
+        scanAll(data, n, lats[q], lons[q], hits);
+        want = k < n ? k : n;
+        got = earthquakeGridNearest(grid, lats[q], lons[q], k, rows, distances);
+        failures += got != want || !sameHits(hits, rows, distances, got);
+    }
+    /* radii reaching across a pole and around the whole sphere */
+    for (int q = 0; q < numFixed; q++) {
+        double big[] = { 0.0, 2500.0, 15000.0, 21000.0 };
+        for (int r = 0; r < 4; r++) {
+            int want = scanRadius(data, n, lats[q], lons[q], big[r], hits);
+            int got = earthquakeGridRadius(grid, lats[q], lons[q], big[r], rows, distances, n);
+            failures += got != want || !sameHits(hits, rows, distances, got);
+        }
+    }
+    failures += earthquakeGridNearest(grid, 0.0, 0.0, n + 5, rows, distances) != n;
+
+    /* a cluster of cities around Lincoln whose caps share cells */
+    double *nearLats = malloc(sizeof(double) * cities);
+    double *nearLons = malloc(sizeof(double) * cities);
+    for (int q = 0; q < cities; q++) {
+        state = state * 1103515245u + 12345u;
+        nearLats[q] = 36.0 + ((state >> 4) % 1000) / 100.0;
+        nearLons[q] = -102.0 + ((state >> 12) % 1000) / 100.0;
+        int want = scanRadius(data, n, nearLats[q], nearLons[q], radius, hits);
+        int got = earthquakeGridRadius(grid, nearLats[q], nearLons[q], radius, rows, distances, n);
+        failures += got != want || !sameHits(hits, rows, distances, got);
+    }
+    double loopMillis[2];
+    for (int set = 0; set < 2; set++) {
+        const double *setLats = set ? nearLats : lats, *setLons = set ? nearLons : lons;
+        /* best of a few runs */
+        loopMillis[set] = 1e30;
+        for (int r = 0; r < 5; r++) {
+            start = benchNow();
+            for (int q = 0; q < cities; q++) {
+                earthquakeGridRadius(grid, setLats[q], setLons[q], radius, rows, distances, n);
+            }
+            double millis = (benchNow() - start) * 1e3;
+            if (millis < loopMillis[set]) loopMillis[set] = millis;
+        }
+    }
+
+    volatile long sink = 0;
+    start = benchNow();
+    for (int q = 0; q < cities; q++) {
+        sink += earthquakeGridRadius(grid, lats[q], lons[q], radius, rows, distances, n);
+    }
+    double radiusMicros = (benchNow() - start) / cities * 1e6;
+
+    start = benchNow();
+    for (int q = 0; q < cities; q++) {
+        sink += earthquakeGridNearest(grid, lats[q], lons[q], k, rows, distances);
+    }
+    double nearestMicros = (benchNow() - start) / cities * 1e6;
+
+    int scans = 50;
+    start = benchNow();
+    for (int q = 0; q < scans; q++) {
+        sink += scanRadius(data, n, lats[q], lons[q], radius, hits);
+    }
+    double scanMicros = (benchNow() - start) / scans * 1e6;
+
+    start = benchNow();
+    for (int q = 0; q < scans; q++) {
+        scanAll(data, n, lats[q], lons[q], hits);
+        sink += hits[0].row;
+    }
+    double scanAllMicros = (benchNow() - start) / scans * 1e6;
+
+    printf("build                     : %9.2f ms\n", buildSecs * 1e3);
+    printf("within %.0f km            : %9.2f us (scan %9.2f us, %.0fx)\n",
+           radius, radiusMicros, scanMicros, scanMicros / radiusMicros);
+    printf("%d nearest                : %9.2f us (scan+sort %9.2f us, %.0fx)\n",
+           k, nearestMicros, scanAllMicros, scanAllMicros / nearestMicros);
+    printf("%d spread cities         : %9.2f ms\n", cities, loopMillis[0]);
+    printf("%d nearby cities         : %9.2f ms\n", cities, loopMillis[1]);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    freeEarthquakeGrid(grid);
+    free(nearLons);
+    free(nearLats);
+    free(distances);
+    free(rows);
+    free(hits);
+    free(lons);
+    free(lats);
+    freeEarthquakeDataBatch(data);
+    return failures ? 1 : 0;
+}
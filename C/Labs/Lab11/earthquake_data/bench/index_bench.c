@@ -0,0 +1,187 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake index benchmark
+ *
+ * Description:
+ * Builds the time/magnitude index over a synthetic feed and times
+ * windowed magnitude queries, histograms and top-k significance
+ * queries against linear scans of the array.  Every answer is checked
+ * against the scan.  Exits non-zero on a mismatch.
+ *
+ * Usage: indexBench [numFeatures]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "../earthquake.h"
+#include "../utils/geojson_stream.h"
+#include "../utils/earthquake_index.h"
+#include "bench_utils.h"
+
+static const EarthquakeData *scanData;
+
+static int compareInt(const void *a, const void *b) {
+    return *(const int *)a - *(const int *)b;
+}
+
+/* Most significant first, then earlier, then lower row. */
+static int compareSignificance(const void *a, const void *b) {
+    const EarthquakeData *x = &scanData[*(const int *)a], *y = &scanData[*(const int *)b];
+    if (x->significance != y->significance) return y->significance - x->significance;
+    if (x->timestamp != y->timestamp) return x->timestamp < y->timestamp ? -1 : 1;
+    return *(const int *)a - *(const int *)b;
+}
+
+static int scanQuery(const EarthquakeData *data, int n, double minMagnitude,
+                     long t0, long t1, int *rows) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (data[i].magnitude >= minMagnitude && data[i].timestamp >= t0 &&
+            data[i].timestamp <= t1) {
+            rows[count++] = i;
+        }
+    }
+    return count;
+}
+
+static int scanTop(const EarthquakeData *data, int n, long t0, long t1, int k, int *rows) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (data[i].timestamp >= t0 && data[i].timestamp <= t1) rows[count++] = i;
+    }
+    scanData = data;
+    qsort(rows, count, sizeof(int), compareSignificance);
+    return count < k ? count : k;
+}
+
+/* Flattens spans into sorted rows; returns the row count. */
+static int flatten(const EarthquakeSpan *spans, int numSpans, int *rows) {
+    int count = 0;
+    for (int s = 0; s < numSpans; s++) {
+        memcpy(rows + count, spans[s].rows, sizeof(int) * spans[s].count);
+        count += spans[s].count;
+    }
+    qsort(rows, count, sizeof(int), compareInt);
+    return count;
+}
+
+int main(int argc, char **argv) {
+    int features = argc > 1 ? atoi(argv[1]) : 60000;
+    if (features < 2) {
+        fprintf(stderr, "Usage: %s [numFeatures]\n", argv[0]);
+        return 1;
+    }
+    char *doc = makeSyntheticFeed(features);
+    int n = 0;
+    EarthquakeData *data = parseEarthquakeDataStream(doc, strlen(doc), &n);
+    free(doc);
+    int *rows = malloc(sizeof(int) * n);
+    int *expected = malloc(sizeof(int) * n);
+    EarthquakeSpan *spans = malloc(sizeof(EarthquakeSpan) * n);
+    if (!data || !rows || !expected || !spans) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+
+    /* a few unknown magnitudes, which no magnitude query may return */
+    for (int i = 5; i < n; i += 997) data[i].magnitude = NAN;
+
+    long first = data[0].timestamp, last = data[0].timestamp;
+    for (int i = 1; i < n; i++) {
+        if (data[i].timestamp < first) first = data[i].timestamp;
+        if (data[i].timestamp > last) last = data[i].timestamp;
+    }
+    long span = last - first + 1;
+
+    printf("Earthquake index (n = %d)\n", n);
+    printf("=========================\n");
+
+    double start = benchNow();
+    EarthquakeIndex *index = createEarthquakeIndex(data, n);
+    double buildSecs = benchNow() - start;
+    if (!index) {
+        fprintf(stderr, "createEarthquakeIndex failed\n");
+        return 1;
+    }
+
+    /* windows of ~1% of the feed; thresholds on and between bucket edges */
+    int queries = 2000, k = 10, failures = 0;
+    unsigned int state = 17u;
+    long *t0s = malloc(sizeof(long) * queries);
+    double *mins = malloc(sizeof(double) * queries);
+    for (int q = 0; q < queries; q++) {
+        state = state * 1103515245u + 12345u;
+        t0s[q] = first + (long)((state >> 4) % (unsigned int)span);
+        mins[q] = q % 3 == 0 ? 4.5 : (state % 700) / 100.0 - 0.5;
+    }
+    long width = span / 100;
+
+    for (int q = 0; q < queries; q += 7) {
+        long t0 = t0s[q], t1 = t0s[q] + width;
+        int numSpans = earthquakeIndexQuery(index, mins[q], t0, t1, spans, n);
+        int got = flatten(spans, numSpans, rows);
+        int want = scanQuery(data, n, mins[q], t0, t1, expected);
+        failures += got != want || memcmp(rows, expected, sizeof(int) * got) != 0;
+
+        int counts[EARTHQUAKE_INDEX_BUCKETS];
+        failures += earthquakeIndexHistogram(index, t0, t1, counts) !=
+                    scanQuery(data, n, -1e300, t0, t1, expected);
+
+        got = earthquakeIndexTopSignificance(index, t0, t1, k, rows);
+        want = scanTop(data, n, t0, t1, k, expected);
+        failures += got != want || memcmp(rows, expected, sizeof(int) * got) != 0;
+    }
+    /* whole feed, empty and inverted windows */
+    failures += earthquakeIndexWindow(index, first, last).count != n;
+    failures += earthquakeIndexWindow(index, last + 1, last + 100).count != 0;
+    failures += earthquakeIndexQuery(index, 0.0, last, first, spans, n) != 0;
+    failures += earthquakeIndexTopSignificance(index, first, last, n + 5, rows) != n;
+
+    volatile long sink = 0;
+    start = benchNow();
+    for (int q = 0; q < queries; q++) {
+        int numSpans = earthquakeIndexQuery(index, mins[q], t0s[q], t0s[q] + width, spans, n);
+        for (int s = 0; s < numSpans; s++) sink += spans[s].count;
+    }
+    double queryMicros = (benchNow() - start) / queries * 1e6;
+
+    start = benchNow();
+    for (int q = 0; q < queries; q++) {
+        sink += earthquakeIndexTopSignificance(index, t0s[q], t0s[q] + width, k, rows);
+    }
+    double topMicros = (benchNow() - start) / queries * 1e6;
+
+    int scans = 200;
+    start = benchNow();
+    for (int q = 0; q < scans; q++) {
+        sink += scanQuery(data, n, mins[q], t0s[q], t0s[q] + width, expected);
+    }
+    double scanMicros = (benchNow() - start) / scans * 1e6;
+
+    start = benchNow();
+    for (int q = 0; q < scans; q++) {
+        sink += scanTop(data, n, t0s[q], t0s[q] + width, k, expected);
+    }
+    double scanTopMicros = (benchNow() - start) / scans * 1e6;
+
+    printf("build                     : %9.2f ms\n", buildSecs * 1e3);
+    printf("mag >= M in window        : %9.2f us (scan %9.2f us, %.0fx)\n",
+           queryMicros, scanMicros, scanMicros / queryMicros);
+    printf("top-%d significance       : %9.2f us (scan+sort %9.2f us, %.0fx)\n",
+           k, topMicros, scanTopMicros, scanTopMicros / topMicros);
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    freeEarthquakeIndex(index);
+    free(mins);
+    free(t0s);
+    free(spans);
+    free(expected);
+    free(rows);
+    freeEarthquakeDataBatch(data);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Parallel report benchmark
+ *
+ * Description:
+ * Times summarizeEarthquakes over a large synthetic array on 1..N
+ * threads (N defaults to the number of online cores, at least 4) and
+ * the serial runReports for reference.  Every summary must equal the
+ * one-thread summary, printReportSummary must print exactly what
+ * runReports prints, and the histogram and region counts are checked
+ * against plain loops.  Exits non-zero on a mismatch.
+ *
+ * Usage: reportBench [numRows [maxThreads]]
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "../earthquake.h"
+#include "../utils/report_summary.h"
+#include "bench_utils.h"
+
+#define NUM_PLACES 400
+
+/* Runs runReports (serial) or printReportSummary and returns the output. */
+static char *captureReports(const EarthquakeData *data, int n, const ReportSummary *summary) {
+    FILE *out = tmpfile();
+    if (!out) return NULL;
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    dup2(fileno(out), STDOUT_FILENO);
+    if (summary) printReportSummary(data, summary);
+    else runReports(data, n);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+
+    long size = ftell(out);
+    char *text = malloc(size + 1);
+    rewind(out);
+    if (text) text[fread(text, 1, size, out)] = '\0';
+    fclose(out);
+    return text;
+}
+
+static int sameSummary(const ReportSummary *a, const ReportSummary *b) {
+    if (a->weakest != b->weakest || a->strongest != b->strongest || a->closest != b->closest ||
+        a->closestKm != b->closestKm || a->numRegions != b->numRegions ||
+        memcmp(a->histogram, b->histogram, sizeof(a->histogram)) != 0) {
+        return 0;
+    }
+    for (int i = 0; i < a->numRegions; i++) {
+        if (a->regions[i].count != b->regions[i].count ||
+            a->regions[i].length != b->regions[i].length ||
+            memcmp(a->regions[i].name, b->regions[i].name, a->regions[i].length) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Checks the histogram and region counts against plain loops. */
+static int checkCounts(const EarthquakeData *data, int n, const ReportSummary *summary) {
+    int histogram[REPORT_MAGNITUDE_BINS] = { 0 };
+    for (int i = 0; i < n; i++) {
+        double m = data[i].magnitude;
+        int bin = isnan(m) || m < 0 ? 0 : m >= 9 ? REPORT_MAGNITUDE_BINS - 1 : (int)floor(m) + 1;
+        histogram[bin]++;
+    }
+    if (memcmp(histogram, summary->histogram, sizeof(histogram)) != 0) return 0;
+
+    int total = 0;
+    for (int r = 0; r < summary->numRegions; r++) total += summary->regions[r].count;
+    if (total != n) return 0;
+    /* the most active region, counted by name */
+    const RegionCount *top = &summary->regions[0];
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        const char *comma = strrchr(data[i].locationName, ',');
+        const char *region = comma ? comma + 2 : data[i].locationName;
+        count += (int)strlen(region) == top->length && memcmp(region, top->name, top->length) == 0;
+    }
+    return count == top->count;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 2000000;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 2 ? atoi(argv[2]) : (cores > 4 ? (int)cores : 4);
+    if (n < 1 || maxThreads < 1) {
+        fprintf(stderr, "Usage: %s [numRows [maxThreads]]\n", argv[0]);
+        return 1;
+    }
+
+    /* rows share a few hundred location strings, like a real dump */
+    static char places[NUM_PLACES][64];
+    static const char *regions[] = { "CA", "Alaska", "Hawaii", "Nevada", "Japan", "Chile",
+                                     "Indonesia", "Puerto Rico", "Mexico", "Fiji" };
+    for (int p = 0; p < NUM_PLACES; p++) {
+        if (p % 37 == 0) snprintf(places[p], sizeof(places[p]), "Region %d Ridge", p);
+        else snprintf(places[p], sizeof(places[p]), "%d km NW of Town %d, %s", p % 50, p,
+                      regions[(p * 7) % 10]);
+    }
+    EarthquakeData *data = malloc(sizeof(EarthquakeData) * n);
+    if (!data) {
+        fprintf(stderr, "setup failed\n");
+        return 1;
+    }
+    unsigned int state = 41u;
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        data[i].id = "bench";
+        data[i].locationName = places[(state >> 8) % NUM_PLACES];
+        data[i].magnitude = ((state >> 4) % 900) / 100.0 - 1.0;
+        data[i].significance = (state >> 3) % 1000;
+        data[i].timestamp = 1751485191530L - i * 1000L;
+        data[i].latitude = ((state >> 6) % 18000) / 100.0 - 90.0;
+        data[i].longitude = ((state >> 10) % 36000) / 100.0 - 180.0;
+        data[i].depth = (state % 7000) / 100.0;
+    }
+    /* NaN rows (not first) must be skipped exactly as runReports skips them */
+    data[n / 2].magnitude = NAN;
+    data[n / 3].latitude = NAN;
+
+    printf("Parallel reports (n = %d, %ld online cores)\n", n, cores);
+    printf("============================================\n");
+
+    int failures = 0;
+    double start = benchNow();
+    char *serialText = captureReports(data, n, NULL);
+    double serialSecs = benchNow() - start;
+
+    /* base is what the report program computes; counted adds the counts */
+    ReportSummary base, counted;
+    start = benchNow();
+    int ok = summarizeEarthquakes(data, n, 1, 0, &base);
+    double baseSecs = benchNow() - start;
+    start = benchNow();
+    ok = ok && summarizeEarthquakes(data, n, 1, 1, &counted);
+    double countedSecs = benchNow() - start;
+    if (!ok) {
+        fprintf(stderr, "summarizeEarthquakes failed\n");
+        return 1;
+    }
+    char *summaryText = captureReports(data, n, &base);
+    failures += !serialText || !summaryText || strcmp(serialText, summaryText) != 0;
+    failures += !checkCounts(data, n, &counted);
+    failures += base.weakest != counted.weakest || base.strongest != counted.strongest ||
+                base.closest != counted.closest || base.closestKm != counted.closestKm;
+
+    printf("runReports (serial)       : %9.2f ms\n", serialSecs * 1e3);
+    printf("summary, 1 thread         : %9.2f ms\n", baseSecs * 1e3);
+    printf("  with counts, 1 thread   : %9.2f ms\n", countedSecs * 1e3);
+    for (int threads = 2; threads <= maxThreads; threads++) {
+        ReportSummary summary;
+        start = benchNow();
+        ok = summarizeEarthquakes(data, n, threads, 0, &summary);
+        double secs = benchNow() - start;
+        failures += !ok || !sameSummary(&base, &summary);
+        printf("summary, %d threads        : %9.2f ms (%.2fx)\n",
+               threads, secs * 1e3, baseSecs / secs);
+        if (ok) freeReportSummary(&summary);
+
+        ok = summarizeEarthquakes(data, n, threads, 1, &summary);
+        failures += !ok || !sameSummary(&counted, &summary);
+        if (ok) freeReportSummary(&summary);
+    }
+    printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+    freeReportSummary(&counted);
+    freeReportSummary(&base);
+    free(summaryText);
+    free(serialText);
+    free(data);
+    return failures ? 1 : 0;
+}
@@ -13,6 +13,7 @@
 #include <time.h>
 
 #include "earthquake.h"
+#include "utils/geo_batch.h"
 
 int initEarthquakeData(EarthquakeData *data,
   const char *id,
@@ -56,37 +57,360 @@ EarthquakeData * createEarthquakeData(
     return data;
 }
 
-char *earthquakeDataToString(const EarthquakeData *data) {
+/* Arena blocks start small and double up to this size; longer strings
+ * get a block of their own. */
+#define ARENA_FIRST_BLOCK 4096
+#define ARENA_MAX_BLOCK (1 << 20)
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+    char text[];
+} ArenaBlock;
+
+/* Stored just before element 0 of every batch; the union keeps the
+ * array that follows it aligned. */
+typedef union {
+    struct {
+        ArenaBlock *blocks;  /* newest first */
+        size_t nextSize;
+    } arena;
+    long double align;
+} BatchHeader;
+
+static BatchHeader *batchHeader(EarthquakeData *batch) {
+    return (BatchHeader *)batch - 1;
+}
+
+static char *arenaCopy(BatchHeader *header, const char *str) {
+    size_t len = strlen(str) + 1;
+    ArenaBlock *block = header->arena.blocks;
+    if (!block || block->size - block->used < len) {
+        size_t size = header->arena.nextSize;
+        if (size < len) size = len;
+        block = malloc(sizeof(ArenaBlock) + size);
+        if (block == NULL) return NULL;
+        block->size = size;
+        block->used = 0;
+        block->next = header->arena.blocks;
+        header->arena.blocks = block;
+        if (header->arena.nextSize < ARENA_MAX_BLOCK) header->arena.nextSize *= 2;
+    }
+    char *copy = block->text + block->used;
+    memcpy(copy, str, len);
+    block->used += len;
+    return copy;
+}
+
+EarthquakeData *createEarthquakeDataBatch(int capacity) {
+    if (capacity < 0) return NULL;
+    BatchHeader *header = malloc(sizeof(BatchHeader) + sizeof(EarthquakeData) * capacity);
+    if (header == NULL) return NULL;
+    header->arena.blocks = NULL;
+    header->arena.nextSize = ARENA_FIRST_BLOCK;
+    return (EarthquakeData *)(header + 1);
+}
+
+EarthquakeData *growEarthquakeDataBatch(EarthquakeData *batch, int capacity) {
+    if (batch == NULL) return createEarthquakeDataBatch(capacity);
+    if (capacity < 0) return NULL;
+    BatchHeader *header = realloc(batchHeader(batch),
+                                  sizeof(BatchHeader) + sizeof(EarthquakeData) * capacity);
+    return header ? (EarthquakeData *)(header + 1) : NULL;
+}
+
+int initEarthquakeDataInBatch(EarthquakeData *batch,
+  int index,
+  const char *id,
+  const char *locationName,
+  double magnitude,
+  int significance,
+  long timestamp,
+  double latitude,
+  double longitude,
+  double depth) {
+
+    if (batch == NULL) return 0;
+    BatchHeader *header = batchHeader(batch);
+    EarthquakeData *data = &batch[index];
+    data->id = arenaCopy(header, id ? id : "");
+    data->locationName = arenaCopy(header, locationName ? locationName : "");
+    if (data->id == NULL || data->locationName == NULL) return 0;
+    data->magnitude = magnitude;
+    data->significance = significance;
+    data->timestamp = timestamp;
+    data->latitude = latitude;
+    data->longitude = longitude;
+    data->depth = depth;
+    return 1;
+}
+
+void freeEarthquakeDataBatch(EarthquakeData *batch) {
+    if (batch == NULL) return;
+    BatchHeader *header = batchHeader(batch);
+    ArenaBlock *block = header->arena.blocks;
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(header);
+}
+
+/* Writes the two-digit value v (0..99) at out. */
+static void twoDigits(char *out, int v) {
+    out[0] = (char)('0' + v / 10);
+    out[1] = (char)('0' + v % 10);
+}
+
+/* Formats "YYYY-MM-DD " for the given day (days since 1970-01-01) using
+ * the proleptic Gregorian calendar; returns 0 outside years 1000..9999,
+ * which are left to strftime. */
+static int formatDate(long day, char *date) {
+    long z = day + 719468;
+    long era = (z >= 0 ? z : z - 146096) / 146097;
+    long doe = z - era * 146097;                                  /* [0, 146096] */
+    long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; /* [0, 399] */
+    long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);           /* [0, 365] */
+    long mp = (5 * doy + 2) / 153;                                /* March = 0 */
+    int dayOfMonth = (int)(doy - (153 * mp + 2) / 5 + 1);
+    int month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    long year = yoe + era * 400 + (month <= 2);
+    if (year < 1000 || year > 9999) return 0;
+
+    twoDigits(date, (int)(year / 100));
+    twoDigits(date + 2, (int)(year % 100));
+    date[4] = '-';
+    twoDigits(date + 5, month);
+    date[7] = '-';
+    twoDigits(date + 8, dayOfMonth);
+    date[10] = ' ';
+    date[11] = '\0';
+    return 1;
+}
+
+void formatTimestamp(long timestamp, TimestampCache *cache, char *out) {
+
+    /* convert timestamp (ms) to seconds, then split into day and time of day */
+    long seconds = timestamp / 1000;
+    long day = seconds / 86400;
+    long secondOfDay = seconds % 86400;
+    if (secondOfDay < 0) {
+        secondOfDay += 86400;
+        day--;
+    }
+
+    TimestampCache local = { 0, 0, "" };
+    if (cache == NULL) cache = &local;
+    if (!cache->valid || cache->day != day) {
+        cache->valid = formatDate(day, cache->date);
+        cache->day = day;
+    }
+    if (!cache->valid) {
+        /* outside the four-digit years: let the C library do it */
+        time_t timestamp_s = (time_t)seconds;
+        struct tm *timeinfo = gmtime(&timestamp_s);
+        out[0] = '\0';
+        if (timeinfo) strftime(out, TIMESTAMP_STRING_SIZE, "%Y-%m-%d %H:%M:%S UTC", timeinfo);
+        return;
+    }
+
+    memcpy(out, cache->date, 11);
+    twoDigits(out + 11, (int)(secondOfDay / 3600));
+    out[13] = ':';
+    twoDigits(out + 14, (int)(secondOfDay / 60 % 60));
+    out[16] = ':';
+    twoDigits(out + 17, (int)(secondOfDay % 60));
+    memcpy(out + 19, " UTC", 5);
+}
+
+/* Longest "%<width>.<decimals>f" text of a value that fixedIsSmall
+ * accepts: nine digits, the point, a sign and a leading zero. */
+#define SMALL_FIXED_MAX 12
+
+/* Whether putFixed formats value itself rather than leaving it to sprintf. */
+static int fixedIsSmall(double value, int decimals) {
+    return fabs(value) * (decimals == 1 ? 10.0 : 100.0) < 1e9;
+}
+
+/* Most bytes putFixed may write for value. */
+static int fixedBound(double value, int width, int decimals) {
+    if (!fixedIsSmall(value, decimals)) return snprintf(NULL, 0, "%*.*f", width, decimals, value);
+    return width > SMALL_FIXED_MAX ? width : SMALL_FIXED_MAX;
+}
+
+/* Writes count spaces at out and returns the end. */
+static char *putSpaces(char *out, int count) {
+    if (count <= 0) return out;
+    memset(out, ' ', (size_t)count);
+    return out + count;
+}
+
+/* "%-<width>s" of the len bytes at str */
+static char *putPadded(char *out, const char *str, size_t len, int width) {
+    memcpy(out, str, len);
+    return putSpaces(out + len, width - (int)len);
+}
 
-    /* convert timestamp (ms) to seconds and format as UTC */
-    time_t timestamp_s = data->timestamp / 1000;
-    struct tm *timeinfo = gmtime(&timestamp_s);
-    char time_str[30];
-    strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S UTC", timeinfo);
-
-     char buffer[512];
-     /* Format fields: magnitude (1 decimal), significance (3-wide), time string,
-        latitude/longitude (2 decimals), depth (2 decimals, km). */
-     snprintf(buffer, sizeof(buffer), "%-15s %-39s %4.1f (%3d) %24s   (%7.2f, %7.2f) %6.2fkm",
-                 data->id ? data->id : "",
-                 data->locationName ? data->locationName : "",
-                 data->magnitude,
-                 data->significance,
-                 time_str,
-                 data->latitude,
-                 data->longitude,
-                 data->depth);
+/*
+ * "%<width>.<decimals>f" for decimals 1 or 2.  The value is scaled and
+ * rounded in integers.  Near a rounding tie the exact residual from fma
+ * decides, and an exact tie goes to the even digit as printf does, so
+ * the text always matches printf.  Values that are not small finite
+ * numbers are left to sprintf.
+ */
+static char *putFixed(char *out, double value, int width, int decimals) {
+    if (!fixedIsSmall(value, decimals)) {
+        return out + sprintf(out, "%*.*f", width, decimals, value);
+    }
+    double scale = decimals == 1 ? 10.0 : 100.0;
+    double magnitude = fabs(value);
+    double scaled = magnitude * scale;
+    /* scaled is in [0, 1e9), so the cast is floor without a libm call */
+    unsigned int units = (unsigned int)scaled;
+    double below = units;
+    double fraction = scaled - below;
+    if (fabs(fraction - 0.5) < 1e-6) {
+        /* exact sign of magnitude * scale - (below + 0.5) */
+        double residual = fma(magnitude, scale, -(below + 0.5));
+        units += residual > 0 || (residual == 0 && (units & 1));
+    } else {
+        units += fraction > 0.5;
+    }
+
+    /* the text is counted first, then its digits are written in place
+       backwards from its end, two at a time */
+    unsigned int whole = decimals == 1 ? units / 10 : units / 100;
+    int count = decimals + 2 + (signbit(value) != 0);
+    for (unsigned int v = whole; v >= 10; v /= 10) count++;
+    for (int pad = width - count; pad > 0; pad--) *out++ = ' ';
+    char *end = out + count, *d = end;
+    if (decimals == 2) {
+        d -= 2;
+        twoDigits(d, (int)(units % 100));
+    } else {
+        *--d = (char)('0' + units % 10);
+    }
+    *--d = '.';
+    while (whole >= 100) {
+        d -= 2;
+        twoDigits(d, (int)(whole % 100));
+        whole /= 100;
+    }
+    if (whole >= 10) {
+        d -= 2;
+        twoDigits(d, (int)whole);
+    } else {
+        *--d = (char)('0' + whole);
+    }
+    if (signbit(value)) *--d = '-';
+    return end;
+}
+
+/* "%<width>d" */
+static char *putInt(char *out, int value, int width) {
+    char digits[16];
+    int count = 0;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) digits[count++] = '-';
+    out = putSpaces(out, width - count);
+    while (count > 0) *out++ = digits[--count];
+    return out;
+}
+
+/* Lays out one row at out, which must hold the bound computed by
+ * earthquakeDataFormat, and returns its length. */
+static size_t layoutRow(const EarthquakeData *data, const char *id, size_t idLen,
+                        const char *location, size_t locationLen, const char *time,
+                        char *out) {
+    /* Same text as "%-15s %-39s %4.1f (%3d) %24s   (%7.2f, %7.2f) %6.2fkm":
+       magnitude (1 decimal), significance (3-wide), time string,
+       latitude/longitude (2 decimals), depth (2 decimals, km). */
+    char *p = out;
+    p = putPadded(p, id, idLen, 15);
+    *p++ = ' ';
+    p = putPadded(p, location, locationLen, 39);
+    *p++ = ' ';
+    p = putFixed(p, data->magnitude, 4, 1);
+    memcpy(p, " (", 2);
+    p = putInt(p + 2, data->significance, 3);
+    memcpy(p, ") ", 2);
+    p += 2;
+    size_t timeLen = strlen(time);
+    p = putSpaces(p, 24 - (int)timeLen);
+    memcpy(p, time, timeLen);
+    memcpy(p + timeLen, "   (", 4);
+    p = putFixed(p + timeLen + 4, data->latitude, 7, 2);
+    memcpy(p, ", ", 2);
+    p = putFixed(p + 2, data->longitude, 7, 2);
+    memcpy(p, ") ", 2);
+    p = putFixed(p + 2, data->depth, 6, 2);
+    memcpy(p, "km", 2);
+    return (size_t)(p + 2 - out);
+}
+
+int earthquakeDataFormat(const EarthquakeData *data, TimestampCache *cache,
+                         char *buffer, size_t size) {
+    char time_str[TIMESTAMP_STRING_SIZE];
+    formatTimestamp(data->timestamp, cache, time_str);
+    const char *id = data->id ? data->id : "";
+    const char *location = data->locationName ? data->locationName : "";
+    size_t idLen = strlen(id), locationLen = strlen(location);
+
+    /* an upper bound on the row: the padded strings, the numbers and
+       the fixed text (spaces, brackets, time and units) */
+    size_t bound = (idLen > 15 ? idLen : 15) + (locationLen > 39 ? locationLen : 39) +
+                   fixedBound(data->magnitude, 4, 1) + fixedBound(data->latitude, 7, 2) +
+                   fixedBound(data->longitude, 7, 2) + fixedBound(data->depth, 6, 2) + 64;
+    if (bound < size) {
+        /* the usual case: the row is laid out in place */
+        size_t len = layoutRow(data, id, idLen, location, locationLen, time_str, buffer);
+        buffer[len] = '\0';
+        return (int)len;
+    }
+
+    /* otherwise lay it out aside and keep what fits, like snprintf */
+    char row[EARTHQUAKE_DATA_STRING_SIZE];
+    char *text = bound < sizeof(row) ? row : malloc(bound);
+    if (!text) return -1;
+    size_t len = layoutRow(data, id, idLen, location, locationLen, time_str, text);
+    if (size > 0) {
+        size_t kept = len < size ? len : size - 1;
+        memcpy(buffer, text, kept);
+        buffer[kept] = '\0';
+    }
+    if (text != row) free(text);
+    return (int)len;
+}
+
+char *earthquakeDataToString(const EarthquakeData *data) {
+    char buffer[EARTHQUAKE_DATA_STRING_SIZE];
+    earthquakeDataFormat(data, NULL, buffer, sizeof(buffer));
 
     char *result = malloc(strlen(buffer) + 1);
     strcpy(result, buffer);
     return result;
 }
 
+/* Formats one row plus a newline at line (EARTHQUAKE_DATA_STRING_SIZE
+ * bytes of room) and returns the bytes written. */
+static size_t formatRow(const EarthquakeData *data, TimestampCache *cache, char *line) {
+    int len = earthquakeDataFormat(data, cache, line, EARTHQUAKE_DATA_STRING_SIZE);
+    if (len < 0) return 0;
+    /* rows longer than the buffer are cut like earthquakeDataToString cuts them */
+    if (len > EARTHQUAKE_DATA_STRING_SIZE - 1) len = EARTHQUAKE_DATA_STRING_SIZE - 1;
+    line[len] = '\n';
+    return (size_t)len + 1;
+}
 
 void earthquakeDataPrint(const EarthquakeData *data) {
-    char *str = earthquakeDataToString(data);
-    printf("%s\n", str);
-    free(str);
+    char line[EARTHQUAKE_DATA_STRING_SIZE];
+    fwrite(line, 1, formatRow(data, NULL, line), stdout);
     return;
 }
 
@@ -97,9 +421,18 @@ void earthquakeDataPrintAll(const EarthquakeData *data, int n) {
                                   "magnitude/(sig)",
                                   "time",
                                   "lat/lon", "depth");
+    /* rows are formatted into a block and written a block at a time */
+    char block[64 * EARTHQUAKE_DATA_STRING_SIZE];
+    size_t used = 0;
+    TimestampCache cache = { 0, 0, "" };
     for(int i=0; i<n; i++) {
-        earthquakeDataPrint(&data[i]);
+        if (sizeof(block) - used < EARTHQUAKE_DATA_STRING_SIZE) {
+            fwrite(block, 1, used, stdout);
+            used = 0;
+        }
+        used += formatRow(&data[i], &cache, block + used);
     }
+    fwrite(block, 1, used, stdout);
     printf("\n\n");
 }
 
@@ -137,14 +470,37 @@ void runReports(const EarthquakeData *data, int n) {
     const double lincolnLon = -96.681679;
     int closestIndex = -1;
     double minDistance = -1.0;
-    for (int i = 0; i < n; i++) {
-        double d = airDistance(lincolnLat, lincolnLon, data[i].latitude, data[i].longitude);
-        if (minDistance < 0 || d < minDistance) {
-            minDistance = d;
-            closestIndex = i;
+    double *lats = malloc(sizeof(double) * (n > 0 ? n : 1));
+    double *lons = malloc(sizeof(double) * (n > 0 ? n : 1));
+    double *dists = malloc(sizeof(double) * (n > 0 ? n : 1));
+    if (lats && lons && dists) {
+        /* gather the coordinates and run the batch kernel over them */
+        for (int i = 0; i < n; i++) {
+            lats[i] = data[i].latitude;
+            lons[i] = data[i].longitude;
+        }
+        airDistanceMany(lincolnLat, lincolnLon, lats, lons, dists, (size_t)n);
+        for (int i = 0; i < n; i++) {
+            if (closestIndex < 0 || dists[i] < dists[closestIndex]) {
+                closestIndex = i;
+            }
+        }
+    } else {
+        for (int i = 0; i < n; i++) {
+            double d = airDistance(lincolnLat, lincolnLon, data[i].latitude, data[i].longitude);
+            if (minDistance < 0 || d < minDistance) {
+                minDistance = d;
+                closestIndex = i;
+            }
         }
     }
+    free(lats);
+    free(lons);
+    free(dists);
     if (closestIndex >= 0) {
+        /* report the exact scalar distance for the winner */
+        minDistance = airDistance(lincolnLat, lincolnLon,
+                                  data[closestIndex].latitude, data[closestIndex].longitude);
         printf("Closest Earthquake to Lincoln (%.2f kms away): \n", minDistance);
         earthquakeDataPrint(&data[closestIndex]);
     } else {
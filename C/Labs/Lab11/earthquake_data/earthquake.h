@@ -8,12 +8,15 @@
  * earthquake event parsed from the USGS feed (or local JSON). Fields use
  * dynamically allocated strings where appropriate; callers are responsible
  * for freeing any allocated EarthquakeData instances created by
- * `createEarthquakeData`.
+ * `createEarthquakeData`.  Parsed feeds come back as batches whose
+ * strings share one arena (see `createEarthquakeDataBatch`).
  */
 
 #ifndef EARTHQUAKE_H
 #define EARTHQUAKE_H
 
+#include <stddef.h>
+
 typedef struct {
     char *id;            /* unique alphanumeric id (malloc'd) */
     char *locationName;  /* human readable location (malloc'd) */
@@ -53,6 +56,78 @@ EarthquakeData *createEarthquakeData(
   double longitude,
   double depth);
 
+/**
+ * Creates a batch: an array with room for <code>capacity</code>
+ * earthquakes whose strings are copied into one string arena owned by
+ * the batch, so building it costs a handful of allocations instead of
+ * two per earthquake.  Returns NULL on allocation failure.  Release it
+ * with <code>freeEarthquakeDataBatch</code> only (never free() its
+ * strings or the array).
+ */
+EarthquakeData *createEarthquakeDataBatch(int capacity);
+
+/**
+ * Resizes a batch to hold <code>capacity</code> earthquakes, keeping
+ * its contents and arena.  Returns the (possibly moved) batch, or NULL
+ * on failure, in which case the old batch is unchanged.
+ */
+EarthquakeData *growEarthquakeDataBatch(EarthquakeData *batch, int capacity);
+
+/**
+ * Initializes <code>batch[index]</code> like <code>initEarthquakeData</code>,
+ * copying the strings into the batch's arena.  Returns 0 on allocation
+ * failure.
+ */
+int initEarthquakeDataInBatch(EarthquakeData *batch,
+  int index,
+  const char *id,
+  const char *locationName,
+  double magnitude,
+  int significance,
+  long timestamp,
+  double latitude,
+  double longitude,
+  double depth);
+
+/**
+ * Frees a batch, its strings and its arena at once.  Safe to pass NULL.
+ */
+void freeEarthquakeDataBatch(EarthquakeData *batch);
+
+/* Room for one formatted earthquake (as written by earthquakeDataFormat). */
+#define EARTHQUAKE_DATA_STRING_SIZE 512
+
+/* Room for a formatted timestamp, "YYYY-MM-DD HH:MM:SS UTC" plus '\0'. */
+#define TIMESTAMP_STRING_SIZE 30
+
+/**
+ * The date text of the last day a formatter saw; consecutive events
+ * usually fall on the same day, so the calendar math is skipped for
+ * them.  Zero-initialize before first use.
+ */
+typedef struct {
+    int valid;
+    long day;       /* days since 1970-01-01 */
+    char date[12];  /* "YYYY-MM-DD " */
+} TimestampCache;
+
+/**
+ * Writes the UTC time of the given epoch-milliseconds timestamp as
+ * "YYYY-MM-DD HH:MM:SS UTC" (the same text as gmtime and strftime) to
+ * <code>out</code>, which must hold TIMESTAMP_STRING_SIZE bytes.
+ * <code>cache</code> may be NULL.
+ */
+void formatTimestamp(long timestamp, TimestampCache *cache, char *out);
+
+/**
+ * Writes the human-readable representation of the given
+ * <code>EarthquakeData</code> instance (as in earthquakeDataToString)
+ * into the caller's buffer and returns its length, like snprintf.
+ * <code>cache</code> may be NULL.
+ */
+int earthquakeDataFormat(const EarthquakeData *data, TimestampCache *cache,
+                         char *buffer, size_t size);
+
 /**
  * A function to construct a (human-readable) string representation
  * of the given <code>EarthquakeData</code> instance.
@@ -67,7 +142,9 @@ void earthquakeDataPrint(const EarthquakeData *data);
 
 /**
  * Prints human-readable representations (in table format) of the given
- * <code>EarthquakeData</code> instances to the standard output.
+ * <code>EarthquakeData</code> instances to the standard output.  Rows
+ * are formatted exactly as printf would, and that, not the output, is
+ * what bounds its speed (see formatBench).
  */
 void earthquakeDataPrintAll(const EarthquakeData *data, int n);
 
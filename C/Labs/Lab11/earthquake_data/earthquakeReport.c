@@ -1,41 +1,126 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include "earthquake.h"
 #include "data/local_data.h"
 #include "utils/utils.h"
+#include "utils/earthquake_cache.h"
+#include "utils/report_summary.h"
 
 const char *usgs_earthquake_url_hour = "https://earthquake.usgs.gov/earthquakes/feed/v1.0/summary/all_hour.geojson";
 const char *usgs_earthquake_url_day  = "https://earthquake.usgs.gov/earthquakes/feed/v1.0/summary/all_day.geojson";
 const char *usgs_earthquake_url_week = "https://earthquake.usgs.gov/earthquakes/feed/v1.0/summary/all_week.geojson";
 
+/* A USGS summary feed and how long a cached copy of it stays fresh
+ * (USGS regenerates the feeds every minute). */
+typedef struct {
+    const char *name;
+    const char *url;
+    int maxAgeSeconds;
+} Feed;
+
+/*
+ * Writes the per-user cache directory ($XDG_CACHE_HOME or ~/.cache, plus
+ * "earthquakeReport") to dir, creating it if need be.  Returns 0 if there
+ * is none, in which case feeds are not cached.
+ */
+static int cacheDirectory(char *dir, size_t size) {
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    int len;
+    if (xdg && xdg[0] == '/') {
+        len = snprintf(dir, size, "%s", xdg);
+    } else if (home && home[0] == '/') {
+        len = snprintf(dir, size, "%s/.cache", home);
+    } else {
+        return 0;
+    }
+    if (len < 0 || (size_t)len >= size) return 0;
+    mkdir(dir, 0700);  /* ~/.cache may not exist yet */
+    int tail = snprintf(dir + len, size - len, "/earthquakeReport");
+    return tail >= 0 && (size_t)(len + tail) < size && (mkdir(dir, 0700) == 0 || errno == EEXIST);
+}
+
+/**
+ * Loads the feed from its cache file when that is fresh and otherwise
+ * downloads it and rewrites the cache.  When the cache is used,
+ * <code>*cache</code> is set and the returned rows point into it.
+ */
+static EarthquakeData *loadFeed(const Feed *feed, int refresh, int *n, EarthquakeCache **cache) {
+    char dir[512], path[600];
+    *cache = NULL;
+    if (!cacheDirectory(dir, sizeof(dir))) return loadEarthquakeData(feed->url, n);
+    snprintf(path, sizeof(path), "%s/usgs_%s.eqcache", dir, feed->name);
+
+    if (!refresh && earthquakeCacheIsFresh(path, feed->url, feed->maxAgeSeconds)) {
+        *cache = openEarthquakeCache(path, feed->url);
+        EarthquakeData *rows = *cache ? earthquakeCacheRows(*cache) : NULL;
+        if (rows) {
+            *n = (*cache)->n;
+            return rows;
+        }
+        closeEarthquakeCache(*cache);
+        *cache = NULL;
+    }
+
+    time_t fetchedAt = time(NULL);
+    EarthquakeData *data = loadEarthquakeData(feed->url, n);
+    if (data && !writeEarthquakeCache(path, feed->url, fetchedAt, data, *n)) {
+        fprintf(stderr, "Warning: unable to write cache %s\n", path);
+    }
+    return data;
+}
+
 int main(int argc, char **argv) {
 
+    const Feed feeds[] = {
+        { "hour", usgs_earthquake_url_hour, 60 },
+        { "day", usgs_earthquake_url_day, 300 },
+        { "week", usgs_earthquake_url_week, 900 },
+    };
+
+    /* "refresh" as the last argument bypasses the cache */
+    int refresh = argc > 1 && strcmp(argv[argc - 1], "refresh") == 0;
+    if (refresh) argc--;
+
     int n;
     EarthquakeData *data = NULL;
+    EarthquakeCache *cache = NULL;
     if(argc == 1) {
-        data = loadEarthquakeData(usgs_earthquake_url_week, &n);
+        data = loadFeed(&feeds[2], refresh, &n, &cache);
     } else if(argc == 2) {
-        if( strcmp(argv[1], "hour") == 0 ) {
-            data = loadEarthquakeData(usgs_earthquake_url_hour, &n);
-        } else if( strcmp(argv[1], "day") == 0 ) {
-            data = loadEarthquakeData(usgs_earthquake_url_day, &n);
-        } else if( strcmp(argv[1], "week") == 0 ) {
-            data = loadEarthquakeData(usgs_earthquake_url_week, &n);
-        } else if( strcmp(argv[1], "local") == 0 ) {
+        for (int i = 0; i < 3; i++) {
+            if( strcmp(argv[1], feeds[i].name) == 0 ) {
+                data = loadFeed(&feeds[i], refresh, &n, &cache);
+            }
+        }
+        if( strcmp(argv[1], "local") == 0 ) {
             data = parseEarthquakeData(LOCAL_DATA_JSON, &n);
         }
     }
 
     if(data == NULL) {
-        fprintf(stderr, "Usage: %s [hour|day|week(default)|local]\n", argv[0]);
+        fprintf(stderr, "Usage: %s [hour|day|week(default)|local] [refresh]\n", argv[0]);
         exit(1);
     }
 
     earthquakeDataPrintAll(data, n);
 
-    runReports(data, n);
+    /* large feeds are summarized on every core */
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    runReportsParallel(data, n, cores > 0 ? (int)cores : 1);
 
+    /* rows from the cache point into it; parsed rows are a batch */
+    if (cache) {
+        free(data);
+        closeEarthquakeCache(cache);
+    } else {
+        freeEarthquakeDataBatch(data);
+    }
     return 0;
 }
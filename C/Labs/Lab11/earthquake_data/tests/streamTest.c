@@ -0,0 +1,155 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Parse-while-downloading test
+ *
+ * Description:
+ * Writes a multi-megabyte USGS-style feed to a temporary file and loads
+ * it through cURL with a file:// URL.  Checks that the streamed load
+ * matches parsing the whole text at once, that the record callback sees
+ * every earthquake in order, that stopping from the callback ends the
+ * transfer with the records read so far, and that missing or malformed
+ * feeds fail cleanly.  Given a URL instead, it streams that feed and
+ * prints how many earthquakes arrived.  Exits non-zero on a failure.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../utils/utils.h"
+#include "../earthquake.h"
+
+typedef struct {
+    const EarthquakeData *expected;
+    int seen;
+    int stopAfter;  /* 0 = never stop */
+    int outOfOrder;
+} Progress;
+
+static int onRecord(const EarthquakeData *record, int index, void *userData) {
+    Progress *progress = userData;
+    if (index != progress->seen ||
+        (progress->expected && strcmp(record->id, progress->expected[index].id) != 0)) {
+        progress->outOfOrder = 1;
+    }
+    progress->seen++;
+    return progress->stopAfter == 0 || progress->seen < progress->stopAfter;
+}
+
+static int sameData(const EarthquakeData *a, const EarthquakeData *b, int n) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(a[i].id, b[i].id) != 0 ||
+            strcmp(a[i].locationName, b[i].locationName) != 0 ||
+            a[i].magnitude != b[i].magnitude || a[i].significance != b[i].significance ||
+            a[i].timestamp != b[i].timestamp || a[i].latitude != b[i].latitude ||
+            a[i].longitude != b[i].longitude || a[i].depth != b[i].depth) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Writes n features to a new temporary file and returns its text. */
+static char *writeFeed(const char *path, int n) {
+    FILE *out = fopen(path, "w");
+    if (!out) return NULL;
+    fprintf(out, "{\"type\":\"FeatureCollection\",\"metadata\":{\"count\":%d},\"features\":[", n);
+    for (int i = 0; i < n; i++) {
+        fprintf(out,
+                "%s{\"type\":\"Feature\",\"properties\":{\"mag\":%.2f,"
+                "\"place\":\"%d km SE of Tehachapi, CA\",\"time\":%ld,\"tz\":null,"
+                "\"url\":\"https://earthquake.usgs.gov/earthquakes/eventpage/ci%08d\","
+                "\"status\":\"automatic\",\"sig\":%d,\"title\":\"M %.1f\"},"
+                "\"geometry\":{\"type\":\"Point\",\"coordinates\":[%.4f,%.4f,%.2f]},"
+                "\"id\":\"ci%08d\"}\n",
+                i ? "," : "", (i % 600) / 100.0, i % 50, 1751485191530L - i * 1000L, i,
+                i % 1000, (i % 600) / 100.0, (i % 3600) / 10.0 - 180.0, (i % 1800) / 10.0 - 90.0,
+                (i % 700) / 10.0, i);
+    }
+    fprintf(out, "]}\n");
+    fclose(out);
+
+    FILE *in = fopen(path, "r");
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    rewind(in);
+    char *text = malloc(size + 1);
+    text[fread(text, 1, size, in)] = '\0';
+    fclose(in);
+    return text;
+}
+
+static int streamUrl(const char *url) {
+    Progress progress = { NULL, 0, 0, 0 };
+    int n = 0;
+    EarthquakeData *data = streamEarthquakeData(url, &n, onRecord, &progress);
+    if (!data) return 1;
+    printf("streamed %d earthquakes from %s\n", n, url);
+    freeEarthquakeDataBatch(data);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2) return streamUrl(argv[1]);
+
+    int failures = 0;
+    char path[] = "/tmp/streamTestXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+    char url[64];
+    snprintf(url, sizeof(url), "file://%s", path);
+
+    int total = 20000;
+    char *text = writeFeed(path, total);
+    int nAll = 0;
+    EarthquakeData *all = parseEarthquakeData(text, &nAll);
+    printf("feed: %d earthquakes, %zu bytes\n", nAll, strlen(text));
+
+    /* a full streamed load matches parsing the whole text */
+    Progress progress = { all, 0, 0, 0 };
+    int n = 0;
+    EarthquakeData *data = streamEarthquakeData(url, &n, onRecord, &progress);
+    int ok = data && n == nAll && n == total && progress.seen == n &&
+             !progress.outOfOrder && sameData(all, data, n);
+    printf("full load                 : %s\n", ok ? "passed" : "FAILED");
+    failures += !ok;
+    freeEarthquakeDataBatch(data);
+
+    /* stopping from the callback keeps what arrived and ends the transfer */
+    Progress early = { all, 0, 25, 0 };
+    data = streamEarthquakeData(url, &n, onRecord, &early);
+    ok = data && n == 25 && early.seen == 25 && sameData(all, data, n);
+    printf("stop after 25 records     : %s\n", ok ? "passed" : "FAILED");
+    failures += !ok;
+    freeEarthquakeDataBatch(data);
+
+    /* loadEarthquakeData takes the same path */
+    data = loadEarthquakeData(url, &n);
+    ok = data && n == nAll && sameData(all, data, n);
+    printf("loadEarthquakeData        : %s\n", ok ? "passed" : "FAILED");
+    failures += !ok;
+    freeEarthquakeDataBatch(data);
+
+    /* a truncated feed and a missing file both fail */
+    FILE *out = fopen(path, "w");
+    fwrite(text, 1, strlen(text) / 2, out);
+    fclose(out);
+    data = loadEarthquakeData(url, &n);
+    ok = data == NULL && n == 0;
+    unlink(path);
+    EarthquakeData *missing = loadEarthquakeData(url, &n);
+    ok = ok && missing == NULL && n == 0;
+    printf("truncated / missing feed  : %s\n", ok ? "passed" : "FAILED");
+    failures += !ok;
+
+    freeEarthquakeDataBatch(all);
+    free(text);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Delta-sync test
+ *
+ * Description:
+ * Syncs an EarthquakeSet against two snapshots of the same hourly feed
+ * (data/sync_snapshot_1.json, then data/sync_snapshot_2.json) through
+ * file:// URLs.  Between them one earthquake was deleted, two were added,
+ * two had their magnitude or significance revised and one had its place
+ * reviewed.  Checks the reported changes, that the set always equals
+ * the last snapshot, that slots stay stable, that re-applying a
+ * snapshot changes nothing, that going back undoes everything and that
+ * a failed download or an error reply leaves the set alone.  Also
+ * churns a large synthetic set to exercise slot reuse, hash deletion
+ * and arena compaction.  Exits non-zero on a failure.
+ *
+ * Usage: syncTest [snapshot1.json snapshot2.json]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../earthquake.h"
+#include "../utils/utils.h"
+#include "../utils/earthquake_sync.h"
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+    printf("%-40s: %s\n", what, ok ? "passed" : "FAILED");
+    failures += !ok;
+}
+
+/* Builds a file:// URL for a path relative to the working directory. */
+static void fileUrl(const char *path, char *url, size_t size) {
+    char *full = realpath(path, NULL);
+    snprintf(url, size, "file://%s", full ? full : path);
+    free(full);
+}
+
+/* The set holds exactly the n earthquakes of feed. */
+static int setMatches(const EarthquakeSet *set, const EarthquakeData *feed, int n) {
+    if (set->live != n) return 0;
+    for (int i = 0; i < n; i++) {
+        int slot = earthquakeSetFind(set, feed[i].id);
+        if (!earthquakeSetLive(set, slot)) return 0;
+        const EarthquakeData *have = &set->data[slot];
+        if (strcmp(have->locationName, feed[i].locationName) != 0 ||
+            have->magnitude != feed[i].magnitude || have->significance != feed[i].significance ||
+            have->timestamp != feed[i].timestamp || have->latitude != feed[i].latitude ||
+            have->longitude != feed[i].longitude || have->depth != feed[i].depth) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* The ids of the changes of one kind, sorted and comma-separated. */
+static void changedIds(const EarthquakeSet *set, const EarthquakeChanges *changes,
+                       EarthquakeChangeKind kind, char *out, size_t size) {
+    const char *ids[64];
+    int count = 0;
+    for (int c = 0; c < changes->count && count < 64; c++) {
+        if (changes->items[c].kind == kind) ids[count++] = set->data[changes->items[c].slot].id;
+    }
+    for (int i = 1; i < count; i++) {
+        for (int j = i; j > 0 && strcmp(ids[j - 1], ids[j]) > 0; j--) {
+            const char *t = ids[j];
+            ids[j] = ids[j - 1];
+            ids[j - 1] = t;
+        }
+    }
+    out[0] = '\0';
+    for (int i = 0; i < count; i++) {
+        strncat(out, i ? "," : "", size - strlen(out) - 1);
+        strncat(out, ids[i], size - strlen(out) - 1);
+    }
+}
+
+static int changesAre(const EarthquakeSet *set, const EarthquakeChanges *changes,
+                      const char *added, const char *updated, const char *removed) {
+    char ids[3][512];
+    changedIds(set, changes, EARTHQUAKE_ADDED, ids[0], sizeof(ids[0]));
+    changedIds(set, changes, EARTHQUAKE_UPDATED, ids[1], sizeof(ids[1]));
+    changedIds(set, changes, EARTHQUAKE_REMOVED, ids[2], sizeof(ids[2]));
+    int ok = strcmp(ids[0], added) == 0 && strcmp(ids[1], updated) == 0 &&
+             strcmp(ids[2], removed) == 0;
+    if (!ok) fprintf(stderr, "  added [%s] updated [%s] removed [%s]\n", ids[0], ids[1], ids[2]);
+    return ok;
+}
+
+/* Many applies of a shifting window of synthetic earthquakes. */
+static void churn(void) {
+    int window = 5000, step = 700, rounds = 40;
+    EarthquakeData *feed = createEarthquakeDataBatch(window);
+    EarthquakeSet set;
+    EarthquakeChanges changes = { 0 };
+    int ok = feed && initEarthquakeSet(&set);
+    int maxSlots = 0;
+    for (int r = 0; ok && r < rounds; r++) {
+        for (int i = 0; i < window; i++) {
+            int event = r * step + i;
+            char id[32], place[64];
+            snprintf(id, sizeof(id), "zz%08d", event);
+            /* every round revises the place of a few events still in the window */
+            snprintf(place, sizeof(place), "%d km N of Somewhere, CA (rev %d)", event % 90,
+                     event % 11 == 0 ? r : 0);
+            ok = initEarthquakeDataInBatch(feed, i, id, place, (event % 70) / 10.0, event % 900,
+                                           1751485191530L + event, 35.0, -118.0, 5.0);
+        }
+        ok = ok && applyEarthquakeFeed(&set, feed, window, &changes);
+        int expectAdded = r == 0 ? window : step;
+        int expectRemoved = r == 0 ? 0 : step;
+        ok = ok && changes.added == expectAdded && changes.removed == expectRemoved &&
+             setMatches(&set, feed, window);
+        if (set.slots > maxSlots) maxSlots = set.slots;
+        /* rebuild the feed batch so its own arena does not grow */
+        freeEarthquakeDataBatch(feed);
+        feed = createEarthquakeDataBatch(window);
+        ok = ok && feed;
+    }
+    /* freed slots are reused: never more than one window plus one step */
+    check(ok && maxSlots <= window + step, "churn: reuse, deletion, compaction");
+    if (ok) freeEarthquakeSet(&set);
+    freeEarthquakeChanges(&changes);
+    freeEarthquakeDataBatch(feed);
+}
+
+int main(int argc, char **argv) {
+    const char *first = argc > 2 ? argv[1] : "data/sync_snapshot_1.json";
+    const char *second = argc > 2 ? argv[2] : "data/sync_snapshot_2.json";
+    char url1[1024], url2[1024];
+    fileUrl(first, url1, sizeof(url1));
+    fileUrl(second, url2, sizeof(url2));
+
+    int n1 = 0, n2 = 0;
+    EarthquakeData *snap1 = loadEarthquakeData(url1, &n1);
+    EarthquakeData *snap2 = loadEarthquakeData(url2, &n2);
+    if (!snap1 || !snap2) {
+        fprintf(stderr, "Usage: %s [snapshot1.json snapshot2.json] (run from earthquake_data)\n",
+                argv[0]);
+        return 1;
+    }
+
+    EarthquakeSet set;
+    EarthquakeChanges changes = { 0 };
+    if (!initEarthquakeSet(&set)) {
+        fprintf(stderr, "initEarthquakeSet failed\n");
+        return 1;
+    }
+
+    check(syncEarthquakeData(&set, url1, &changes) && changes.added == n1 &&
+          changes.updated == 0 && changes.removed == 0 && setMatches(&set, snap1, n1),
+          "first snapshot: everything added");
+    int unchangedSlot = earthquakeSetFind(&set, "ci41012799");
+
+    check(syncEarthquakeData(&set, url2, &changes) &&
+          changesAre(&set, &changes, "ci41012811,hv74712345",
+                     "ak0258eyq5b7,ci41012759,us7000qc1m", "nc75203716") &&
+          setMatches(&set, snap2, n2),
+          "second snapshot: upserts and deletions");
+    check(earthquakeSetFind(&set, "ci41012799") == unchangedSlot &&
+          earthquakeSetFind(&set, "nc75203716") < 0,
+          "slots stable, deleted id gone");
+
+    check(syncEarthquakeData(&set, url2, &changes) && changes.count == 0 &&
+          setMatches(&set, snap2, n2),
+          "same snapshot again: no changes");
+
+    check(applyEarthquakeFeed(&set, snap1, n1, &changes) &&
+          changesAre(&set, &changes, "nc75203716",
+                     "ak0258eyq5b7,ci41012759,us7000qc1m", "ci41012811,hv74712345") &&
+          setMatches(&set, snap1, n1),
+          "back to the first snapshot");
+
+    check(!syncEarthquakeData(&set, "file:///nonexistent/feed.json", &changes) &&
+          setMatches(&set, snap1, n1),
+          "failed download leaves the set alone");
+
+    /* an error reply is well-formed JSON, but must not empty the set */
+    char errorPath[] = "/tmp/syncTestXXXXXX";
+    int fd = mkstemp(errorPath);
+    const char *reply = "{\"metadata\":{\"status\":503},\"error\":\"busy\"}";
+    int wrote = fd >= 0 && write(fd, reply, strlen(reply)) == (ssize_t)strlen(reply);
+    if (fd >= 0) close(fd);
+    char errorUrl[64];
+    snprintf(errorUrl, sizeof(errorUrl), "file://%s", errorPath);
+    check(wrote && !syncEarthquakeData(&set, errorUrl, &changes) && setMatches(&set, snap1, n1),
+          "reply without features leaves the set");
+    if (fd >= 0) unlink(errorPath);
+
+    check(applyEarthquakeFeed(&set, NULL, 0, &changes) && changes.removed == n1 && set.live == 0,
+          "empty feed removes everything");
+
+    churn();
+
+    freeEarthquakeChanges(&changes);
+    freeEarthquakeSet(&set);
+    freeEarthquakeDataBatch(snap1);
+    freeEarthquakeDataBatch(snap2);
+    return failures ? 1 : 0;
+}
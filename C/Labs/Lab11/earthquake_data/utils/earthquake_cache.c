@@ -0,0 +1,298 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Columnar earthquake cache
+ *
+ * Description:
+ * Implements the binary earthquake cache declared in
+ * earthquake_cache.h.  File layout (every column starts on an 8-byte
+ * boundary):
+ *
+ *   CacheHeader
+ *   double   magnitude[n]
+ *   double   latitude[n]
+ *   double   longitude[n]
+ *   double   depth[n]
+ *   int64_t  timestamp[n]
+ *   int32_t  significance[n]
+ *   uint32_t idOffset[n]
+ *   uint32_t placeOffset[n]
+ *   char     heap[heapBytes]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "earthquake_cache.h"
+
+#define CACHE_MAGIC "EQCACHE"
+
+/* Reads back as another value when the file comes from a machine with
+ * the opposite byte order. */
+#define BYTE_ORDER_MARK 0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    int64_t count;
+    int64_t fetchedAt;
+    uint64_t heapBytes;
+    char source[EARTHQUAKE_CACHE_MAX_SOURCE];
+} CacheHeader;
+
+/* Byte offsets of the columns for a cache of n records. */
+typedef struct {
+    size_t magnitude, latitude, longitude, depth;
+    size_t timestamp, significance, idOffset, placeOffset;
+    size_t heap;
+} CacheLayout;
+
+static size_t align8(size_t bytes) {
+    return (bytes + 7) & ~(size_t)7;
+}
+
+static CacheLayout layoutFor(size_t n) {
+    CacheLayout l;
+    l.magnitude = align8(sizeof(CacheHeader));
+    l.latitude = l.magnitude + n * sizeof(double);
+    l.longitude = l.latitude + n * sizeof(double);
+    l.depth = l.longitude + n * sizeof(double);
+    l.timestamp = l.depth + n * sizeof(double);
+    l.significance = l.timestamp + n * sizeof(int64_t);
+    l.idOffset = align8(l.significance + n * sizeof(int32_t));
+    l.placeOffset = align8(l.idOffset + n * sizeof(uint32_t));
+    l.heap = align8(l.placeOffset + n * sizeof(uint32_t));
+    return l;
+}
+
+static const char *orEmpty(const char *s) {
+    return s ? s : "";
+}
+
+/* Writes bytes and then zero padding up to the offset `end`. */
+static int writePadded(FILE *out, const void *bytes, size_t len, size_t *at, size_t end) {
+    static const char zeros[8] = { 0 };
+    if (len && fwrite(bytes, 1, len, out) != len) return 0;
+    *at += len;
+    size_t pad = end - *at;
+    if (pad && fwrite(zeros, 1, pad, out) != pad) return 0;
+    *at = end;
+    return 1;
+}
+
+int writeEarthquakeCache(const char *path, const char *source, time_t fetchedAt,
+                         const EarthquakeData *data, int n) {
+    if (!path || !source || n < 0 || (!data && n > 0) ||
+        strlen(source) >= EARTHQUAKE_CACHE_MAX_SOURCE) {
+        return 0;
+    }
+    size_t count = (size_t)n;
+
+    /* string offsets first: the header records the heap size */
+    uint32_t *idOffset = malloc(sizeof(uint32_t) * (count ? count : 1));
+    uint32_t *placeOffset = malloc(sizeof(uint32_t) * (count ? count : 1));
+    void *column = malloc(sizeof(double) * (count ? count : 1));
+    size_t heapBytes = 0;
+    int ok = idOffset && placeOffset && column;
+    for (size_t i = 0; ok && i < count; i++) {
+        size_t idLen = strlen(orEmpty(data[i].id)) + 1;
+        size_t placeLen = strlen(orEmpty(data[i].locationName)) + 1;
+        if (heapBytes + idLen + placeLen > UINT32_MAX) ok = 0;
+        idOffset[i] = (uint32_t)heapBytes;
+        placeOffset[i] = (uint32_t)(heapBytes + idLen);
+        heapBytes += idLen + placeLen;
+    }
+
+    /* mkstemp creates a new file (mode 0600), never one planted at the name */
+    size_t tmpLen = strlen(path) + 8;
+    char *tmpPath = malloc(tmpLen);
+    FILE *out = NULL;
+    if (ok && tmpPath) {
+        snprintf(tmpPath, tmpLen, "%s.XXXXXX", path);
+        int fd = mkstemp(tmpPath);
+        out = fd >= 0 ? fdopen(fd, "wb") : NULL;
+        if (fd >= 0 && !out) {
+            close(fd);
+            remove(tmpPath);
+        }
+    }
+    ok = ok && out;
+
+    CacheLayout l = layoutFor(count);
+    size_t at = 0;
+    if (ok) {
+        CacheHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = EARTHQUAKE_CACHE_VERSION;
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.count = n;
+        header.fetchedAt = (int64_t)fetchedAt;
+        header.heapBytes = heapBytes;
+        strcpy(header.source, source);
+        ok = writePadded(out, &header, sizeof(header), &at, l.magnitude);
+    }
+
+    /* each numeric column is gathered into one buffer and written whole */
+    double *d = column;
+    for (int field = 0; ok && field < 4; field++) {
+        for (size_t i = 0; i < count; i++) {
+            const EarthquakeData *e = &data[i];
+            d[i] = field == 0 ? e->magnitude : field == 1 ? e->latitude
+                 : field == 2 ? e->longitude : e->depth;
+        }
+        ok = writePadded(out, d, count * sizeof(double), &at, at + count * sizeof(double));
+    }
+    if (ok) {
+        int64_t *t = column;
+        for (size_t i = 0; i < count; i++) t[i] = data[i].timestamp;
+        ok = writePadded(out, t, count * sizeof(int64_t), &at, l.significance);
+    }
+    if (ok) {
+        int32_t *s = column;
+        for (size_t i = 0; i < count; i++) s[i] = data[i].significance;
+        ok = writePadded(out, s, count * sizeof(int32_t), &at, l.idOffset);
+    }
+    ok = ok && writePadded(out, idOffset, count * sizeof(uint32_t), &at, l.placeOffset);
+    ok = ok && writePadded(out, placeOffset, count * sizeof(uint32_t), &at, l.heap);
+    for (size_t i = 0; ok && i < count; i++) {
+        const char *id = orEmpty(data[i].id);
+        const char *place = orEmpty(data[i].locationName);
+        ok = fwrite(id, 1, strlen(id) + 1, out) == strlen(id) + 1 &&
+             fwrite(place, 1, strlen(place) + 1, out) == strlen(place) + 1;
+    }
+
+    if (out && fclose(out) != 0) ok = 0;
+    if (ok) ok = rename(tmpPath, path) == 0;
+    if (!ok && out) remove(tmpPath);
+    free(tmpPath);
+    free(column);
+    free(placeOffset);
+    free(idOffset);
+    return ok;
+}
+
+/* Checks a header read from a file of fileBytes bytes (fileBytes is 0
+ * when the size is not being checked). */
+static int validHeader(const CacheHeader *header, const char *source, size_t fileBytes) {
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+        header->version != EARTHQUAKE_CACHE_VERSION ||
+        header->byteOrder != BYTE_ORDER_MARK ||
+        header->count < 0 || header->count > INT_MAX ||
+        header->heapBytes > UINT32_MAX ||
+        memchr(header->source, '\0', sizeof(header->source)) == NULL) {
+        return 0;
+    }
+    if (source && strcmp(header->source, source) != 0) return 0;
+    if (fileBytes) {
+        CacheLayout l = layoutFor((size_t)header->count);
+        if (l.heap + header->heapBytes != fileBytes) return 0;
+    }
+    return 1;
+}
+
+EarthquakeCache *openEarthquakeCache(const char *path, const char *source) {
+    if (!path) return NULL;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CacheHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t bytes = (size_t)st.st_size;
+    void *map = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    const CacheHeader *header = map;
+    EarthquakeCache *cache = NULL;
+    if (validHeader(header, source, bytes)) cache = malloc(sizeof(EarthquakeCache));
+    if (!cache) {
+        munmap(map, bytes);
+        return NULL;
+    }
+
+    const char *base = map;
+    CacheLayout l = layoutFor((size_t)header->count);
+    cache->n = (int)header->count;
+    cache->fetchedAt = (time_t)header->fetchedAt;
+    cache->magnitude = (const double *)(base + l.magnitude);
+    cache->latitude = (const double *)(base + l.latitude);
+    cache->longitude = (const double *)(base + l.longitude);
+    cache->depth = (const double *)(base + l.depth);
+    cache->timestamp = (const int64_t *)(base + l.timestamp);
+    cache->significance = (const int32_t *)(base + l.significance);
+    cache->idOffset = (const uint32_t *)(base + l.idOffset);
+    cache->placeOffset = (const uint32_t *)(base + l.placeOffset);
+    cache->heap = base + l.heap;
+    cache->map = map;
+    cache->mapBytes = bytes;
+
+    /* every string must start inside the heap, which must end in '\0' */
+    uint64_t heapBytes = header->heapBytes;
+    int ok = cache->n == 0 || (heapBytes > 0 && cache->heap[heapBytes - 1] == '\0');
+    for (int i = 0; ok && i < cache->n; i++) {
+        ok = cache->idOffset[i] < heapBytes && cache->placeOffset[i] < heapBytes;
+    }
+    if (!ok) {
+        closeEarthquakeCache(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+int earthquakeCacheIsFresh(const char *path, const char *source, int maxAgeSeconds) {
+    if (!path) return 0;
+    FILE *in = fopen(path, "rb");
+    if (!in) return 0;
+    CacheHeader header;
+    int ok = fread(&header, sizeof(header), 1, in) == 1 && validHeader(&header, source, 0);
+    fclose(in);
+    if (!ok) return 0;
+    time_t now = time(NULL);
+    /* a fetch time in the future means the clock moved; refetch */
+    return header.fetchedAt <= (int64_t)now && (int64_t)now - header.fetchedAt < maxAgeSeconds;
+}
+
+const char *earthquakeCacheId(const EarthquakeCache *cache, int i) {
+    return cache->heap + cache->idOffset[i];
+}
+
+const char *earthquakeCacheLocationName(const EarthquakeCache *cache, int i) {
+    return cache->heap + cache->placeOffset[i];
+}
+
+EarthquakeData *earthquakeCacheRows(const EarthquakeCache *cache) {
+    if (!cache) return NULL;
+    EarthquakeData *rows = malloc(sizeof(EarthquakeData) * (cache->n ? cache->n : 1));
+    if (!rows) return NULL;
+    for (int i = 0; i < cache->n; i++) {
+        /* the strings are never written through; the cast only drops const */
+        rows[i].id = (char *)earthquakeCacheId(cache, i);
+        rows[i].locationName = (char *)earthquakeCacheLocationName(cache, i);
+        rows[i].magnitude = cache->magnitude[i];
+        rows[i].significance = cache->significance[i];
+        rows[i].timestamp = (long)cache->timestamp[i];
+        rows[i].latitude = cache->latitude[i];
+        rows[i].longitude = cache->longitude[i];
+        rows[i].depth = cache->depth[i];
+    }
+    return rows;
+}
+
+void closeEarthquakeCache(EarthquakeCache *cache) {
+    if (!cache) return;
+    munmap(cache->map, cache->mapBytes);
+    free(cache);
+}
@@ -0,0 +1,97 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Columnar earthquake cache
+ *
+ * Description:
+ * Saves parsed earthquake feeds to a compact binary file and maps them
+ * back in without parsing.  The file holds a fixed header (magic,
+ * version, byte order, record count, fetch time and source URL), one
+ * fixed-width column per numeric field, and a single heap of
+ * NUL-terminated id and locationName strings addressed by offset.
+ *
+ * NOTE: cache files are specific to the machine's byte order and are
+ * rejected (not converted) elsewhere.  Strings returned from an open
+ * cache point into the mapping and stay valid until
+ * closeEarthquakeCache.
+ */
+
+#ifndef EARTHQUAKE_CACHE_H
+#define EARTHQUAKE_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "../earthquake.h"
+
+/* Bumped whenever the file layout changes; other versions are stale. */
+#define EARTHQUAKE_CACHE_VERSION 1
+
+/* Longest source URL stored in (and compared against) a cache. */
+#define EARTHQUAKE_CACHE_MAX_SOURCE 224
+
+typedef struct {
+    int n;                        /* number of earthquakes */
+    time_t fetchedAt;             /* when the feed was downloaded */
+    const double *magnitude;      /* the columns, n entries each */
+    const double *latitude;
+    const double *longitude;
+    const double *depth;
+    const int64_t *timestamp;
+    const int32_t *significance;
+    const uint32_t *idOffset;     /* offsets into heap */
+    const uint32_t *placeOffset;
+    const char *heap;
+    void *map;                    /* the whole file */
+    size_t mapBytes;
+} EarthquakeCache;
+
+/**
+ * Writes the given earthquakes, downloaded from <code>source</code> at
+ * <code>fetchedAt</code>, to a cache file at <code>path</code>.  The
+ * file is written to a new temporary file (mode 0600) next to it and
+ * renamed into place, so a reader never sees a partial cache.  Keep
+ * the cache in a directory only its user can write.  Returns 1 on
+ * success or 0 on failure (an over-long source or an I/O error).
+ */
+int writeEarthquakeCache(const char *path, const char *source, time_t fetchedAt,
+                         const EarthquakeData *data, int n);
+
+/**
+ * Maps the cache at <code>path</code> and checks its header and size.
+ * If <code>source</code> is not <code>NULL</code> the cache must have
+ * been written for that source.  Returns NULL when the file is missing,
+ * from another version, truncated or for another source.
+ */
+EarthquakeCache *openEarthquakeCache(const char *path, const char *source);
+
+/**
+ * Returns 1 if the cache at <code>path</code> is a valid cache of
+ * <code>source</code> fetched less than <code>maxAgeSeconds</code> ago,
+ * and 0 otherwise.
+ */
+int earthquakeCacheIsFresh(const char *path, const char *source, int maxAgeSeconds);
+
+/**
+ * Returns the id / locationName of earthquake i.
+ */
+const char *earthquakeCacheId(const EarthquakeCache *cache, int i);
+const char *earthquakeCacheLocationName(const EarthquakeCache *cache, int i);
+
+/**
+ * Builds an array of the cached earthquakes for code that takes
+ * <code>EarthquakeData</code>.  Numbers are copied out of the columns;
+ * id and locationName point into the mapping, so release the array with
+ * a single free() (never free its strings) before closing the cache.
+ * Returns NULL on allocation failure.
+ */
+EarthquakeData *earthquakeCacheRows(const EarthquakeCache *cache);
+
+/**
+ * Unmaps the cache and frees it.  Safe to pass NULL.
+ */
+void closeEarthquakeCache(EarthquakeCache *cache);
+
+#endif /* EARTHQUAKE_CACHE_H */
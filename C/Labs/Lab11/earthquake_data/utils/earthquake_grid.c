@@ -0,0 +1,305 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake lat/lon grid index
+ *
+ * Description:
+ * Implements the grid index declared in earthquake_grid.h.  Positions
+ * are stored cell by cell (row-major over latitude bands), so the cells
+ * a query reaches in one band are one contiguous run of positions.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "earthquake_grid.h"
+
+#define EARTH_RADIUS_KM 6371.0
+
+/* Positions up to this far past the radius by the dot product are
+ * settled by the exact distance (the dot product is far closer). */
+#define BOUNDARY_KM 0.01
+
+/* First radius tried by a nearest-neighbour search; it doubles until
+ * enough earthquakes are inside. */
+#define NEAREST_START_KM 250.0
+
+#define NUM_CELLS (EARTHQUAKE_GRID_ROWS * EARTHQUAKE_GRID_COLS)
+
+typedef struct {
+    int row;
+    double distance;
+} Match;
+
+typedef struct {
+    Match *items;
+    int count;
+    int cap;
+} MatchList;
+
+/* The cells a query region reaches: latitude bands rowLo..rowHi and
+ * numCols longitude bands starting at colLo (wrapping at 360). */
+typedef struct {
+    int rowLo;
+    int rowHi;
+    int colLo;
+    int numCols;
+} CellBox;
+
+static int cellRow(double lat) {
+    double r = floor(lat + 90.0);
+    /* the negated test also sends NaN to the first band */
+    if (!(r >= 0.0)) return 0;
+    return r >= EARTHQUAKE_GRID_ROWS ? EARTHQUAKE_GRID_ROWS - 1 : (int)r;
+}
+
+static int cellCol(double lon) {
+    double c = floor(lon + 180.0);
+    if (!(c == c) || isinf(c)) return 0;
+    int col = (int)fmod(c, EARTHQUAKE_GRID_COLS);
+    return col < 0 ? col + EARTHQUAKE_GRID_COLS : col;
+}
+
+/* A query point as the prefilter and the exact distance use it. */
+typedef struct {
+    double x, y, z;         /* unit vector */
+    double cosLat, lonRad;  /* z is the sine of the latitude */
+    double minDot;          /* dot products below this are out of range */
+    double radiusKm;
+} Origin;
+
+/*
+ * The unit vector of (lat, lon), with the sine and cosine of the
+ * latitude and the longitude in radians computed exactly as
+ * airDistance computes them.
+ */
+static void unitVector(double lat, double lon, double *x, double *y, double *z, double *cosLat,
+                       double *lonRad) {
+    double phi = lat * M_PI / 180;
+    *lonRad = lon * M_PI / 180;
+    *z = sin(phi);
+    *cosLat = cos(phi);
+    *x = *cosLat * cos(*lonRad);
+    *y = *cosLat * sin(*lonRad);
+}
+
+static void makeOrigin(double lat, double lon, double radiusKm, Origin *o) {
+    unitVector(lat, lon, &o->x, &o->y, &o->z, &o->cosLat, &o->lonRad);
+    double angle = (radiusKm + BOUNDARY_KM) / EARTH_RADIUS_KM;
+    o->minDot = angle < M_PI ? cos(angle) : -INFINITY;
+    o->radiusKm = radiusKm;
+}
+
+/*
+ * airDistance from the origin to position i, from the parts computed
+ * once per point (same operations, same result), except that the acos
+ * argument rounding just above 1 for (nearly) identical points reads
+ * as 0 km instead of NaN.
+ */
+static double exactDistance(const Origin *o, const EarthquakeGrid *grid, int i) {
+    double d = acos(o->z * grid->zs[i] +
+                    o->cosLat * grid->cosLats[i] * cos(grid->lonRads[i] - o->lonRad)) * 6371.0;
+    return isnan(d) ? 0.0 : d;
+}
+
+/*
+ * Cells holding every point within radiusKm of some point of the
+ * region [latLo, latHi] x [lonLo, lonHi].  The longitude reach of a
+ * spherical cap grows with |latitude|, so the widest reach over the
+ * region is used; caps containing a pole take every longitude.
+ */
+static void capBox(double latLo, double latHi, double lonLo, double lonHi,
+                   double radiusKm, CellBox *box) {
+    double angle = radiusKm / EARTH_RADIUS_KM;
+    double dLat = angle * 180.0 / M_PI + 1e-9;
+    double south = latLo - dLat, north = latHi + dLat;
+    box->rowLo = cellRow(south < -90.0 ? -90.0 : south);
+    box->rowHi = cellRow(north > 90.0 ? 90.0 : north);
+
+    int fullCircle = south <= -90.0 || north >= 90.0 || angle >= M_PI / 2;
+    if (!fullCircle) {
+        double maxAbsLat = fmax(fabs(latLo), fabs(latHi)) * M_PI / 180.0;
+        double s = sin(angle) / cos(maxAbsLat);
+        if (s >= 1.0) {
+            fullCircle = 1;
+        } else {
+            double dLon = asin(s) * 180.0 / M_PI + 1e-9;
+            double west = lonLo - dLon, east = lonHi + dLon;
+            if (east - west >= 359.0) {
+                fullCircle = 1;
+            } else {
+                box->colLo = cellCol(west);
+                int colHi = cellCol(east);
+                box->numCols = colHi - box->colLo + 1;
+                if (box->numCols <= 0) box->numCols += EARTHQUAKE_GRID_COLS;
+            }
+        }
+    }
+    if (fullCircle) {
+        box->colLo = 0;
+        box->numCols = EARTHQUAKE_GRID_COLS;
+    }
+}
+
+static int matchPush(MatchList *list, int row, double distance) {
+    if (list->count == list->cap) {
+        int cap = list->cap ? list->cap * 2 : 64;
+        Match *grown = realloc(list->items, sizeof(Match) * cap);
+        if (!grown) return 0;
+        list->items = grown;
+        list->cap = cap;
+    }
+    list->items[list->count].row = row;
+    list->items[list->count].distance = distance;
+    list->count++;
+    return 1;
+}
+
+static int compareMatch(const void *a, const void *b) {
+    const Match *x = a, *y = b;
+    if (x->distance != y->distance) return x->distance < y->distance ? -1 : 1;
+    return x->row - y->row;
+}
+
+/*
+ * Adds the positions [from, to) within the radius of the origin to
+ * list.  The dot product of unit
+ * vectors rules out nearly every position without any trigonometry.
+ */
+static int matchRun(const EarthquakeGrid *grid, int from, int to, const Origin *o,
+                    MatchList *list) {
+    for (int i = from; i < to; i++) {
+        /* NaN coordinates fail this test too */
+        if (!(o->x * grid->xs[i] + o->y * grid->ys[i] + o->z * grid->zs[i] >= o->minDot)) continue;
+        double exact = exactDistance(o, grid, i);
+        if (exact <= o->radiusKm && !matchPush(list, grid->rows[i], exact)) return 0;
+    }
+    return 1;
+}
+
+/* Adds every earthquake within radiusKm of (lat, lon) to list. */
+static int collectRadius(const EarthquakeGrid *grid, double lat, double lon, double radiusKm,
+                         MatchList *list) {
+    CellBox box;
+    Origin o;
+    capBox(lat, lat, lon, lon, radiusKm, &box);
+    makeOrigin(lat, lon, radiusKm, &o);
+    for (int r = box.rowLo; r <= box.rowHi; r++) {
+        /* the band's cells from colLo on, wrapping once at the antimeridian */
+        const int *band = grid->cellStart + r * EARTHQUAKE_GRID_COLS;
+        int east = box.colLo + box.numCols;
+        int wrapped = east > EARTHQUAKE_GRID_COLS ? east - EARTHQUAKE_GRID_COLS : 0;
+        if (!matchRun(grid, band[box.colLo], band[east - wrapped], &o, list) ||
+            !matchRun(grid, band[0], band[wrapped], &o, list)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+EarthquakeGrid *createEarthquakeGrid(const EarthquakeData *data, int n) {
+    if (n < 0 || (!data && n > 0)) return NULL;
+    EarthquakeGrid *grid = calloc(1, sizeof(EarthquakeGrid));
+    if (!grid) return NULL;
+    size_t slots = n > 0 ? (size_t)n : 1;
+    grid->n = n;
+    grid->cellStart = calloc(NUM_CELLS + 1, sizeof(int));
+    grid->rows = malloc(sizeof(int) * slots);
+    grid->xs = malloc(sizeof(double) * slots);
+    grid->ys = malloc(sizeof(double) * slots);
+    grid->zs = malloc(sizeof(double) * slots);
+    grid->cosLats = malloc(sizeof(double) * slots);
+    grid->lonRads = malloc(sizeof(double) * slots);
+    int *cellOf = malloc(sizeof(int) * slots);
+    if (!grid->cellStart || !grid->rows || !grid->xs || !grid->ys || !grid->zs ||
+        !grid->cosLats || !grid->lonRads || !cellOf) {
+        free(cellOf);
+        freeEarthquakeGrid(grid);
+        return NULL;
+    }
+
+    /* counting sort by cell, keeping array order within a cell */
+    for (int i = 0; i < n; i++) {
+        cellOf[i] = cellRow(data[i].latitude) * EARTHQUAKE_GRID_COLS + cellCol(data[i].longitude);
+        grid->cellStart[cellOf[i] + 1]++;
+    }
+    for (int c = 0; c < NUM_CELLS; c++) {
+        grid->cellStart[c + 1] += grid->cellStart[c];
+    }
+    int *next = malloc(sizeof(int) * NUM_CELLS);
+    if (!next) {
+        free(cellOf);
+        freeEarthquakeGrid(grid);
+        return NULL;
+    }
+    memcpy(next, grid->cellStart, sizeof(int) * NUM_CELLS);
+    for (int i = 0; i < n; i++) {
+        int at = next[cellOf[i]]++;
+        grid->rows[at] = i;
+        unitVector(data[i].latitude, data[i].longitude, &grid->xs[at], &grid->ys[at],
+                   &grid->zs[at], &grid->cosLats[at], &grid->lonRads[at]);
+    }
+    free(next);
+    free(cellOf);
+    return grid;
+}
+
+/* Copies up to maxRows matches (sorted first) out; returns the total. */
+static int copyMatches(MatchList *list, int *rows, double *distances, int maxRows) {
+    if (list->count > 1) qsort(list->items, list->count, sizeof(Match), compareMatch);
+    int written = list->count < maxRows ? list->count : maxRows;
+    for (int i = 0; i < written; i++) {
+        rows[i] = list->items[i].row;
+        if (distances) distances[i] = list->items[i].distance;
+    }
+    return list->count;
+}
+
+int earthquakeGridRadius(const EarthquakeGrid *grid, double lat, double lon, double radiusKm,
+                         int *rows, double *distances, int maxRows) {
+    if (!grid || (!rows && maxRows > 0) || !(radiusKm >= 0.0)) return 0;
+    MatchList list = { NULL, 0, 0 };
+    int total = 0;
+    if (collectRadius(grid, lat, lon, radiusKm, &list)) {
+        total = copyMatches(&list, rows, distances, maxRows);
+    }
+    free(list.items);
+    return total;
+}
+
+int earthquakeGridNearest(const EarthquakeGrid *grid, double lat, double lon, int k,
+                          int *rows, double *distances) {
+    if (!grid || k <= 0 || !rows) return 0;
+    MatchList list = { NULL, 0, 0 };
+    int want = k < grid->n ? k : grid->n;
+    /* past half the circumference every point is inside */
+    double maxRadius = M_PI * EARTH_RADIUS_KM + 1.0;
+    double radius = NEAREST_START_KM;
+    int ok = 1, written = 0;
+    for (;;) {
+        list.count = 0;
+        ok = collectRadius(grid, lat, lon, radius, &list);
+        if (!ok || list.count >= want || radius >= maxRadius) break;
+        radius = radius * 2 < maxRadius ? radius * 2 : maxRadius;
+    }
+    if (ok) {
+        copyMatches(&list, rows, distances, want);
+        written = list.count < want ? list.count : want;
+    }
+    free(list.items);
+    return written;
+}
+
+void freeEarthquakeGrid(EarthquakeGrid *grid) {
+    if (!grid) return;
+    free(grid->cellStart);
+    free(grid->rows);
+    free(grid->xs);
+    free(grid->ys);
+    free(grid->zs);
+    free(grid->cosLats);
+    free(grid->lonRads);
+    free(grid);
+}
@@ -0,0 +1,68 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake lat/lon grid index
+ *
+ * Description:
+ * A 1-degree latitude/longitude grid over an EarthquakeData array for
+ * "earthquakes within R km of a point" and k-nearest queries.  A query
+ * visits only the cells that a spherical cap of radius R can reach
+ * (handling the poles and the antimeridian), rules out most positions
+ * there with a dot product of unit vectors and computes airDistance for
+ * the rest from sines and cosines taken when the grid was built, so
+ * answers match a full scan with airDistance exactly.
+ *
+ * NOTE: distances are in kilometers on the 6371 km sphere used by
+ * airDistance, and reported distances are airDistance values.  The grid
+ * copies the coordinates it needs, so the array need not outlive it;
+ * results are row numbers of the array.
+ */
+
+#ifndef EARTHQUAKE_GRID_H
+#define EARTHQUAKE_GRID_H
+
+#include "../earthquake.h"
+
+#define EARTHQUAKE_GRID_ROWS 180  /* 1-degree latitude bands */
+#define EARTHQUAKE_GRID_COLS 360  /* 1-degree longitude bands */
+
+typedef struct {
+    int n;
+    int *cellStart;   /* cell c holds positions [cellStart[c], cellStart[c + 1]) */
+    int *rows;        /* row number of each position */
+    double *xs;       /* unit vector of each position */
+    double *ys;
+    double *zs;       /* also the sine of its latitude */
+    double *cosLats;  /* cosine of its latitude */
+    double *lonRads;  /* its longitude in radians */
+} EarthquakeGrid;
+
+/**
+ * Builds the grid over the n earthquakes in data in O(n).  Returns NULL
+ * on allocation failure or bad arguments.
+ */
+EarthquakeGrid *createEarthquakeGrid(const EarthquakeData *data, int n);
+
+/**
+ * Finds the earthquakes within radiusKm of (lat, lon) and writes up to
+ * maxRows of them, nearest first, to rows and (if not NULL) distances.
+ * Returns the total number within the radius, which may exceed maxRows.
+ */
+int earthquakeGridRadius(const EarthquakeGrid *grid, double lat, double lon, double radiusKm,
+                         int *rows, double *distances, int maxRows);
+
+/**
+ * Writes the k earthquakes nearest to (lat, lon), nearest first (ties:
+ * lower row first), to rows and (if not NULL) distances and returns how
+ * many were written (fewer than k only if the grid holds fewer).
+ */
+int earthquakeGridNearest(const EarthquakeGrid *grid, double lat, double lon, int k,
+                          int *rows, double *distances);
+
+/**
+ * Frees the grid.  Safe to pass NULL.
+ */
+void freeEarthquakeGrid(EarthquakeGrid *grid);
+
+#endif /* EARTHQUAKE_GRID_H */
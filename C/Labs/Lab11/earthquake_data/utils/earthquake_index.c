@@ -0,0 +1,310 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake time/magnitude index
+ *
+ * Description:
+ * Implements the time-sorted, magnitude-bucketed index declared in
+ * earthquake_index.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "earthquake_index.h"
+
+static int bucketOf(double magnitude) {
+    double offset = (magnitude - EARTHQUAKE_INDEX_MIN_MAGNITUDE) / EARTHQUAKE_INDEX_BUCKET_WIDTH;
+    if (offset < 1.0) return 0;
+    if (offset >= EARTHQUAKE_INDEX_BUCKETS - 1) return EARTHQUAKE_INDEX_BUCKETS - 1;
+    return (int)offset;
+}
+
+/* A row and its sort key, so the comparator needs no outside state. */
+typedef struct {
+    long time;
+    int row;
+} TimedRow;
+
+static int compareTime(const void *a, const void *b) {
+    const TimedRow *x = a, *y = b;
+    if (x->time != y->time) return x->time < y->time ? -1 : 1;
+    return x->row - y->row;  /* keep equal timestamps in array order */
+}
+
+/* First position in times[0..n) with times[i] >= t. */
+static int lowerBound(const long *times, int n, long t) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (times[mid] < t) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* First position in times[0..n) with times[i] > t. */
+static int upperBound(const long *times, int n, long t) {
+    int lo = 0, hi = n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (times[mid] <= t) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/* Of two positions in byTime, the more significant (earlier on ties). */
+static int moreSignificant(const EarthquakeIndex *index, int a, int b) {
+    int sa = index->data[index->byTime[a]].significance;
+    int sb = index->data[index->byTime[b]].significance;
+    if (sa != sb) return sa > sb ? a : b;
+    return a < b ? a : b;
+}
+
+static int buildSparseTable(EarthquakeIndex *index) {
+    int n = index->n;
+    int levels = 1;
+    while ((1 << levels) <= n) levels++;
+    index->maxSig = calloc(levels, sizeof(int *));
+    if (!index->maxSig) return 0;
+    index->levels = levels;
+    for (int j = 0; j < levels; j++) {
+        int width = 1 << j;
+        int count = n - width + 1;
+        index->maxSig[j] = malloc(sizeof(int) * (count > 0 ? count : 1));
+        if (!index->maxSig[j]) return 0;
+        for (int i = 0; i < count; i++) {
+            index->maxSig[j][i] = j == 0 ? i
+                : moreSignificant(index, index->maxSig[j - 1][i],
+                                  index->maxSig[j - 1][i + width / 2]);
+        }
+    }
+    return 1;
+}
+
+/* Position in byTime of the most significant of positions [lo, hi]. */
+static int rangeMax(const EarthquakeIndex *index, int lo, int hi) {
+    int j = 0;
+    while ((2 << j) <= hi - lo + 1) j++;
+    return moreSignificant(index, index->maxSig[j][lo], index->maxSig[j][hi - (1 << j) + 1]);
+}
+
+EarthquakeIndex *createEarthquakeIndex(const EarthquakeData *data, int n) {
+    if (n < 0 || (!data && n > 0)) return NULL;
+    EarthquakeIndex *index = calloc(1, sizeof(EarthquakeIndex));
+    if (!index) return NULL;
+    index->data = data;
+    index->n = n;
+    size_t slots = n > 0 ? (size_t)n : 1;
+    index->byTime = malloc(sizeof(int) * slots);
+    index->times = malloc(sizeof(long) * slots);
+    index->byBucket = malloc(sizeof(int) * slots);
+    index->bucketTimes = malloc(sizeof(long) * slots);
+    if (!index->byTime || !index->times || !index->byBucket || !index->bucketTimes) {
+        freeEarthquakeIndex(index);
+        return NULL;
+    }
+
+    TimedRow *sorted = malloc(sizeof(TimedRow) * slots);
+    if (!sorted) {
+        freeEarthquakeIndex(index);
+        return NULL;
+    }
+    for (int i = 0; i < n; i++) {
+        sorted[i].time = data[i].timestamp;
+        sorted[i].row = i;
+    }
+    qsort(sorted, n, sizeof(TimedRow), compareTime);
+    for (int i = 0; i < n; i++) {
+        index->byTime[i] = sorted[i].row;
+        index->times[i] = sorted[i].time;
+    }
+    free(sorted);
+
+    /* counting sort into buckets; walking byTime keeps each bucket in time
+     * order.  Rows with a NaN magnitude match no threshold, so they are
+     * left out of the buckets. */
+    int counts[EARTHQUAKE_INDEX_BUCKETS] = { 0 };
+    for (int b = 0; b < EARTHQUAKE_INDEX_BUCKETS; b++) {
+        index->bucketMin[b] = 0.0;
+        index->bucketMax[b] = 0.0;
+    }
+    for (int i = 0; i < n; i++) {
+        double magnitude = data[i].magnitude;
+        if (isnan(magnitude)) continue;
+        int b = bucketOf(magnitude);
+        if (counts[b] == 0 || magnitude < index->bucketMin[b]) index->bucketMin[b] = magnitude;
+        if (counts[b] == 0 || magnitude > index->bucketMax[b]) index->bucketMax[b] = magnitude;
+        counts[b]++;
+    }
+    index->bucketStart[0] = 0;
+    for (int b = 0; b < EARTHQUAKE_INDEX_BUCKETS; b++) {
+        index->bucketStart[b + 1] = index->bucketStart[b] + counts[b];
+    }
+    int next[EARTHQUAKE_INDEX_BUCKETS];
+    memcpy(next, index->bucketStart, sizeof(next));
+    for (int i = 0; i < n; i++) {
+        int row = index->byTime[i];
+        if (isnan(data[row].magnitude)) continue;
+        int at = next[bucketOf(data[row].magnitude)]++;
+        index->byBucket[at] = row;
+        index->bucketTimes[at] = index->times[i];
+    }
+
+    if (!buildSparseTable(index)) {
+        freeEarthquakeIndex(index);
+        return NULL;
+    }
+    return index;
+}
+
+EarthquakeSpan earthquakeIndexWindow(const EarthquakeIndex *index, long t0, long t1) {
+    EarthquakeSpan span = { NULL, 0 };
+    if (!index || t0 > t1) return span;
+    int lo = lowerBound(index->times, index->n, t0);
+    int hi = upperBound(index->times, index->n, t1);
+    span.rows = index->byTime + lo;
+    span.count = hi - lo;
+    return span;
+}
+
+/* Records a span if there is room; always counts it. */
+static void addSpan(EarthquakeSpan *spans, int maxSpans, int *numSpans, const int *rows, int count) {
+    if (count <= 0) return;
+    if (*numSpans < maxSpans) {
+        spans[*numSpans].rows = rows;
+        spans[*numSpans].count = count;
+    }
+    (*numSpans)++;
+}
+
+int earthquakeIndexQuery(const EarthquakeIndex *index, double minMagnitude,
+                         long t0, long t1, EarthquakeSpan *spans, int maxSpans) {
+    if (!index || t0 > t1 || (!spans && maxSpans > 0)) return 0;
+    int numSpans = 0;
+    for (int b = 0; b < EARTHQUAKE_INDEX_BUCKETS; b++) {
+        int start = index->bucketStart[b];
+        int size = index->bucketStart[b + 1] - start;
+        /* real bounds, not nominal ones, decide whether a bucket qualifies */
+        if (size == 0 || index->bucketMax[b] < minMagnitude) continue;
+        const long *times = index->bucketTimes + start;
+        int lo = lowerBound(times, size, t0);
+        int hi = upperBound(times, size, t1);
+        const int *rows = index->byBucket + start;
+        if (index->bucketMin[b] >= minMagnitude) {
+            addSpan(spans, maxSpans, &numSpans, rows + lo, hi - lo);
+            continue;
+        }
+        /* the bucket straddling minMagnitude: emit runs of qualifying rows */
+        int runStart = lo;
+        for (int i = lo; i < hi; i++) {
+            if (index->data[rows[i]].magnitude < minMagnitude) {
+                addSpan(spans, maxSpans, &numSpans, rows + runStart, i - runStart);
+                runStart = i + 1;
+            }
+        }
+        addSpan(spans, maxSpans, &numSpans, rows + runStart, hi - runStart);
+    }
+    return numSpans;
+}
+
+int earthquakeIndexHistogram(const EarthquakeIndex *index, long t0, long t1, int *counts) {
+    if (!index || !counts) return 0;
+    int total = 0;
+    for (int b = 0; b < EARTHQUAKE_INDEX_BUCKETS; b++) {
+        int start = index->bucketStart[b];
+        int size = index->bucketStart[b + 1] - start;
+        counts[b] = 0;
+        if (size == 0 || t0 > t1) continue;
+        const long *times = index->bucketTimes + start;
+        counts[b] = upperBound(times, size, t1) - lowerBound(times, size, t0);
+        total += counts[b];
+    }
+    return total;
+}
+
+/* A range of byTime positions and its most significant position. */
+typedef struct {
+    int lo;
+    int hi;
+    int best;
+} Range;
+
+/* True if range a should come off the heap before range b. */
+static int rangeFirst(const EarthquakeIndex *index, const Range *a, const Range *b) {
+    return moreSignificant(index, a->best, b->best) == a->best;
+}
+
+static void heapPush(const EarthquakeIndex *index, Range *heap, int *size, Range r) {
+    int i = (*size)++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!rangeFirst(index, &r, &heap[parent])) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = r;
+}
+
+static Range heapPop(const EarthquakeIndex *index, Range *heap, int *size) {
+    Range top = heap[0];
+    Range last = heap[--(*size)];
+    int i = 0;
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= *size) break;
+        if (child + 1 < *size && rangeFirst(index, &heap[child + 1], &heap[child])) child++;
+        if (!rangeFirst(index, &heap[child], &last)) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*size > 0) heap[i] = last;
+    return top;
+}
+
+int earthquakeIndexTopSignificance(const EarthquakeIndex *index, long t0, long t1,
+                                   int k, int *rows) {
+    if (!index || k <= 0 || !rows || t0 > t1) return 0;
+    int lo = lowerBound(index->times, index->n, t0);
+    int hi = upperBound(index->times, index->n, t1) - 1;
+    if (lo > hi) return 0;
+
+    /* each pop adds at most one range net, so k + 1 slots suffice */
+    Range *heap = malloc(sizeof(Range) * (k + 1));
+    if (!heap) return 0;
+    int size = 0;
+    Range whole = { lo, hi, rangeMax(index, lo, hi) };
+    heapPush(index, heap, &size, whole);
+
+    int written = 0;
+    while (written < k && size > 0) {
+        Range r = heapPop(index, heap, &size);
+        rows[written++] = index->byTime[r.best];
+        if (r.lo < r.best) {
+            Range left = { r.lo, r.best - 1, rangeMax(index, r.lo, r.best - 1) };
+            heapPush(index, heap, &size, left);
+        }
+        if (r.best < r.hi) {
+            Range right = { r.best + 1, r.hi, rangeMax(index, r.best + 1, r.hi) };
+            heapPush(index, heap, &size, right);
+        }
+    }
+    free(heap);
+    return written;
+}
+
+void freeEarthquakeIndex(EarthquakeIndex *index) {
+    if (!index) return;
+    if (index->maxSig) {
+        for (int j = 0; j < index->levels; j++) free(index->maxSig[j]);
+        free(index->maxSig);
+    }
+    free(index->byTime);
+    free(index->times);
+    free(index->byBucket);
+    free(index->bucketTimes);
+    free(index);
+}
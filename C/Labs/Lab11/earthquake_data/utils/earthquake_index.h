@@ -0,0 +1,102 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Earthquake time/magnitude index
+ *
+ * Description:
+ * An index over an EarthquakeData array for time-windowed queries:
+ * every earthquake in [t0, t1], those with magnitude >= M in the window,
+ * a magnitude histogram of the window and the k most significant
+ * earthquakes in the window.
+ *
+ * The index keeps the rows in timestamp order and, separately, grouped
+ * into magnitude buckets (each bucket in timestamp order), plus a sparse
+ * table of significance maxima.  Windows are found by binary search, so
+ * a query costs O(log n) per bucket it touches plus the size of its
+ * answer; only the one bucket that straddles M is scanned row by row.
+ * Rows whose magnitude is NaN are in the time order (windows and
+ * significance) but in no bucket, so magnitude queries and histograms
+ * never return them.
+ *
+ * NOTE: answers are EarthquakeSpan views into the index (row numbers of
+ * the indexed array), not copies; they stay valid until the index is
+ * freed.  The index does not copy the array, which must outlive it and
+ * not change while it is in use.
+ */
+
+#ifndef EARTHQUAKE_INDEX_H
+#define EARTHQUAKE_INDEX_H
+
+#include "../earthquake.h"
+
+/* Magnitude buckets: [EARTHQUAKE_INDEX_MIN_MAGNITUDE + i * width, +width),
+ * with the first and last buckets open-ended. */
+#define EARTHQUAKE_INDEX_BUCKETS 120
+#define EARTHQUAKE_INDEX_MIN_MAGNITUDE -2.0
+#define EARTHQUAKE_INDEX_BUCKET_WIDTH 0.1
+
+/* A run of row numbers (indexes into the indexed array). */
+typedef struct {
+    const int *rows;
+    int count;
+} EarthquakeSpan;
+
+typedef struct {
+    const EarthquakeData *data;
+    int n;
+    int *byTime;          /* rows in timestamp order */
+    long *times;          /* times[i] = timestamp of byTime[i] */
+    int *byBucket;        /* rows by magnitude bucket, then timestamp (no NaN) */
+    long *bucketTimes;    /* bucketTimes[i] = timestamp of byBucket[i] */
+    int bucketStart[EARTHQUAKE_INDEX_BUCKETS + 1];
+    double bucketMin[EARTHQUAKE_INDEX_BUCKETS];  /* smallest magnitude in bucket */
+    double bucketMax[EARTHQUAKE_INDEX_BUCKETS];  /* largest magnitude in bucket */
+    int levels;           /* rows of the sparse table */
+    int **maxSig;         /* maxSig[j][i]: position in byTime of the most
+                             significant of byTime[i .. i + 2^j - 1] */
+} EarthquakeIndex;
+
+/**
+ * Builds the index over the n earthquakes in data in O(n log n).
+ * Returns NULL on allocation failure or bad arguments.
+ */
+EarthquakeIndex *createEarthquakeIndex(const EarthquakeData *data, int n);
+
+/**
+ * Returns every earthquake with t0 <= timestamp <= t1, in timestamp
+ * order, as a single span.
+ */
+EarthquakeSpan earthquakeIndexWindow(const EarthquakeIndex *index, long t0, long t1);
+
+/**
+ * Finds every earthquake with magnitude >= minMagnitude and
+ * t0 <= timestamp <= t1.  The answer is written as up to maxSpans spans
+ * (each in timestamp order, grouped from the lowest magnitude bucket
+ * up); the return value is the number of spans the full answer needs,
+ * so a larger array can be passed if it exceeds maxSpans.
+ */
+int earthquakeIndexQuery(const EarthquakeIndex *index, double minMagnitude,
+                         long t0, long t1, EarthquakeSpan *spans, int maxSpans);
+
+/**
+ * Counts the earthquakes in [t0, t1] per magnitude bucket into
+ * counts[EARTHQUAKE_INDEX_BUCKETS] and returns the total (which leaves
+ * out NaN magnitudes).
+ */
+int earthquakeIndexHistogram(const EarthquakeIndex *index, long t0, long t1, int *counts);
+
+/**
+ * Writes the rows of the (up to) k most significant earthquakes in
+ * [t0, t1] to rows, most significant first (ties: earlier first), and
+ * returns how many were written.  Runs in O(log n + k log k).
+ */
+int earthquakeIndexTopSignificance(const EarthquakeIndex *index, long t0, long t1,
+                                   int k, int *rows);
+
+/**
+ * Frees the index (not the indexed array).  Safe to pass NULL.
+ */
+void freeEarthquakeIndex(EarthquakeIndex *index);
+
+#endif /* EARTHQUAKE_INDEX_H */
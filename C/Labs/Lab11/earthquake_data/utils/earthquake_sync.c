@@ -0,0 +1,294 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Incremental earthquake feed sync
+ *
+ * Description:
+ * Implements the slot set and feed diffing declared in
+ * earthquake_sync.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+
+#include "earthquake_sync.h"
+#include "utils.h"
+
+#define SLOT_FREE 0
+#define SLOT_LIVE 1
+#define SLOT_REMOVED 2
+
+/* Compact the arena once dead strings exceed the live ones by this much. */
+#define COMPACT_SLACK 65536
+
+static uint32_t hashId(const char *id) {
+    uint32_t hash = 2166136261u;  /* FNV-1a */
+    for (; *id; id++) hash = (hash ^ (unsigned char)*id) * 16777619u;
+    return hash;
+}
+
+static size_t slotBytes(const EarthquakeData *data) {
+    return strlen(data->id) + strlen(data->locationName) + 2;
+}
+
+/* Equal, counting two NaNs as equal so they do not read as a change. */
+static int sameNumber(double a, double b) {
+    return a == b || (isnan(a) && isnan(b));
+}
+
+static int sameEarthquake(const EarthquakeData *a, const EarthquakeData *b) {
+    return sameNumber(a->magnitude, b->magnitude) && a->significance == b->significance &&
+           a->timestamp == b->timestamp && sameNumber(a->latitude, b->latitude) &&
+           sameNumber(a->longitude, b->longitude) && sameNumber(a->depth, b->depth) &&
+           strcmp(a->locationName, b->locationName) == 0;
+}
+
+/* Table position of id, or of the empty entry where it would go. */
+static int probe(const EarthquakeSet *set, const char *id, uint32_t hash) {
+    int mask = set->tableSize - 1;
+    int at = hash & mask;
+    while (set->table[at] >= 0 && strcmp(set->data[set->table[at]].id, id) != 0) {
+        at = (at + 1) & mask;
+    }
+    return at;
+}
+
+static int rebuildTable(EarthquakeSet *set, int size) {
+    int *table = malloc(sizeof(int) * size);
+    if (!table) return 0;
+    for (int i = 0; i < size; i++) table[i] = -1;
+    free(set->table);
+    set->table = table;
+    set->tableSize = size;
+    for (int slot = 0; slot < set->slots; slot++) {
+        if (set->state[slot] == SLOT_LIVE) {
+            set->table[probe(set, set->data[slot].id, hashId(set->data[slot].id))] = slot;
+        }
+    }
+    return 1;
+}
+
+/* Removes slot's id from the table, shifting later entries of its run back. */
+static void unlinkSlot(EarthquakeSet *set, int slot) {
+    int mask = set->tableSize - 1;
+    int hole = probe(set, set->data[slot].id, hashId(set->data[slot].id));
+    set->table[hole] = -1;
+    for (int at = (hole + 1) & mask; set->table[at] >= 0; at = (at + 1) & mask) {
+        int moving = set->table[at];
+        int home = hashId(set->data[moving].id) & mask;
+        /* move it back unless its home lies cyclically in (hole, at] */
+        if (((at - home) & mask) >= ((at - hole) & mask)) {
+            set->table[hole] = moving;
+            set->table[at] = -1;
+            hole = at;
+        }
+    }
+}
+
+static int growSlots(EarthquakeSet *set) {
+    int capacity = set->capacity ? set->capacity * 2 : 64;
+    EarthquakeData *data = growEarthquakeDataBatch(set->data, capacity);
+    if (!data) return 0;
+    set->data = data;
+    unsigned char *state = realloc(set->state, capacity);
+    if (!state) return 0;
+    set->state = state;
+    int *seen = realloc(set->seen, sizeof(int) * capacity);
+    if (!seen) return 0;
+    set->seen = seen;
+    int *freeSlots = realloc(set->freeSlots, sizeof(int) * capacity);
+    if (!freeSlots) return 0;
+    set->freeSlots = freeSlots;
+    set->capacity = capacity;
+    return 1;
+}
+
+static int writeSlot(EarthquakeSet *set, int slot, const EarthquakeData *record) {
+    if (!initEarthquakeDataInBatch(set->data, slot, record->id, record->locationName,
+                                   record->magnitude, record->significance, record->timestamp,
+                                   record->latitude, record->longitude, record->depth)) {
+        return 0;
+    }
+    set->stringBytes += slotBytes(&set->data[slot]);
+    return 1;
+}
+
+static int addChange(EarthquakeChanges *changes, EarthquakeChangeKind kind, int slot) {
+    if (changes->count == changes->capacity) {
+        int capacity = changes->capacity ? changes->capacity * 2 : 64;
+        EarthquakeChange *items = realloc(changes->items, sizeof(EarthquakeChange) * capacity);
+        if (!items) return 0;
+        changes->items = items;
+        changes->capacity = capacity;
+    }
+    changes->items[changes->count].kind = kind;
+    changes->items[changes->count].slot = slot;
+    changes->count++;
+    if (kind == EARTHQUAKE_ADDED) changes->added++;
+    else if (kind == EARTHQUAKE_UPDATED) changes->updated++;
+    else changes->removed++;
+    return 1;
+}
+
+/* Copies the strings of every occupied slot into a fresh arena. */
+static int compactStrings(EarthquakeSet *set) {
+    EarthquakeData *data = createEarthquakeDataBatch(set->capacity);
+    if (!data) return 0;
+    size_t bytes = 0;
+    for (int slot = 0; slot < set->slots; slot++) {
+        const EarthquakeData *old = &set->data[slot];
+        if (set->state[slot] == SLOT_FREE) {
+            memset(&data[slot], 0, sizeof(EarthquakeData));
+            continue;
+        }
+        if (!initEarthquakeDataInBatch(data, slot, old->id, old->locationName, old->magnitude,
+                                       old->significance, old->timestamp, old->latitude,
+                                       old->longitude, old->depth)) {
+            freeEarthquakeDataBatch(data);
+            return 0;
+        }
+        bytes += slotBytes(&data[slot]);
+    }
+    freeEarthquakeDataBatch(set->data);
+    set->data = data;
+    set->stringBytes = bytes;
+    return 1;
+}
+
+int initEarthquakeSet(EarthquakeSet *set) {
+    if (!set) return 0;
+    memset(set, 0, sizeof(*set));
+    set->data = createEarthquakeDataBatch(0);
+    if (!set->data || !growSlots(set) || !rebuildTable(set, 128)) {
+        freeEarthquakeSet(set);
+        return 0;
+    }
+    return 1;
+}
+
+int earthquakeSetFind(const EarthquakeSet *set, const char *id) {
+    if (!set || !id) return -1;
+    return set->table[probe(set, id, hashId(id))];
+}
+
+int earthquakeSetLive(const EarthquakeSet *set, int slot) {
+    return set && slot >= 0 && slot < set->slots && set->state[slot] == SLOT_LIVE;
+}
+
+/* Upserts one earthquake of the feed. */
+static int upsert(EarthquakeSet *set, const EarthquakeData *record, EarthquakeChanges *changes) {
+    const char *id = record->id ? record->id : "";
+    EarthquakeData copy = *record;
+    copy.id = (char *)id;
+    if (!copy.locationName) copy.locationName = "";
+
+    uint32_t hash = hashId(id);
+    int at = probe(set, id, hash);
+    int slot = set->table[at];
+    if (slot >= 0) {
+        int firstSighting = set->seen[slot] != set->generation;
+        set->seen[slot] = set->generation;
+        if (sameEarthquake(&set->data[slot], &copy)) return 1;
+        size_t oldBytes = slotBytes(&set->data[slot]);
+        if (strcmp(set->data[slot].locationName, copy.locationName) == 0) {
+            /* only numbers changed: no strings to copy */
+            EarthquakeData *target = &set->data[slot];
+            target->magnitude = copy.magnitude;
+            target->significance = copy.significance;
+            target->timestamp = copy.timestamp;
+            target->latitude = copy.latitude;
+            target->longitude = copy.longitude;
+            target->depth = copy.depth;
+        } else {
+            if (!writeSlot(set, slot, &copy)) return 0;
+            /* the table keys on the slot, so the moved id needs no rehash */
+            set->liveBytes += slotBytes(&set->data[slot]);
+            set->liveBytes -= oldBytes;
+        }
+        /* a repeated id in one feed (rare) is still one change */
+        for (int c = changes->count - 1; !firstSighting && c >= 0; c--) {
+            if (changes->items[c].slot == slot) return 1;
+        }
+        return addChange(changes, EARTHQUAKE_UPDATED, slot);
+    }
+
+    if (2 * (set->live + 1) > set->tableSize) {
+        if (!rebuildTable(set, set->tableSize * 2)) return 0;
+        at = probe(set, id, hash);
+    }
+    if (set->numFree > 0) {
+        slot = set->freeSlots[--set->numFree];
+    } else {
+        if (set->slots == set->capacity && !growSlots(set)) return 0;
+        slot = set->slots++;
+    }
+    if (!writeSlot(set, slot, &copy)) {
+        set->freeSlots[set->numFree++] = slot;
+        return 0;
+    }
+    set->state[slot] = SLOT_LIVE;
+    set->seen[slot] = set->generation;
+    set->table[at] = slot;
+    set->live++;
+    set->liveBytes += slotBytes(&set->data[slot]);
+    return addChange(changes, EARTHQUAKE_ADDED, slot);
+}
+
+int applyEarthquakeFeed(EarthquakeSet *set, const EarthquakeData *feed, int n,
+                        EarthquakeChanges *changes) {
+    if (!set || !changes || n < 0 || (!feed && n > 0)) return 0;
+    changes->count = changes->added = changes->updated = changes->removed = 0;
+    set->generation++;
+
+    /* slots removed by the previous apply can be reused now */
+    for (int slot = 0; slot < set->slots; slot++) {
+        if (set->state[slot] == SLOT_REMOVED) {
+            set->state[slot] = SLOT_FREE;
+            set->freeSlots[set->numFree++] = slot;
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        if (!upsert(set, &feed[i], changes)) return 0;
+    }
+
+    for (int slot = 0; slot < set->slots; slot++) {
+        if (set->state[slot] != SLOT_LIVE || set->seen[slot] == set->generation) continue;
+        unlinkSlot(set, slot);
+        set->state[slot] = SLOT_REMOVED;
+        set->live--;
+        set->liveBytes -= slotBytes(&set->data[slot]);
+        if (!addChange(changes, EARTHQUAKE_REMOVED, slot)) return 0;
+    }
+
+    if (set->stringBytes > 2 * set->liveBytes + COMPACT_SLACK && !compactStrings(set)) return 0;
+    return 1;
+}
+
+int syncEarthquakeData(EarthquakeSet *set, const char *url, EarthquakeChanges *changes) {
+    int n = 0;
+    EarthquakeData *feed = loadEarthquakeData(url, &n);
+    if (!feed) return 0;
+    int ok = applyEarthquakeFeed(set, feed, n, changes);
+    freeEarthquakeDataBatch(feed);
+    return ok;
+}
+
+void freeEarthquakeChanges(EarthquakeChanges *changes) {
+    if (!changes) return;
+    free(changes->items);
+    memset(changes, 0, sizeof(*changes));
+}
+
+void freeEarthquakeSet(EarthquakeSet *set) {
+    if (!set) return;
+    freeEarthquakeDataBatch(set->data);
+    free(set->state);
+    free(set->seen);
+    free(set->freeSlots);
+    free(set->table);
+    memset(set, 0, sizeof(*set));
+}
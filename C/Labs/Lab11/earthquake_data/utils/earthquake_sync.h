@@ -0,0 +1,107 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Incremental earthquake feed sync
+ *
+ * Description:
+ * An EarthquakeSet keeps the current earthquakes of a feed in stable
+ * slots with an id -> slot hash.  Applying a freshly parsed feed turns
+ * it into upserts and deletions: new ids are added, changed earthquakes
+ * are updated in place, ids missing from the feed are removed, and the
+ * slots that changed are reported so that reports only redo those.
+ *
+ * NOTE: a slot keeps its earthquake for as long as the id stays in the
+ * feed.  A removed slot still holds the removed earthquake until the
+ * next apply (so it can be reported) and may be reused after that.
+ * Strings live in the set's arena, which is compacted when removed and
+ * replaced strings outweigh the live ones.
+ */
+
+#ifndef EARTHQUAKE_SYNC_H
+#define EARTHQUAKE_SYNC_H
+
+#include <stddef.h>
+
+#include "../earthquake.h"
+
+typedef enum {
+    EARTHQUAKE_ADDED,
+    EARTHQUAKE_UPDATED,
+    EARTHQUAKE_REMOVED
+} EarthquakeChangeKind;
+
+typedef struct {
+    EarthquakeChangeKind kind;
+    int slot;
+} EarthquakeChange;
+
+/* The changes made by one apply, in feed order (removals last). */
+typedef struct {
+    EarthquakeChange *items;
+    int count;
+    int added;
+    int updated;
+    int removed;
+    int capacity;
+} EarthquakeChanges;
+
+typedef struct {
+    EarthquakeData *data;  /* slots (a batch); see earthquakeSetLive */
+    int slots;             /* slots in use or freed, data[0 .. slots) */
+    int capacity;
+    int live;              /* earthquakes in the set */
+    unsigned char *state;  /* per slot: free, live or just removed */
+    int *seen;             /* per slot: the last apply that saw its id */
+    int generation;        /* applies so far */
+    int *freeSlots;        /* stack of reusable slots */
+    int numFree;
+    int *table;            /* open-addressing id -> slot hash, -1 = empty */
+    int tableSize;         /* a power of two */
+    size_t stringBytes;    /* bytes copied into the arena */
+    size_t liveBytes;      /* bytes of strings in live slots */
+} EarthquakeSet;
+
+/**
+ * Initializes an empty set.  Returns 0 on allocation failure.
+ */
+int initEarthquakeSet(EarthquakeSet *set);
+
+/**
+ * Applies the n earthquakes of a new snapshot of the feed: upserts each
+ * of them and removes every earthquake whose id it does not contain.
+ * The changes are written to *changes (reset first; release it with
+ * freeEarthquakeChanges).  Returns 1 on success or 0 on allocation
+ * failure, in which case the set may be partly updated.
+ */
+int applyEarthquakeFeed(EarthquakeSet *set, const EarthquakeData *feed, int n,
+                        EarthquakeChanges *changes);
+
+/**
+ * Delta-sync mode for polling: downloads the feed at url (see
+ * loadEarthquakeData) and applies it to the set.  Returns 0, leaving
+ * the set untouched, if the download or parse fails.
+ */
+int syncEarthquakeData(EarthquakeSet *set, const char *url, EarthquakeChanges *changes);
+
+/**
+ * Returns the slot of the earthquake with the given id, or -1.
+ */
+int earthquakeSetFind(const EarthquakeSet *set, const char *id);
+
+/**
+ * Returns 1 if slot holds an earthquake of the set.
+ */
+int earthquakeSetLive(const EarthquakeSet *set, int slot);
+
+/**
+ * Frees the change list.
+ */
+void freeEarthquakeChanges(EarthquakeChanges *changes);
+
+/**
+ * Frees the set and everything it owns.
+ */
+void freeEarthquakeSet(EarthquakeSet *set);
+
+#endif /* EARTHQUAKE_SYNC_H */
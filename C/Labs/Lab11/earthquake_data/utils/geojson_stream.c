@@ -0,0 +1,646 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Streaming GeoJSON parser
+ *
+ * Description:
+ * Implements the incremental USGS GeoJSON parser declared in
+ * geojson_stream.h as a byte-driven state machine.  Each container
+ * gets a stack frame tagged with where it sits in the FeatureCollection
+ * schema; object keys select what the next value means, and values
+ * with no meaning are scanned without being copied.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "geojson_stream.h"
+
+/* Deepest container nesting accepted. */
+#define MAX_DEPTH 128
+
+/* Longest number token accepted (USGS numbers are ~20 characters). */
+#define MAX_NUMBER 64
+
+/* Keys longer than this can never match a schema key. */
+#define MAX_KEY 24
+
+/* Where a container sits in the FeatureCollection schema. */
+enum {
+    CTX_OTHER,      /* anything we do not read */
+    CTX_ROOT,       /* the FeatureCollection object */
+    CTX_METADATA,   /* root.metadata */
+    CTX_FEATURES,   /* root.features */
+    CTX_FEATURE,    /* root.features[i] */
+    CTX_PROPERTIES, /* root.features[i].properties */
+    CTX_GEOMETRY,   /* root.features[i].geometry */
+    CTX_COORDS      /* root.features[i].geometry.coordinates */
+};
+
+/* Which EarthquakeData slot a scalar value fills. */
+enum {
+    FIELD_NONE,
+    FIELD_COUNT,
+    FIELD_ID,
+    FIELD_PLACE,
+    FIELD_MAG,
+    FIELD_SIG,
+    FIELD_TIME,
+    FIELD_LONGITUDE, /* coordinates[0] */
+    FIELD_LATITUDE,  /* coordinates[1] */
+    FIELD_DEPTH      /* coordinates[2] */
+};
+
+enum {
+    ST_VALUE,          /* a value must follow */
+    ST_VALUE_OR_CLOSE, /* right after '[' */
+    ST_KEY_OR_CLOSE,   /* right after '{' */
+    ST_KEY,            /* after ',' in an object */
+    ST_COLON,
+    ST_AFTER_VALUE,    /* ',' or a closing bracket must follow */
+    ST_STRING,
+    ST_ESCAPE,
+    ST_UNICODE,
+    ST_NUMBER,
+    ST_LITERAL,
+    ST_DONE,
+    ST_STOPPED,        /* the record callback asked to stop */
+    ST_ERROR
+};
+
+typedef struct {
+    char isObject;
+    unsigned char context;
+    int index; /* element number within an array */
+} Frame;
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} TextBuffer;
+
+struct GeoJsonParser {
+    int state;
+    Frame stack[MAX_DEPTH];
+    int depth;
+    size_t offset;              /* bytes consumed, for error messages */
+    int sawFeatures;            /* whether root.features was an array */
+
+    /* meaning of the value about to be read */
+    unsigned char valueContext; /* if it is a container */
+    unsigned char valueField;   /* if it is a scalar */
+
+    /* string being read: a key, a captured value or skipped */
+    int stringIsKey;
+    TextBuffer *capture;
+    char key[MAX_KEY];
+    size_t keyLen;
+    unsigned int unicode;
+    int unicodeDigits;
+    unsigned int highSurrogate;
+
+    char number[MAX_NUMBER];
+    int numberLen;
+    char literal[8];
+    int literalLen;
+
+    /* the feature being read */
+    TextBuffer id;
+    TextBuffer place;
+    double magnitude;
+    int significance;
+    long timestamp;
+    double latitude;
+    double longitude;
+    double depthKm;
+
+    EarthquakeData *results;
+    int count;
+    int capacity;
+
+    GeoJsonRecordFn onRecord;
+    void *userData;
+
+    char error[96];
+};
+
+static void fail(GeoJsonParser *p, const char *message) {
+    if (p->state != ST_ERROR) {
+        snprintf(p->error, sizeof(p->error), "%s at byte %zu", message, p->offset);
+        p->state = ST_ERROR;
+    }
+}
+
+/* True once no more input will be read. */
+static int halted(const GeoJsonParser *p) {
+    return p->state == ST_ERROR || p->state == ST_STOPPED;
+}
+
+static int textAppend(GeoJsonParser *p, TextBuffer *t, const char *s, size_t n) {
+    if (t->len + n + 1 > t->cap) {
+        size_t cap = t->cap ? t->cap : 64;
+        while (cap < t->len + n + 1) cap *= 2;
+        char *grown = realloc(t->data, cap);
+        if (!grown) {
+            fail(p, "out of memory");
+            return 0;
+        }
+        t->data = grown;
+        t->cap = cap;
+    }
+    memcpy(t->data + t->len, s, n);
+    t->len += n;
+    return 1;
+}
+
+/* Appends decoded string bytes to the key or the capture buffer. */
+static void emitText(GeoJsonParser *p, const char *s, size_t n) {
+    if (p->stringIsKey) {
+        if (p->keyLen + n < MAX_KEY) memcpy(p->key + p->keyLen, s, n);
+        p->keyLen += n;
+    } else if (p->capture) {
+        textAppend(p, p->capture, s, n);
+    }
+}
+
+static void emitCodePoint(GeoJsonParser *p, unsigned int cp) {
+    char utf8[4];
+    size_t n;
+    if (cp < 0x80) {
+        utf8[0] = (char)cp;
+        n = 1;
+    } else if (cp < 0x800) {
+        utf8[0] = (char)(0xC0 | (cp >> 6));
+        utf8[1] = (char)(0x80 | (cp & 0x3F));
+        n = 2;
+    } else if (cp < 0x10000) {
+        utf8[0] = (char)(0xE0 | (cp >> 12));
+        utf8[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        utf8[2] = (char)(0x80 | (cp & 0x3F));
+        n = 3;
+    } else {
+        utf8[0] = (char)(0xF0 | (cp >> 18));
+        utf8[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        utf8[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        utf8[3] = (char)(0x80 | (cp & 0x3F));
+        n = 4;
+    }
+    emitText(p, utf8, n);
+}
+
+/* Flushes a high surrogate that was not followed by a low one. */
+static void flushSurrogate(GeoJsonParser *p) {
+    if (p->highSurrogate) {
+        emitCodePoint(p, 0xFFFD);
+        p->highSurrogate = 0;
+    }
+}
+
+/* Sets what the next value means from the key just read. */
+static void selectByKey(GeoJsonParser *p) {
+    const char *key = p->key;
+    int context = p->stack[p->depth - 1].context;
+    p->valueContext = CTX_OTHER;
+    p->valueField = FIELD_NONE;
+    if (p->keyLen >= MAX_KEY) return;
+    p->key[p->keyLen] = '\0';
+
+    switch (context) {
+        case CTX_ROOT:
+            if (strcmp(key, "features") == 0) p->valueContext = CTX_FEATURES;
+            else if (strcmp(key, "metadata") == 0) p->valueContext = CTX_METADATA;
+            break;
+        case CTX_METADATA:
+            if (strcmp(key, "count") == 0) p->valueField = FIELD_COUNT;
+            break;
+        case CTX_FEATURE:
+            if (strcmp(key, "id") == 0) p->valueField = FIELD_ID;
+            else if (strcmp(key, "properties") == 0) p->valueContext = CTX_PROPERTIES;
+            else if (strcmp(key, "geometry") == 0) p->valueContext = CTX_GEOMETRY;
+            break;
+        case CTX_PROPERTIES:
+            if (strcmp(key, "place") == 0) p->valueField = FIELD_PLACE;
+            else if (strcmp(key, "mag") == 0) p->valueField = FIELD_MAG;
+            else if (strcmp(key, "sig") == 0) p->valueField = FIELD_SIG;
+            else if (strcmp(key, "time") == 0) p->valueField = FIELD_TIME;
+            break;
+        case CTX_GEOMETRY:
+            if (strcmp(key, "coordinates") == 0) p->valueContext = CTX_COORDS;
+            break;
+    }
+}
+
+/* Sets what the next array element means. */
+static void selectByIndex(GeoJsonParser *p) {
+    const Frame *frame = &p->stack[p->depth - 1];
+    p->valueContext = CTX_OTHER;
+    p->valueField = FIELD_NONE;
+    if (frame->context == CTX_FEATURES) {
+        p->valueContext = CTX_FEATURE;
+    } else if (frame->context == CTX_COORDS && frame->index < 3) {
+        p->valueField = FIELD_LONGITUDE + frame->index;
+    }
+}
+
+static void startFeature(GeoJsonParser *p) {
+    p->id.len = 0;
+    p->place.len = 0;
+    p->magnitude = 0.0;
+    p->significance = 0;
+    p->timestamp = 0;
+    p->latitude = 0.0;
+    p->longitude = 0.0;
+    p->depthKm = 0.0;
+}
+
+static void finishFeature(GeoJsonParser *p) {
+    if (p->count == p->capacity) {
+        int capacity = p->capacity ? p->capacity * 2 : 16;
+        if (capacity <= p->count) capacity = p->count + 1;
+        EarthquakeData *grown = growEarthquakeDataBatch(p->results, capacity);
+        if (!grown) {
+            fail(p, "out of memory");
+            return;
+        }
+        p->results = grown;
+        p->capacity = capacity;
+    }
+    /* terminate the captured strings in place */
+    if (!textAppend(p, &p->id, "", 1) || !textAppend(p, &p->place, "", 1)) return;
+    EarthquakeData *record = &p->results[p->count];
+    if (!initEarthquakeDataInBatch(p->results, p->count, p->id.data, p->place.data,
+                                   p->magnitude, p->significance, p->timestamp,
+                                   p->latitude, p->longitude, p->depthKm)) {
+        fail(p, "out of memory");
+        return;
+    }
+    p->count++;
+    if (p->onRecord && !p->onRecord(record, p->count - 1, p->userData)) {
+        p->state = ST_STOPPED;
+    }
+}
+
+/* The first time the feature count is known, size the array for it. */
+static void reserveResults(GeoJsonParser *p, long count) {
+    if (count <= p->capacity || count > INT_MAX / 2) return;
+    EarthquakeData *grown = growEarthquakeDataBatch(p->results, (int)count);
+    if (grown) {
+        p->results = grown;
+        p->capacity = (int)count;
+    }
+}
+
+static long clampToLong(double value) {
+    if (value >= (double)LONG_MAX) return LONG_MAX;
+    if (value <= (double)LONG_MIN) return LONG_MIN;
+    return (long)value;
+}
+
+/* Converts the number token like json-c would for the field's getter. */
+static void finishNumber(GeoJsonParser *p) {
+    char *end;
+    p->number[p->numberLen] = '\0';
+    int isInteger = strpbrk(p->number, ".eE") == NULL;
+    double value;
+    long integer;
+    if (isInteger) {
+        integer = strtol(p->number, &end, 10);
+        value = (double)integer;
+    } else {
+        value = strtod(p->number, &end);
+        integer = clampToLong(value);
+    }
+    if (end != p->number + p->numberLen || p->numberLen == 0) {
+        fail(p, "malformed number");
+        return;
+    }
+    switch (p->valueField) {
+        case FIELD_COUNT: reserveResults(p, integer); break;
+        case FIELD_MAG: p->magnitude = value; break;
+        case FIELD_SIG:
+            p->significance = integer > INT_MAX ? INT_MAX : integer < INT_MIN ? INT_MIN : (int)integer;
+            break;
+        case FIELD_TIME: p->timestamp = integer; break;
+        case FIELD_LONGITUDE: p->longitude = value; break;
+        case FIELD_LATITUDE: p->latitude = value; break;
+        case FIELD_DEPTH: p->depthKm = value; break;
+    }
+}
+
+/* A scalar or container value just ended. */
+static void valueDone(GeoJsonParser *p) {
+    p->state = p->depth == 0 ? ST_DONE : ST_AFTER_VALUE;
+}
+
+static void openContainer(GeoJsonParser *p, int isObject) {
+    if (p->depth == 0 && !isObject) {
+        fail(p, "document is not an object");
+        return;
+    }
+    if (p->depth == MAX_DEPTH) {
+        fail(p, "nesting too deep");
+        return;
+    }
+    Frame *frame = &p->stack[p->depth++];
+    frame->isObject = (char)isObject;
+    frame->context = p->depth == 1 ? CTX_ROOT : p->valueContext;
+    frame->index = 0;
+    if (isObject && frame->context == CTX_FEATURE) startFeature(p);
+    /* an object in an array slot or an array under the wrong key is ignored */
+    if (isObject != (frame->context != CTX_FEATURES && frame->context != CTX_COORDS)) {
+        frame->context = CTX_OTHER;
+    }
+    if (frame->context == CTX_FEATURES) p->sawFeatures = 1;
+    p->state = isObject ? ST_KEY_OR_CLOSE : ST_VALUE_OR_CLOSE;
+}
+
+static void closeContainer(GeoJsonParser *p, int isObject) {
+    Frame *frame = &p->stack[p->depth - 1];
+    if (frame->isObject != isObject) {
+        fail(p, "mismatched bracket");
+        return;
+    }
+    p->depth--;
+    if (frame->context == CTX_FEATURE) finishFeature(p);
+    if (!halted(p)) valueDone(p);
+}
+
+/* Starts the value whose first character is c. */
+static void startValue(GeoJsonParser *p, char c) {
+    if (p->depth == 0 && c != '{') {
+        fail(p, "document is not an object");
+        return;
+    }
+    switch (c) {
+        case '{':
+            openContainer(p, 1);
+            break;
+        case '[':
+            openContainer(p, 0);
+            break;
+        case '"':
+            p->stringIsKey = 0;
+            p->capture = p->valueField == FIELD_ID ? &p->id
+                       : p->valueField == FIELD_PLACE ? &p->place : NULL;
+            if (p->capture) p->capture->len = 0;
+            p->state = ST_STRING;
+            break;
+        case 't':
+        case 'f':
+        case 'n':
+            p->literal[0] = c;
+            p->literalLen = 1;
+            p->state = ST_LITERAL;
+            break;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                p->number[0] = c;
+                p->numberLen = 1;
+                p->state = ST_NUMBER;
+            } else {
+                fail(p, "unexpected character");
+            }
+    }
+}
+
+static int isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void geoJsonParserSetCallback(GeoJsonParser *p, GeoJsonRecordFn onRecord, void *userData) {
+    if (!p) return;
+    p->onRecord = onRecord;
+    p->userData = userData;
+}
+
+GeoJsonParser *createGeoJsonParser(void) {
+    GeoJsonParser *p = calloc(1, sizeof(GeoJsonParser));
+    if (p) p->state = ST_VALUE;
+    return p;
+}
+
+int geoJsonParserFeed(GeoJsonParser *p, const char *chunk, size_t len) {
+    if (!p || (!chunk && len > 0)) return 0;
+    size_t i = 0;
+    while (i < len && !halted(p)) {
+        char c = chunk[i];
+        switch (p->state) {
+            case ST_STRING: {
+                /* copy (or skip) the run of plain characters in one go */
+                size_t start = i;
+                while (i < len && chunk[i] != '"' && chunk[i] != '\\') i++;
+                p->offset += i - start;
+                if (i > start) {
+                    flushSurrogate(p);
+                    emitText(p, chunk + start, i - start);
+                }
+                if (i == len) continue;
+                if (chunk[i] == '\\') {
+                    p->state = ST_ESCAPE;
+                } else {
+                    flushSurrogate(p);
+                    if (p->stringIsKey) {
+                        selectByKey(p);
+                        p->state = ST_COLON;
+                    } else {
+                        valueDone(p);
+                    }
+                }
+                i++;
+                p->offset++;
+                continue;
+            }
+            case ST_ESCAPE: {
+                const char *decoded = NULL;
+                switch (c) {
+                    case '"': decoded = "\""; break;
+                    case '\\': decoded = "\\"; break;
+                    case '/': decoded = "/"; break;
+                    case 'b': decoded = "\b"; break;
+                    case 'f': decoded = "\f"; break;
+                    case 'n': decoded = "\n"; break;
+                    case 'r': decoded = "\r"; break;
+                    case 't': decoded = "\t"; break;
+                    case 'u':
+                        p->unicode = 0;
+                        p->unicodeDigits = 0;
+                        p->state = ST_UNICODE;
+                        break;
+                    default:
+                        fail(p, "bad escape");
+                }
+                if (decoded) {
+                    flushSurrogate(p);
+                    emitText(p, decoded, 1);
+                    p->state = ST_STRING;
+                }
+                break;
+            }
+            case ST_UNICODE: {
+                int h = hexValue(c);
+                if (h < 0) {
+                    fail(p, "bad \\u escape");
+                    break;
+                }
+                p->unicode = p->unicode * 16 + (unsigned int)h;
+                if (++p->unicodeDigits == 4) {
+                    unsigned int cp = p->unicode;
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        flushSurrogate(p);
+                        p->highSurrogate = cp;
+                    } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                        if (p->highSurrogate) {
+                            emitCodePoint(p, 0x10000 + ((p->highSurrogate - 0xD800) << 10) + (cp - 0xDC00));
+                            p->highSurrogate = 0;
+                        } else {
+                            emitCodePoint(p, 0xFFFD);
+                        }
+                    } else {
+                        flushSurrogate(p);
+                        emitCodePoint(p, cp);
+                    }
+                    p->state = ST_STRING;
+                }
+                break;
+            }
+            case ST_NUMBER:
+                if ((c >= '0' && c <= '9') || c == '.' || c == 'e' || c == 'E' ||
+                    c == '-' || c == '+') {
+                    if (p->numberLen + 1 >= MAX_NUMBER) {
+                        fail(p, "number too long");
+                        break;
+                    }
+                    p->number[p->numberLen++] = c;
+                    break;
+                }
+                finishNumber(p);
+                if (p->state != ST_ERROR) valueDone(p);
+                continue; /* c still has to be read as punctuation */
+            case ST_LITERAL:
+                if (c >= 'a' && c <= 'z') {
+                    if (p->literalLen + 1 >= (int)sizeof(p->literal)) {
+                        fail(p, "unknown literal");
+                        break;
+                    }
+                    p->literal[p->literalLen++] = c;
+                    break;
+                }
+                p->literal[p->literalLen] = '\0';
+                /* true/false/null leave the field at its default */
+                if (strcmp(p->literal, "true") != 0 && strcmp(p->literal, "false") != 0 &&
+                    strcmp(p->literal, "null") != 0) {
+                    fail(p, "unknown literal");
+                    break;
+                }
+                valueDone(p);
+                continue;
+            default:
+                if (isSpace(c)) break;
+                switch (p->state) {
+                    case ST_VALUE:
+                        startValue(p, c);
+                        break;
+                    case ST_VALUE_OR_CLOSE:
+                        if (c == ']') {
+                            closeContainer(p, 0);
+                        } else {
+                            selectByIndex(p);
+                            startValue(p, c);
+                        }
+                        break;
+                    case ST_KEY_OR_CLOSE:
+                    case ST_KEY:
+                        if (c == '"') {
+                            p->stringIsKey = 1;
+                            p->keyLen = 0;
+                            p->state = ST_STRING;
+                        } else if (c == '}' && p->state == ST_KEY_OR_CLOSE) {
+                            closeContainer(p, 1);
+                        } else {
+                            fail(p, "expected a key");
+                        }
+                        break;
+                    case ST_COLON:
+                        if (c == ':') p->state = ST_VALUE;
+                        else fail(p, "expected ':'");
+                        break;
+                    case ST_AFTER_VALUE:
+                        if (c == ',') {
+                            Frame *frame = &p->stack[p->depth - 1];
+                            if (frame->isObject) {
+                                p->state = ST_KEY;
+                            } else {
+                                frame->index++;
+                                selectByIndex(p);
+                                p->state = ST_VALUE;
+                            }
+                        } else if (c == '}' || c == ']') {
+                            closeContainer(p, c == '}');
+                        } else {
+                            fail(p, "expected ',' or a closing bracket");
+                        }
+                        break;
+                    case ST_DONE:
+                        fail(p, "trailing characters");
+                        break;
+                }
+        }
+        i++;
+        p->offset++;
+    }
+    return !halted(p);
+}
+
+EarthquakeData *geoJsonParserFinish(GeoJsonParser *p, int *n) {
+    if (n) *n = 0;
+    if (!p || !n) return NULL;
+    if (p->state != ST_DONE && p->state != ST_STOPPED) {
+        fail(p, "unexpected end of document");
+        return NULL;
+    }
+    /* an error reply is well-formed JSON too, but is not an empty feed */
+    if (!p->sawFeatures) {
+        fail(p, "no features array");
+        return NULL;
+    }
+    EarthquakeData *results = p->results;
+    *n = p->count;
+    p->results = NULL;
+    p->count = 0;
+    p->capacity = 0;
+    /* an empty feature list still returns a (freeable) batch */
+    return results ? results : createEarthquakeDataBatch(0);
+}
+
+const char *geoJsonParserError(const GeoJsonParser *p) {
+    return p && p->state == ST_ERROR ? p->error : NULL;
+}
+
+void freeGeoJsonParser(GeoJsonParser *p) {
+    if (!p) return;
+    freeEarthquakeDataBatch(p->results);
+    free(p->id.data);
+    free(p->place.data);
+    free(p);
+}
+
+EarthquakeData *parseEarthquakeDataStream(const char *json, size_t len, int *n) {
+    if (n) *n = 0;
+    GeoJsonParser *p = createGeoJsonParser();
+    if (!p) return NULL;
+    EarthquakeData *results = NULL;
+    if (geoJsonParserFeed(p, json, len)) results = geoJsonParserFinish(p, n);
+    freeGeoJsonParser(p);
+    return results;
+}
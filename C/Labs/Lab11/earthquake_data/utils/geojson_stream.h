@@ -0,0 +1,89 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Streaming GeoJSON parser
+ *
+ * Description:
+ * A push-style (SAX-like) parser specialized for the USGS GeoJSON
+ * Summary format.  Text is fed in chunks of any size, so it can be
+ * driven straight from a network callback; the parser keeps only a
+ * small container stack and the fields of the feature being read, and
+ * writes id, place, mag, sig, time and the three coordinates straight
+ * into an EarthquakeData array without building a document tree.
+ *
+ * NOTE: Every other member of the document is validated and skipped
+ * without being copied.  Missing or null fields read as 0 (numbers) or
+ * "" (strings), as with the json-c based parser.  The number of
+ * results is the number of features actually present; metadata.count
+ * is only used to size the array up front.
+ */
+
+#ifndef GEOJSON_STREAM_H
+#define GEOJSON_STREAM_H
+
+#include <stddef.h>
+
+#include "../earthquake.h"
+
+typedef struct GeoJsonParser GeoJsonParser;
+
+/**
+ * Called once per feature, in document order, as soon as the feature's
+ * closing brace has been read.  <code>record</code> is only valid
+ * during the call (copy it to keep it).  Return non-zero to keep
+ * parsing or 0 to stop: the parser then reads no more input and
+ * geoJsonParserFinish returns the records read so far.
+ */
+typedef int (*GeoJsonRecordFn)(const EarthquakeData *record, int index, void *userData);
+
+/**
+ * Creates a parser ready for the first chunk of a document.  Returns
+ * NULL on allocation failure.
+ */
+GeoJsonParser *createGeoJsonParser(void);
+
+/**
+ * Registers a callback that receives each record as it is parsed (NULL
+ * to remove it).  Set it before the first chunk is fed.
+ */
+void geoJsonParserSetCallback(GeoJsonParser *parser, GeoJsonRecordFn onRecord, void *userData);
+
+/**
+ * Parses the next len bytes of the document.  Chunks may split the
+ * text anywhere, including inside strings, numbers and escapes.
+ * Returns 1 on success or 0 once the text is malformed (or memory runs
+ * out) or the record callback asked to stop; further calls then keep
+ * returning 0.  geoJsonParserError tells the two cases apart.
+ */
+int geoJsonParserFeed(GeoJsonParser *parser, const char *chunk, size_t len);
+
+/**
+ * Finishes the document and hands over the parsed earthquakes: returns
+ * a batch of *n EarthquakeData (release it with freeEarthquakeDataBatch),
+ * or NULL with *n set to 0 when the document was malformed, incomplete
+ * or had no root.features array (as an error reply has not).  A
+ * document stopped by the record callback returns the records read
+ * before the stop.  The parser must still be freed with
+ * freeGeoJsonParser.
+ */
+EarthquakeData *geoJsonParserFinish(GeoJsonParser *parser, int *n);
+
+/**
+ * Returns a description of the first error, or NULL if there is none.
+ */
+const char *geoJsonParserError(const GeoJsonParser *parser);
+
+/**
+ * Frees the parser and any earthquakes not handed over by
+ * geoJsonParserFinish.  Safe to pass NULL.
+ */
+void freeGeoJsonParser(GeoJsonParser *parser);
+
+/**
+ * Convenience wrapper: parses the whole document json of len bytes.
+ * Returns the same as geoJsonParserFinish.
+ */
+EarthquakeData *parseEarthquakeDataStream(const char *json, size_t len, int *n);
+
+#endif /* GEOJSON_STREAM_H */
@@ -0,0 +1,360 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Parallel earthquake reports
+ *
+ * Description:
+ * Implements the chunked parallel report reductions declared in
+ * report_summary.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "report_summary.h"
+#include "geo_batch.h"
+
+#define LINCOLN_LATITUDE 40.806862
+#define LINCOLN_LONGITUDE -96.681679
+
+/* Rows per chunk; chunks are the unit of work handed to threads. */
+#define CHUNK_ROWS 65536
+
+/* Rows per call of the distance kernel (stack buffers). */
+#define BLOCK_ROWS 1024
+
+/* Extremes of one chunk: the first row holding the smallest/largest
+ * non-NaN value, or -1 if every value is NaN. */
+typedef struct {
+    int weakest;
+    int strongest;
+    int closest;
+    double closestDistance;  /* kernel distance of closest */
+    double firstDistance;    /* kernel distance of the chunk's first row */
+} ChunkResult;
+
+typedef struct {
+    const char *name;
+    int length;
+    int count;
+    uint32_t hash;
+} RegionSlot;
+
+/* Open-addressing table of region counts (capacity a power of two). */
+typedef struct {
+    RegionSlot *slots;
+    int capacity;
+    int size;
+} RegionTable;
+
+typedef struct {
+    const EarthquakeData *data;
+    int n;
+    int withCounts;          /* also fill the histogram and region counts */
+    int numChunks;
+    ChunkResult *chunks;
+    int nextChunk;
+    pthread_mutex_t lock;
+} ReportJob;
+
+typedef struct {
+    ReportJob *job;
+    int histogram[REPORT_MAGNITUDE_BINS];
+    RegionTable regions;
+    int failed;
+} ReportWorker;
+
+static int magnitudeBin(double magnitude) {
+    /* the negated test also sends NaN to the first bin */
+    if (!(magnitude >= 0.0)) return 0;
+    if (magnitude >= REPORT_MAGNITUDE_BINS - 2) return REPORT_MAGNITUDE_BINS - 1;
+    return (int)magnitude + 1;
+}
+
+/* Points *name at the region of a location name and returns its length. */
+static int regionOf(const char *locationName, const char **name) {
+    const char *start = locationName ? locationName : "";
+    const char *p = start;
+    for (; *p; p++) {
+        if (p[0] == ',' && p[1] == ' ') start = p + 2;
+    }
+    *name = start;
+    return (int)(p - start);
+}
+
+static uint32_t hashRegion(const char *name, int length) {
+    uint32_t hash = 2166136261u;  /* FNV-1a */
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static int growRegionTable(RegionTable *table) {
+    int capacity = table->capacity ? table->capacity * 2 : 64;
+    RegionSlot *slots = calloc(capacity, sizeof(RegionSlot));
+    if (!slots) return 0;
+    for (int i = 0; i < table->capacity; i++) {
+        RegionSlot *old = &table->slots[i];
+        if (!old->name) continue;
+        int at = old->hash & (capacity - 1);
+        while (slots[at].name) at = (at + 1) & (capacity - 1);
+        slots[at] = *old;
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
+    return 1;
+}
+
+static int addRegion(RegionTable *table, const char *name, int length, int count) {
+    if (2 * (table->size + 1) > table->capacity && !growRegionTable(table)) return 0;
+    uint32_t hash = hashRegion(name, length);
+    int at = hash & (table->capacity - 1);
+    while (table->slots[at].name) {
+        RegionSlot *slot = &table->slots[at];
+        if (slot->hash == hash && slot->length == length && memcmp(slot->name, name, length) == 0) {
+            slot->count += count;
+            return 1;
+        }
+        at = (at + 1) & (table->capacity - 1);
+    }
+    table->slots[at].name = name;
+    table->slots[at].length = length;
+    table->slots[at].count = count;
+    table->slots[at].hash = hash;
+    table->size++;
+    return 1;
+}
+
+/* Reduces rows [start, end) into *result and the worker's counts. */
+static int reduceChunk(ReportWorker *worker, int start, int end, ChunkResult *result) {
+    const EarthquakeData *data = worker->job->data;
+    int weakest = -1, strongest = -1, closest = -1;
+    double closestDistance = 0.0;
+    double lats[BLOCK_ROWS], lons[BLOCK_ROWS], dists[BLOCK_ROWS];
+
+    for (int block = start; block < end; block += BLOCK_ROWS) {
+        int count = end - block < BLOCK_ROWS ? end - block : BLOCK_ROWS;
+        for (int i = 0; i < count; i++) {
+            lats[i] = data[block + i].latitude;
+            lons[i] = data[block + i].longitude;
+        }
+        airDistanceMany(LINCOLN_LATITUDE, LINCOLN_LONGITUDE, lats, lons, dists, (size_t)count);
+        if (block == start) result->firstDistance = dists[0];
+
+        for (int i = 0; i < count; i++) {
+            int row = block + i;
+            double magnitude = data[row].magnitude;
+            if (!isnan(magnitude)) {
+                if (weakest < 0 || magnitude < data[weakest].magnitude) weakest = row;
+                if (strongest < 0 || magnitude > data[strongest].magnitude) strongest = row;
+            }
+            if (!isnan(dists[i]) && (closest < 0 || dists[i] < closestDistance)) {
+                closest = row;
+                closestDistance = dists[i];
+            }
+            if (!worker->job->withCounts) continue;
+            worker->histogram[magnitudeBin(magnitude)]++;
+            const char *name;
+            int length = regionOf(data[row].locationName, &name);
+            if (!addRegion(&worker->regions, name, length, 1)) return 0;
+        }
+    }
+    result->weakest = weakest;
+    result->strongest = strongest;
+    result->closest = closest;
+    result->closestDistance = closestDistance;
+    return 1;
+}
+
+static void *reportWorkerMain(void *arg) {
+    ReportWorker *worker = arg;
+    ReportJob *job = worker->job;
+    for (;;) {
+        pthread_mutex_lock(&job->lock);
+        int chunk = job->nextChunk++;
+        pthread_mutex_unlock(&job->lock);
+        if (chunk >= job->numChunks) break;
+        int start = chunk * CHUNK_ROWS;
+        int end = job->n - start < CHUNK_ROWS ? job->n : start + CHUNK_ROWS;
+        if (!reduceChunk(worker, start, end, &job->chunks[chunk])) {
+            worker->failed = 1;
+            break;
+        }
+    }
+    return NULL;
+}
+
+static int compareRegionCount(const void *a, const void *b) {
+    const RegionCount *x = a, *y = b;
+    if (x->count != y->count) return y->count - x->count;
+    int common = x->length < y->length ? x->length : y->length;
+    int order = memcmp(x->name, y->name, common);
+    if (order != 0) return order;
+    return x->length - y->length;
+}
+
+/*
+ * Merges the chunk results in chunk order.  runReports keeps the first
+ * row of a tie and, comparing with <, never leaves row 0 if its value
+ * is NaN; the chunks skip NaN, so row 0 is restored here in that case.
+ */
+static void mergeChunks(const ReportJob *job, ReportSummary *summary) {
+    const EarthquakeData *data = job->data;
+    int weakest = -1, strongest = -1, closest = -1;
+    double closestDistance = 0.0;
+    for (int c = 0; c < job->numChunks; c++) {
+        const ChunkResult *chunk = &job->chunks[c];
+        if (chunk->weakest >= 0 &&
+            (weakest < 0 || data[chunk->weakest].magnitude < data[weakest].magnitude)) {
+            weakest = chunk->weakest;
+        }
+        if (chunk->strongest >= 0 &&
+            (strongest < 0 || data[chunk->strongest].magnitude > data[strongest].magnitude)) {
+            strongest = chunk->strongest;
+        }
+        if (chunk->closest >= 0 && (closest < 0 || chunk->closestDistance < closestDistance)) {
+            closest = chunk->closest;
+            closestDistance = chunk->closestDistance;
+        }
+    }
+    if (job->n > 0) {
+        if (weakest < 0 || isnan(data[0].magnitude)) weakest = 0;
+        if (strongest < 0 || isnan(data[0].magnitude)) strongest = 0;
+        if (closest < 0 || isnan(job->chunks[0].firstDistance)) closest = 0;
+    }
+    summary->weakest = weakest;
+    summary->strongest = strongest;
+    summary->closest = closest;
+    summary->closestKm = closest < 0 ? 0.0
+        : airDistance(LINCOLN_LATITUDE, LINCOLN_LONGITUDE,
+                      data[closest].latitude, data[closest].longitude);
+}
+
+int summarizeEarthquakes(const EarthquakeData *data, int n, int threads, int withCounts,
+                         ReportSummary *summary) {
+    if (!summary || n < 0 || (!data && n > 0)) return 0;
+    memset(summary, 0, sizeof(*summary));
+    summary->n = n;
+
+    ReportJob job;
+    job.data = data;
+    job.n = n;
+    job.withCounts = withCounts;
+    job.numChunks = (int)(((long)n + CHUNK_ROWS - 1) / CHUNK_ROWS);
+    job.nextChunk = 0;
+    if (threads < 1) threads = 1;
+    if (threads > job.numChunks) threads = job.numChunks > 0 ? job.numChunks : 1;
+    job.chunks = malloc(sizeof(ChunkResult) * (job.numChunks > 0 ? job.numChunks : 1));
+    ReportWorker *workers = calloc(threads, sizeof(ReportWorker));
+    pthread_t *ids = malloc(sizeof(pthread_t) * threads);
+    if (!job.chunks || !workers || !ids) {
+        free(ids);
+        free(workers);
+        free(job.chunks);
+        return 0;
+    }
+    pthread_mutex_init(&job.lock, NULL);
+
+    /* the calling thread is worker 0 */
+    int started = 0;
+    for (int t = 0; t < threads; t++) workers[t].job = &job;
+    for (int t = 1; t < threads; t++) {
+        if (pthread_create(&ids[t], NULL, reportWorkerMain, &workers[t]) != 0) break;
+        started = t;
+    }
+    reportWorkerMain(&workers[0]);
+    for (int t = 1; t <= started; t++) pthread_join(ids[t], NULL);
+    pthread_mutex_destroy(&job.lock);
+
+    int ok = 1;
+    RegionTable regions = { NULL, 0, 0 };
+    for (int t = 0; t < threads; t++) {
+        ok = ok && !workers[t].failed;
+        for (int b = 0; b < REPORT_MAGNITUDE_BINS; b++) summary->histogram[b] += workers[t].histogram[b];
+        for (int i = 0; ok && i < workers[t].regions.capacity; i++) {
+            const RegionSlot *slot = &workers[t].regions.slots[i];
+            if (slot->name) ok = addRegion(&regions, slot->name, slot->length, slot->count);
+        }
+        free(workers[t].regions.slots);
+    }
+    if (ok) mergeChunks(&job, summary);
+    if (ok && withCounts) {
+        summary->regions = malloc(sizeof(RegionCount) * (regions.size > 0 ? regions.size : 1));
+        ok = summary->regions != NULL;
+    }
+    if (ok && withCounts) {
+        for (int i = 0; i < regions.capacity; i++) {
+            const RegionSlot *slot = &regions.slots[i];
+            if (!slot->name) continue;
+            RegionCount *region = &summary->regions[summary->numRegions++];
+            region->name = slot->name;
+            region->length = slot->length;
+            region->count = slot->count;
+        }
+        qsort(summary->regions, summary->numRegions, sizeof(RegionCount), compareRegionCount);
+    }
+
+    free(regions.slots);
+    free(ids);
+    free(workers);
+    free(job.chunks);
+    if (!ok) freeReportSummary(summary);
+    return ok;
+}
+
+void printReportSummary(const EarthquakeData *data, const ReportSummary *summary) {
+    if (summary->weakest >= 0) {
+        printf("Weakest Magnitude Earthquake: \n");
+        earthquakeDataPrint(&data[summary->weakest]);
+        printf("Strongest Magnitude Earthquake: \n");
+        earthquakeDataPrint(&data[summary->strongest]);
+    } else {
+        printf("Weakest Magnitude Earthquake: (no data)\n");
+        printf("Strongest Magnitude Earthquake: (no data)\n");
+    }
+    if (summary->closest >= 0) {
+        printf("Closest Earthquake to Lincoln (%.2f kms away): \n", summary->closestKm);
+        earthquakeDataPrint(&data[summary->closest]);
+    } else {
+        printf("Closest Earthquake to Lincoln: (no data)\n");
+    }
+}
+
+void printReportCounts(const ReportSummary *summary) {
+    printf("Earthquakes by Magnitude: \n");
+    for (int b = 0; b < REPORT_MAGNITUDE_BINS; b++) {
+        if (b == 0) printf("  < 0   : %d\n", summary->histogram[b]);
+        else if (b == REPORT_MAGNITUDE_BINS - 1) printf("  %d+    : %d\n", b - 1, summary->histogram[b]);
+        else printf("  %d - %d : %d\n", b - 1, b, summary->histogram[b]);
+    }
+
+    printf("Most Active Regions: \n");
+    for (int i = 0; i < summary->numRegions && i < REPORT_TOP_REGIONS; i++) {
+        const RegionCount *region = &summary->regions[i];
+        printf("  %-39.*s %d\n", region->length, region->name, region->count);
+    }
+}
+
+void runReportsParallel(const EarthquakeData *data, int n, int threads) {
+    ReportSummary summary;
+    if (!summarizeEarthquakes(data, n, threads, 0, &summary)) {
+        runReports(data, n);
+        return;
+    }
+    printReportSummary(data, &summary);
+    freeReportSummary(&summary);
+}
+
+void freeReportSummary(ReportSummary *summary) {
+    if (!summary) return;
+    free(summary->regions);
+    summary->regions = NULL;
+    summary->numRegions = 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Parallel earthquake reports
+ *
+ * Description:
+ * Computes the report reductions over an EarthquakeData array (weakest,
+ * strongest and closest earthquake, a magnitude histogram and counts per
+ * region) as a chunked reduce on a small pool of POSIX threads, then
+ * prints them.  The array is cut into fixed-size chunks that workers
+ * take in turn; per-chunk results are merged in chunk order, so the
+ * answer does not depend on the number of threads and the reports
+ * match runReports exactly.  The histogram and region counts are only
+ * computed and printed on request.
+ *
+ * NOTE: the region of an earthquake is the text after the last ", " of
+ * its location name ("CA" for "12 km SE of Tehachapi, CA"), or the whole
+ * name when it has no comma.  Region names point into the array, which
+ * must outlive the summary.
+ */
+
+#ifndef REPORT_SUMMARY_H
+#define REPORT_SUMMARY_H
+
+#include "../earthquake.h"
+
+/* Magnitude histogram bins: bin 0 counts magnitudes below 0 (and NaN),
+ * bin b counts [b - 1, b) and the last bin counts 9 and up. */
+#define REPORT_MAGNITUDE_BINS 11
+
+/* Regions printed by printReportCounts. */
+#define REPORT_TOP_REGIONS 10
+
+typedef struct {
+    const char *name;   /* not terminated at length; points into a locationName */
+    int length;
+    int count;
+} RegionCount;
+
+typedef struct {
+    int n;
+    int weakest;          /* row of the weakest earthquake, -1 if n == 0 */
+    int strongest;        /* row of the strongest earthquake, -1 if n == 0 */
+    int closest;          /* row of the closest earthquake to Lincoln, NE,
+                             -1 if n == 0 */
+    double closestKm;     /* its airDistance from Lincoln */
+    int histogram[REPORT_MAGNITUDE_BINS];  /* all 0 without counts */
+    RegionCount *regions; /* most earthquakes first, then by name;
+                             NULL without counts */
+    int numRegions;
+} ReportSummary;
+
+/**
+ * Computes the report reductions over the n earthquakes in data with up
+ * to threads threads (1 runs everything on the calling thread; if a
+ * thread cannot be started the others do its share).  The histogram and
+ * region counts are filled only if withCounts is non-zero.  Returns 1 on
+ * success or 0 on allocation failure.
+ */
+int summarizeEarthquakes(const EarthquakeData *data, int n, int threads, int withCounts,
+                         ReportSummary *summary);
+
+/**
+ * Prints the reports of runReports from a summary, exactly as
+ * runReports prints them.
+ */
+void printReportSummary(const EarthquakeData *data, const ReportSummary *summary);
+
+/**
+ * Prints the magnitude histogram and the most active regions of a
+ * summary computed with counts.
+ */
+void printReportCounts(const ReportSummary *summary);
+
+/**
+ * Summarizes data (without counts) with up to threads threads and
+ * prints the same output as runReports; falls back to runReports if
+ * the summary fails.
+ */
+void runReportsParallel(const EarthquakeData *data, int n, int threads);
+
+/**
+ * Frees the region counts of a summary.
+ */
+void freeReportSummary(ReportSummary *summary);
+
+#endif /* REPORT_SUMMARY_H */
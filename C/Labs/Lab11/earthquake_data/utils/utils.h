@@ -1,31 +1,11 @@
 
 #include "../earthquake.h"
-
-/**
- * string structure used to keep track of the size
- * of the allocated space.  Used by the curl library
- * as a buffer.
- */
-struct string {
-  char *ptr;
-  size_t len;
-};
-
-/**
- * Initializes a string structure
- */
-void initString(struct string *s);
-
-/**
- * Callback used by the curl function so that we capture the curl
- * stream to a buffer.  This function automatically expands the
- * buffer via realloc (exiting on failure).
- */
-size_t bufferedWrite(void *ptr, size_t size, size_t nmemb, struct string *s);
+#include "geojson_stream.h"
 
 /**
  * Function returns a string containing the content of the given
- * url.
+ * url.  The download buffer itself is returned (no copy is made); the
+ * caller frees it.  Returns <code>NULL</code> if cURL could not be set up.
  */
 char *getContent(const char *url);
 
@@ -34,16 +14,38 @@ char *getContent(const char *url);
  * an array of size <code>n</code>.  Data is assumed to be in the USGS
  * GeoJSON Summary format (see
  * <a href="https://earthquake.usgs.gov/earthquakes/feed/v1.0/geojson.php">here</a>
- * for details).
+ * for details).  Same as <code>streamEarthquakeData</code> without a
+ * callback.
  *
  */
 EarthquakeData *loadEarthquakeData(const char *url, int *n);
 
+/**
+ * Downloads earthquake data from the given <code>url</code> (any URL
+ * cURL supports, including <code>file://</code>) and parses it while the
+ * transfer runs: each chunk cURL receives goes straight to the streaming
+ * parser, so the document itself is never held in memory.  If
+ * <code>onRecord</code> is not <code>NULL</code> it is called with each
+ * earthquake as soon as it has been read; returning 0 from it ends the
+ * transfer early and keeps the records read so far.
+ *
+ * Returns a batch of size <code>n</code> (free it with
+ * <code>freeEarthquakeDataBatch</code>), or <code>NULL</code> (with
+ * <code>n</code> set to 0) if the transfer fails (an HTTP error status
+ * included) or the data is malformed or not a feature collection.
+ */
+EarthquakeData *streamEarthquakeData(const char *url, int *n,
+                                     GeoJsonRecordFn onRecord, void *userData);
+
 /**
  * Parses earthquake data from the given JSON string and returns
  * an array of size <code>n</code>.  Data is assumed to be in the USGS
  * GeoJSON Summary format (see
  * <a href="https://earthquake.usgs.gov/earthquakes/feed/v1.0/geojson.php">here</a>
- * for details).
+ * for details).  The text is parsed in a single streaming pass (see
+ * <code>geojson_stream.h</code>); <code>n</code> is the number of
+ * features present.  Returns a batch (free it with
+ * <code>freeEarthquakeDataBatch</code>), or <code>NULL</code> if the
+ * text is malformed.
  */
 EarthquakeData *parseEarthquakeData(const char *json_data, int *n);
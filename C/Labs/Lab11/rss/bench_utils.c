@@ -0,0 +1,78 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS benchmark helpers
+ *
+ * Description:
+ * Implements the helpers declared in bench_utils.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench_utils.h"
+#include "byte_buffer.h"
+
+double benchNow(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+char *makeSyntheticRss(int n, size_t *len) {
+  static const char *days[] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+  static const char *months[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                  "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+  ByteBuffer buffer;
+  if (!initByteBuffer(&buffer, (size_t)n * 700 + 512)) return NULL;
+  const char *head = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                     "<rss version=\"2.0\" xmlns:dc=\"http://purl.org/dc/elements/1.1/\">\n"
+                     "  <channel>\n    <title>Synthetic</title>\n"
+                     "    <link>https://example.edu/news/</link>\n"
+                     "    <description>A large feed for benchmarks</description>\n";
+  byteBufferAppend(&buffer, head, strlen(head));
+  unsigned int state = 11u;
+  for (int i = 0; i < n; i++) {
+    char item[1024];
+    state = state * 1103515245u + 12345u;
+    int words = 20 + (state >> 8) % 40;
+    char description[512];
+    int at = snprintf(description, sizeof(description), "&lt;p&gt;Item %d of the feed", i);
+    for (int w = 0; w < words && at < 400; w++) {
+      at += snprintf(description + at, sizeof(description) - at, " word%u", (state >> (w % 16)) % 997);
+    }
+    snprintf(description + at, sizeof(description) - at, " &amp; more.&lt;/p&gt;");
+    int len = snprintf(item, sizeof(item),
+                       "    <item>\n"
+                       "      <title>Announcement %d: %s update</title>\n"
+                       "      <link>https://example.edu/news/%d/announcement-%u</link>\n"
+                       "      <description>%s</description>\n"
+                       "      <dc:creator>Office %u</dc:creator>\n"
+                       "      <guid isPermaLink=\"false\">example-%d</guid>\n"
+                       "      <pubDate>%s, %02d %s 2026 %02d:%02d:00 -0600</pubDate>\n"
+                       "    </item>\n",
+                       i, (state >> 4) % 2 ? "campus" : "department", i, state % 100000,
+                       description, (state >> 12) % 40, i, days[i % 7], 1 + i % 28,
+                       months[(i / 28) % 12], (state >> 3) % 24, (state >> 5) % 60);
+    byteBufferAppend(&buffer, item, len);
+  }
+  const char *tail = "  </channel>\n</rss>\n";
+  byteBufferAppend(&buffer, tail, strlen(tail));
+  return byteBufferRelease(&buffer, len);
+}
+
+char *readFile(const char *path, size_t *len) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return NULL;
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  *len = text ? fread(text, 1, size, in) : 0;
+  if (text) text[*len] = '\0';
+  fclose(in);
+  return text;
+}
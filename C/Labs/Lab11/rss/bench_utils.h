@@ -0,0 +1,36 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS benchmark helpers
+ *
+ * Description:
+ * Shared helpers for the rss benchmarks: a monotonic timer, a
+ * generator for reproducible synthetic RSS feeds and a file reader.
+ */
+
+#ifndef RSS_BENCH_UTILS_H
+#define RSS_BENCH_UTILS_H
+
+#include <stddef.h>
+
+/**
+ * Returns a monotonic wall-clock time in seconds.
+ */
+double benchNow(void);
+
+/**
+ * Builds an RSS 2.0 document of n items shaped like a news feed
+ * (escaped HTML descriptions, a dc:creator and guid per item, dates
+ * spread over a year).  The same n always gives the same text.  Returns
+ * malloc'd text and stores its length in <code>*len</code>.
+ */
+char *makeSyntheticRss(int n, size_t *len);
+
+/**
+ * Reads the whole file at path into a malloc'd NUL-terminated string
+ * and stores its length in <code>*len</code>, or returns NULL.
+ */
+char *readFile(const char *path, size_t *len);
+
+#endif /* RSS_BENCH_UTILS_H */
@@ -0,0 +1,198 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Feed polling cache benchmark
+ *
+ * Description:
+ * Measures what the polling cache saves.  First, repeated polls of the
+ * fixture feeds in data/ from a loopback feed server that holds each
+ * response back (a stand-in for network latency): unconditional polls
+ * that download, parse and print every item, against conditional polls
+ * of the same unchanged feeds.  Then one large synthetic feed that gained
+ * a single item: parsing and printing all of it against
+ * parseUnseenItems.  Printing goes to /dev/null.  Exits non-zero if a
+ * poll or parse goes wrong.
+ *
+ * Usage: cacheBench [numFeeds [delayMs [numItems]]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "feed_cache.h"
+#include "feed_fetcher.h"
+#include "feed_server.h"
+#include "rss_stream.h"
+#include "bench_utils.h"
+
+#define POLLS 5
+
+static FILE *sink;
+
+/* Prints an item as printRss does, into the sink. */
+static int printItem(const Rss *item, void *context) {
+  int *printed = context;
+  fprintf(sink, "%s\n  %s\n  %s\n  %s\n", item->title, item->date, item->link, item->description);
+  (*printed)++;
+  return 1;
+}
+
+/*
+ * Polls the urls once, conditionally if cache is not NULL.  Adds the
+ * items printed and body bytes received, and returns the failures.
+ */
+static int pollOnce(FeedFetcher *fetcher, FeedCache *cache, const char *const *urls, int n,
+                    long *printed, long *bytes) {
+  FeedQueue queue;
+  int failures = 0;
+  if (!initFeedQueue(&queue)) return n;
+  FeedValidators *validators = NULL;
+  if (cache) {
+    validators = malloc(sizeof(FeedValidators) * n);
+    if (!validators) {
+      freeFeedQueue(&queue);
+      return n;
+    }
+    for (int i = 0; i < n; i++) {
+      FeedCacheEntry *entry = feedCacheEntry(cache, urls[i]);
+      validators[i].etag = entry ? strdup(entry->etag) : NULL;
+      validators[i].lastModified = entry ? strdup(entry->lastModified) : NULL;
+    }
+  }
+  FeedFetchJob job = { fetcher, urls, n, &queue, validators };
+  if (startFeedFetchJob(&job)) {
+    FeedResult *result;
+    while ((result = feedQueuePop(&queue)) != NULL) {
+      int items = 0;
+      *bytes += result->len;
+      if (result->error != CURLE_OK) {
+        failures++;
+      } else if (cache && result->status == 304) {
+        /* nothing to parse */
+      } else if (cache) {
+        FeedCacheEntry *entry = feedCacheFind(cache, result->url);
+        failures += !entry ||
+                    parseUnseenItems(entry, result->body, result->len, printItem, &items) < 0 ||
+                    !feedCacheSetValidators(entry, result->etag, result->lastModified);
+      } else {
+        failures += streamRssItems(result->body, result->len, printItem, &items) < 0;
+      }
+      *printed += items;
+      freeFeedResult(result);
+    }
+    failures += joinFeedFetchJob(&job) != n;
+  } else {
+    failures = n;
+  }
+  freeFeedQueue(&queue);
+  for (int i = 0; validators && i < n; i++) {
+    free((char *)validators[i].etag);
+    free((char *)validators[i].lastModified);
+  }
+  free(validators);
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 200;
+  int delayMs = argc > 2 ? atoi(argv[2]) : 20;
+  int numItems = argc > 3 ? atoi(argv[3]) : 100000;
+  sink = fopen("/dev/null", "w");
+  FeedServer server;
+  if (n < 1 || delayMs < 0 || numItems < 1 || !sink) {
+    fprintf(stderr, "Usage: %s [numFeeds [delayMs [numItems]]]\n", argv[0]);
+    return 1;
+  }
+  if (!startFeedServer(&server, "data", delayMs)) {
+    fprintf(stderr, "could not serve data/ (run from the rss directory)\n");
+    return 1;
+  }
+
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  char (*urlText)[128] = malloc(sizeof(*urlText) * n);
+  const char **urls = malloc(sizeof(char *) * n);
+  FeedFetcher fetcher;
+  if (!urlText || !urls || !initFeedFetcher(&fetcher, 16)) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+  for (int i = 0; i < n; i++) {
+    snprintf(urlText[i], sizeof(urlText[i]), "http://127.0.0.1:%d/%s?feed=%d", server.port,
+             names[i % 2], i);
+    urls[i] = urlText[i];
+  }
+
+  printf("Polling %d unchanged feeds %d times (%d ms per response, 16 in parallel)\n", n, POLLS,
+         delayMs);
+  printf("==========================================================================\n");
+  int failures = 0;
+  long printed = 0, bytes = 0;
+  double start = benchNow();
+  for (int p = 0; p < POLLS; p++) failures += pollOnce(&fetcher, NULL, urls, n, &printed, &bytes);
+  double secs = benchNow() - start;
+  printf("unconditional : %7.1f ms per poll  %8ld body bytes  %6ld items printed\n",
+         secs * 1e3 / POLLS, bytes, printed);
+
+  FeedCache cache;
+  initFeedCache(&cache);
+  long firstPrinted = 0, firstBytes = 0;
+  failures += pollOnce(&fetcher, &cache, urls, n, &firstPrinted, &firstBytes);
+  long before = feedServerNotModified(&server);
+  printed = bytes = 0;
+  start = benchNow();
+  for (int p = 0; p < POLLS; p++) failures += pollOnce(&fetcher, &cache, urls, n, &printed, &bytes);
+  secs = benchNow() - start;
+  printf("conditional   : %7.1f ms per poll  %8ld body bytes  %6ld items printed  (%ld 304s)\n",
+         secs * 1e3 / POLLS, bytes, printed, feedServerNotModified(&server) - before);
+  failures += printed != 0 || feedServerNotModified(&server) - before != (long)n * POLLS;
+  freeFeedCache(&cache);
+
+  /* one big feed that gained an item at the end */
+  size_t oldLen = 0, newLen = 0;
+  char *oldXml = makeSyntheticRss(numItems, &oldLen);
+  char *newXml = makeSyntheticRss(numItems + 1, &newLen);
+  if (!oldXml || !newXml) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+  printf("\nRe-reading a %d-item feed (%.1f MB) that gained one item\n", numItems, newLen / 1e6);
+  printf("==========================================================================\n");
+  double best[2] = { 1e30, 1e30 };
+  int counts[2] = { 0, 0 };
+  for (int r = 0; r < 3; r++) {
+    int items = 0;
+    start = benchNow();
+    failures += streamRssItems(newXml, newLen, printItem, &items) != numItems + 1;
+    secs = benchNow() - start;
+    if (secs < best[0]) best[0] = secs;
+    counts[0] = items;
+
+    initFeedCache(&cache);
+    FeedCacheEntry *entry = feedCacheEntry(&cache, "http://example.edu/news/feed");
+    int seenItems = 0;
+    failures += !entry ||
+                parseUnseenItems(entry, oldXml, oldLen, printItem, &seenItems) != numItems;
+    items = 0;
+    start = benchNow();
+    failures += !entry || parseUnseenItems(entry, newXml, newLen, printItem, &items) != 1;
+    secs = benchNow() - start;
+    if (secs < best[1]) best[1] = secs;
+    counts[1] = items;
+    freeFeedCache(&cache);
+  }
+  printf("parse and print all : %7.1f ms  %6d items printed\n", best[0] * 1e3, counts[0]);
+  printf("parseUnseenItems    : %7.1f ms  %6d items printed  (%.1fx)\n", best[1] * 1e3, counts[1],
+         best[0] / best[1]);
+  printf("correctness checks  : %s\n", failures ? "FAILED" : "passed");
+
+  free(oldXml);
+  free(newXml);
+  freeFeedFetcher(&fetcher);
+  stopFeedServer(&server);
+  free(urlText);
+  free(urls);
+  fclose(sink);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,340 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Feed polling cache test
+ *
+ * Description:
+ * Polls the fixture feeds in data/ from a loopback feed server the way
+ * runRss poll does: conditional requests built from a FeedCache, and
+ * only unseen items parsed.  Checks that an unchanged feed comes back as
+ * a 304 with nothing to parse, that a changed feed yields just its new
+ * items, that seen items are skipped without being delivered, and that
+ * the cache survives a save and load while bad cache files are
+ * rejected.  Exits non-zero on a failure.
+ *
+ * Usage: cacheTest [fixtureDirectory]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "feed_cache.h"
+#include "feed_fetcher.h"
+#include "feed_server.h"
+#include "rss_stream.h"
+
+#define NUM_URLS 8
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+  printf("%-44s: %s\n", what, ok ? "passed" : "FAILED");
+  failures += !ok;
+}
+
+static char *readFile(const char *path, size_t *len) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return NULL;
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  *len = text ? fread(text, 1, size, in) : 0;
+  if (text) text[*len] = '\0';
+  fclose(in);
+  return text;
+}
+
+/* Handler: counts the items and remembers the first title. */
+typedef struct {
+  int items;
+  char firstTitle[128];
+} Tally;
+
+static int tallyItem(const Rss *item, void *context) {
+  Tally *tally = context;
+  if (tally->items++ == 0) {
+    snprintf(tally->firstTitle, sizeof(tally->firstTitle), "%s", item->title);
+  }
+  return 1;
+}
+
+/* Handler: like tallyItem, but stops at the second item (as on running out of memory). */
+static int tallyOneItem(const Rss *item, void *context) {
+  Tally *tally = context;
+  return tally->items == 0 && tallyItem(item, context);
+}
+
+/* What one poll of every url did. */
+typedef struct {
+  int ok200;           /* 200s that parsed */
+  int notModified;     /* 304s with an empty body */
+  int newItems;        /* unseen items delivered */
+  int bad;             /* anything else */
+  char firstTitle[128];
+} Poll;
+
+/*
+ * Fetches the urls conditionally from the cache's validators, parses
+ * only unseen items of 200s and records the new validators, as runRss
+ * poll does.
+ */
+static Poll pollFeeds(FeedCache *cache, const char *const *urls, int n) {
+  Poll poll = { 0, 0, 0, 0, "" };
+  FeedValidators validators[NUM_URLS];
+  for (int i = 0; i < n; i++) {
+    FeedCacheEntry *entry = feedCacheEntry(cache, urls[i]);
+    validators[i].etag = entry ? strdup(entry->etag) : NULL;
+    validators[i].lastModified = entry ? strdup(entry->lastModified) : NULL;
+  }
+  FeedFetcher fetcher;
+  FeedQueue queue;
+  if (!initFeedFetcher(&fetcher, 4)) {
+    poll.bad = n;
+    return poll;
+  }
+  if (!initFeedQueue(&queue)) {
+    freeFeedFetcher(&fetcher);
+    poll.bad = n;
+    return poll;
+  }
+  FeedFetchJob job = { &fetcher, urls, n, &queue, validators };
+  if (startFeedFetchJob(&job)) {
+    FeedResult *result;
+    while ((result = feedQueuePop(&queue)) != NULL) {
+      FeedCacheEntry *entry = feedCacheFind(cache, result->url);
+      if (result->error == CURLE_OK && result->status == 304 && result->len == 0) {
+        poll.notModified++;
+      } else if (result->error == CURLE_OK && result->status == 200 && entry && result->etag &&
+                 result->lastModified) {
+        Tally tally = { 0, "" };
+        int fresh = parseUnseenItems(entry, result->body, result->len, tallyItem, &tally);
+        if (fresh >= 0 && feedCacheSetValidators(entry, result->etag, result->lastModified)) {
+          poll.ok200++;
+          poll.newItems += fresh;
+          if (fresh > 0 && !poll.firstTitle[0]) strcpy(poll.firstTitle, tally.firstTitle);
+        } else {
+          poll.bad++;
+        }
+      } else {
+        poll.bad++;
+      }
+      freeFeedResult(result);
+    }
+    poll.bad += joinFeedFetchJob(&job) != n;
+  } else {
+    poll.bad = n;
+  }
+  freeFeedQueue(&queue);
+  freeFeedFetcher(&fetcher);
+  for (int i = 0; i < n; i++) {
+    free((char *)validators[i].etag);
+    free((char *)validators[i].lastModified);
+  }
+  return poll;
+}
+
+/* Key filter for streamUnseenRssItems: keys starting with "old" are seen. */
+typedef struct {
+  int asked;
+  int items;
+  char titles[256];
+} Filtered;
+
+static int seenIfOld(const char *key, void *context) {
+  Filtered *filtered = context;
+  filtered->asked++;
+  return strncmp(key, "old", 3) == 0;
+}
+
+static int collectTitle(const Rss *item, void *context) {
+  Filtered *filtered = context;
+  filtered->items++;
+  strncat(filtered->titles, item->title, sizeof(filtered->titles) - strlen(filtered->titles) - 2);
+  strcat(filtered->titles, ";");
+  return 1;
+}
+
+static void checkFilter(void) {
+  /* keyed by a leading guid, a trailing guid, the link, the title, or nothing */
+  const char *xml =
+    "<rss><channel>"
+    "<item><guid>old-1</guid><title>A</title><description>skipped</description></item>"
+    "<item><title>B</title><link>http://x/b</link><guid>new-1</guid></item>"
+    "<item><title>C</title><link>old-link</link></item>"
+    "<item><title>old title</title></item>"
+    "<item><title></title></item>"
+    "<item><title>D</title><guid>new-2</guid></item>"
+    "<item/>"
+    "</channel></rss>";
+  Filtered filtered = { 0, 0, "" };
+  int count = streamUnseenRssItems(xml, strlen(xml), seenIfOld, collectTitle, &filtered);
+  check(count == 4 && filtered.items == 4 && filtered.asked == 5 &&
+        strcmp(filtered.titles, "B;;D;;") == 0, "seen items skipped, keyless ones kept");
+
+  const char *atom =
+    "<feed xmlns=\"http://www.w3.org/2005/Atom\">"
+    "<entry><id>old-9</id><title>E</title></entry>"
+    "<entry><title>F</title><id>new-9</id><link href=\"http://x/f\"/></entry>"
+    "</feed>";
+  Filtered atomFiltered = { 0, 0, "" };
+  count = streamUnseenRssItems(atom, strlen(atom), seenIfOld, collectTitle, &atomFiltered);
+  check(count == 1 && strcmp(atomFiltered.titles, "F;") == 0, "Atom entries keyed by id");
+
+  /* duplicates within a document, and the seen set tracking the feed */
+  const char *first = "<rss><channel><item><guid>a</guid><title>1</title></item>"
+                      "<item><guid>b</guid></item><item><guid>a</guid></item></channel></rss>";
+  const char *second = "<rss><channel><item><guid>c</guid><title>3</title></item>"
+                       "<item><guid>b</guid></item></channel></rss>";
+  FeedCache cache;
+  initFeedCache(&cache);
+  FeedCacheEntry *entry = feedCacheEntry(&cache, "http://example.com/feed");
+  Tally tally = { 0, "" };
+  int ok = entry && parseUnseenItems(entry, first, strlen(first), tallyItem, &tally) == 2 &&
+           entry->seen.count == 2 && feedCacheSeen(entry, "a") && feedCacheSeen(entry, "b");
+  Tally again = { 0, "" };
+  ok = ok && parseUnseenItems(entry, second, strlen(second), tallyItem, &again) == 1 &&
+       strcmp(again.firstTitle, "3") == 0 && entry->seen.count == 2 && !feedCacheSeen(entry, "a") &&
+       feedCacheSeen(entry, "c");
+  const char *broken = "<rss><channel><item><guid>d</guid></item><item>";
+  ok = ok && parseUnseenItems(entry, broken, strlen(broken), tallyItem, &again) == -1 &&
+       entry->seen.count == 2 && !feedCacheSeen(entry, "d");
+  check(ok, "repeats, replaced set, malformed rollback");
+
+  /* a stopped parse remembers only the items handled */
+  const char *third = "<rss><channel><item><guid>c</guid></item><item><guid>d</guid></item>"
+                      "<item><guid>e</guid></item><item><guid>f</guid></item></channel></rss>";
+  Tally stopped = { 0, "" }, rest = { 0, "" };
+  ok = parseUnseenItems(entry, third, strlen(third), tallyOneItem, &stopped) == -1 &&
+       stopped.items == 1 && feedCacheSeen(entry, "b") && feedCacheSeen(entry, "d") &&
+       !feedCacheSeen(entry, "e") && !feedCacheSeen(entry, "f");
+  ok = ok && parseUnseenItems(entry, third, strlen(third), tallyItem, &rest) == 2 &&
+       rest.items == 2 && entry->seen.count == 4;
+  check(ok, "a stopped parse redelivers what it missed");
+  freeFeedCache(&cache);
+}
+
+/* Whether two caches hold the same urls, validators and seen keys. */
+static int sameCache(FeedCache *a, FeedCache *b) {
+  if (a->count != b->count) return 0;
+  for (int i = 0; i < a->count; i++) {
+    const FeedCacheEntry *x = &a->entries[i];
+    const FeedCacheEntry *y = feedCacheFind(b, x->url);
+    if (!y || strcmp(x->etag, y->etag) != 0 || strcmp(x->lastModified, y->lastModified) != 0 ||
+        x->seen.count != y->seen.count) {
+      return 0;
+    }
+    for (size_t s = 0; s < x->seen.capacity; s++) {
+      uint64_t hash = x->seen.slots[s];
+      if (!hash) continue;
+      int found = 0;
+      for (size_t t = 0; t < y->seen.capacity && !found; t++) found = y->seen.slots[t] == hash;
+      if (!found) return 0;
+    }
+  }
+  return 1;
+}
+
+static void checkFiles(FeedCache *cache) {
+  char path[] = "/tmp/rssCacheTestXXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    check(0, "cache file round trip");
+    return;
+  }
+  close(fd);
+  FeedCache loaded;
+  initFeedCache(&loaded);
+  check(saveFeedCache(cache, path) && loadFeedCache(&loaded, path) && sameCache(cache, &loaded),
+        "cache file round trip");
+  freeFeedCache(&loaded);
+
+  size_t len = 0;
+  char *bytes = readFile(path, &len);
+  int ok = bytes && len > 40;
+  for (int cut = 0; ok && cut < 3; cut++) {
+    /* truncated, trailing garbage, bad magic */
+    FILE *out = fopen(path, "wb");
+    size_t keep = cut == 0 ? len - 9 : len;
+    ok = out && fwrite(bytes, 1, keep, out) == keep;
+    if (ok && cut == 1) ok = fputc('x', out) != EOF;
+    if (ok && cut == 2) ok = fseek(out, 0, SEEK_SET) == 0 && fputc('X', out) != EOF;
+    if (out) fclose(out);
+    initFeedCache(&loaded);
+    ok = ok && !loadFeedCache(&loaded, path) && loaded.count == 0;
+    freeFeedCache(&loaded);
+  }
+  free(bytes);
+  unlink(path);
+  initFeedCache(&loaded);
+  ok = ok && loadFeedCache(&loaded, path) && loaded.count == 0;
+  check(ok, "bad cache files rejected, missing is empty");
+}
+
+int main(int argc, char **argv) {
+  const char *directory = argc > 1 ? argv[1] : "data";
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/%s", directory, names[0]);
+  size_t fixtureLen = 0;
+  char *fixture = readFile(path, &fixtureLen);
+  FeedServer server;
+  if (!fixture || !startFeedServer(&server, directory, 0)) {
+    fprintf(stderr, "Usage: %s [fixtureDirectory] (could not serve %s)\n", argv[0], directory);
+    return 1;
+  }
+
+  checkFilter();
+
+  static char urlText[NUM_URLS][128];
+  const char *urls[NUM_URLS];
+  for (int i = 0; i < NUM_URLS; i++) {
+    snprintf(urlText[i], sizeof(urlText[i]), "http://127.0.0.1:%d/%s?feed=%d", server.port,
+             names[i % 2], i);
+    urls[i] = urlText[i];
+  }
+  FeedCache cache;
+  initFeedCache(&cache);
+  Poll first = pollFeeds(&cache, urls, NUM_URLS);
+  check(first.ok200 == NUM_URLS && first.notModified == 0 && first.bad == 0 &&
+        first.newItems == NUM_URLS / 2 * (12 + 10), "first poll: every item is new");
+
+  long before = feedServerNotModified(&server);
+  Poll second = pollFeeds(&cache, urls, NUM_URLS);
+  check(second.notModified == NUM_URLS && second.ok200 == 0 && second.bad == 0 &&
+        feedServerNotModified(&server) - before == NUM_URLS, "unchanged feeds answered with 304");
+
+  /* a server that ignores the etag: Last-Modified alone still works */
+  for (int i = 0; i < cache.count; i++) cache.entries[i].etag[0] = '\0';
+  Poll sinceOnly = pollFeeds(&cache, urls, NUM_URLS);
+  check(sinceOnly.notModified == NUM_URLS && sinceOnly.bad == 0,
+        "If-Modified-Since alone gives 304");
+
+  /* one new item at the top of one feed; its old items stay seen */
+  const char *fresh = "<item><title>Fresh news</title><guid>cse-9999</guid></item>\n    ";
+  char *changed = malloc(fixtureLen + strlen(fresh) + 1);
+  const char *firstItem = strstr(fixture, "<item>");
+  size_t head = firstItem - fixture;
+  memcpy(changed, fixture, head);
+  strcpy(changed + head, fresh);
+  memcpy(changed + head + strlen(fresh), firstItem, fixtureLen - head);
+  size_t changedLen = fixtureLen + strlen(fresh);
+  Poll third = { 0, 0, 0, 1, "" };
+  if (feedServerSetFile(&server, names[0], changed, changedLen)) {
+    third = pollFeeds(&cache, urls, NUM_URLS);
+  }
+  check(third.ok200 == NUM_URLS / 2 && third.notModified == NUM_URLS / 2 && third.bad == 0 &&
+        third.newItems == NUM_URLS / 2 && strcmp(third.firstTitle, "Fresh news") == 0,
+        "changed feed: only its new item");
+  free(changed);
+
+  checkFiles(&cache);
+
+  freeFeedCache(&cache);
+  stopFeedServer(&server);
+  free(fixture);
+  return failures ? 1 : 0;
+}
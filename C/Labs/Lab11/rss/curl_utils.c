@@ -4,56 +4,55 @@
 #include <curl/curl.h>
 
 #include "curl_utils.h"
+#include "byte_buffer.h"
 
-void init_string(struct string *s) {
-  s->len = 0;
-  s->ptr = malloc(s->len + 1);
-  if (s->ptr == NULL) {
-    fprintf(stderr, "malloc() failed\n");
-    exit(EXIT_FAILURE);
-  }
-  s->ptr[0] = '\0';
-}
-
-size_t writefunc(void *ptr, size_t size, size_t nmemb, struct string *s) {
-  size_t new_len = s->len + size * nmemb;
-  s->ptr = realloc(s->ptr, new_len + 1);
-  if (s->ptr == NULL) {
-    fprintf(stderr, "realloc() failed\n");
-    exit(EXIT_FAILURE);
+/* A download in progress: the bytes so far and the handle fetching them. */
+typedef struct {
+  ByteBuffer buffer;
+  CURL *curl;
+  int sized;  /* whether Content-Length has been looked at */
+} Download;
+
+/*
+ * curl write callback: appends each chunk to the download buffer, sized
+ * from the Content-Length when the server sends one.  Returns 0
+ * (aborting the transfer) if memory runs out.
+ */
+static size_t writefunc(void *ptr, size_t size, size_t nmemb, void *userdata) {
+  Download *download = userdata;
+  size_t bytes = size * nmemb;
+  if (!download->sized) {
+    /* headers are in by the first chunk; reserve the whole body once */
+    curl_off_t length = -1;
+    download->sized = 1;
+    if (curl_easy_getinfo(download->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length) == CURLE_OK &&
+        length > 0) {
+      byteBufferReserve(&download->buffer, (size_t)length);
+    }
   }
-  memcpy(s->ptr + s->len, ptr, size * nmemb);
-  s->ptr[new_len] = '\0';
-  s->len = new_len;
-
-  return size * nmemb;
+  return byteBufferAppend(&download->buffer, ptr, bytes) ? bytes : 0;
 }
 
 char *getContent(const char *url) {
   char *result = NULL;
-  CURL *curl;
-  CURLcode res;
-
-  curl = curl_easy_init();
-  if (curl) {
-    struct string s;
-    init_string(&s);
-
-    curl_easy_setopt(curl, CURLOPT_URL, url);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "F your user agent tracking BS");
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writefunc);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &s);
-    res = curl_easy_perform(curl);
+  Download download = { .sized = 0 };
+
+  download.curl = curl_easy_init();
+  if (download.curl && initByteBuffer(&download.buffer, 0)) {
+    curl_easy_setopt(download.curl, CURLOPT_URL, url);
+    curl_easy_setopt(download.curl, CURLOPT_USERAGENT, "F your user agent tracking BS");
+    curl_easy_setopt(download.curl, CURLOPT_WRITEFUNCTION, writefunc);
+    curl_easy_setopt(download.curl, CURLOPT_WRITEDATA, &download);
+    CURLcode res = curl_easy_perform(download.curl);
     if(res != CURLE_OK) {
       fprintf(stderr, "cURL encountered an error: %s\n", curl_easy_strerror(res));
     }
-    
-    result = (char *)malloc(sizeof(char) * (strlen(s.ptr) + 1));
-    strcpy(result, s.ptr);
-    free(s.ptr);
 
-    /* always cleanup */
-    curl_easy_cleanup(curl);
+    /* the buffer is already NUL-terminated; hand it over as is */
+    result = byteBufferRelease(&download.buffer, NULL);
   }
+
+  /* always cleanup */
+  if (download.curl) curl_easy_cleanup(download.curl);
   return result;
 }
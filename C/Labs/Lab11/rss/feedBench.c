@@ -0,0 +1,195 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS item collection benchmark
+ *
+ * Description:
+ * Collects every item of a large synthetic RSS feed two ways: a
+ * createRss copy per item (as parseRssXml did) and an RssFeed with its
+ * string arena, counting heap calls and timing build and free.  Then
+ * picks the 10 newest items with parseRssFeedNewest against collecting
+ * everything and sorting by date, reporting the peak heap of each.  The
+ * results must agree.  Exits non-zero on a mismatch.
+ *
+ * Heap calls are counted by wrapping malloc, calloc, realloc and free
+ * at link time (see the makefile), so only this lab's calls count;
+ * libxml2's own heap stays flat while streaming (see rssBench).
+ *
+ * Usage: feedBench [numItems]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <malloc.h>
+
+#include "rss.h"
+#include "rss_feed.h"
+#include "rss_stream.h"
+#include "bench_utils.h"
+
+#define NEWEST 10
+
+static long allocations;
+static size_t liveBytes, peakBytes;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+static void *counted(void *ptr) {
+  if (ptr) {
+    allocations++;
+    liveBytes += malloc_usable_size(ptr);
+    if (liveBytes > peakBytes) peakBytes = liveBytes;
+  }
+  return ptr;
+}
+
+void *__wrap_malloc(size_t size) {
+  return counted(__real_malloc(size));
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  return counted(__real_calloc(count, size));
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  size_t old = ptr ? malloc_usable_size(ptr) : 0;
+  void *grown = __real_realloc(ptr, size);
+  if (grown) liveBytes -= old;
+  return grown ? counted(grown) : NULL;
+}
+
+void __wrap_free(void *ptr) {
+  if (ptr) liveBytes -= malloc_usable_size(ptr);
+  __real_free(ptr);
+}
+
+/* The old way: one createRss per item, kept in a growing pointer array. */
+typedef struct {
+  Rss **items;
+  int count;
+  int capacity;
+} RssList;
+
+static int createEach(const Rss *item, void *context) {
+  RssList *list = context;
+  if (list->count == list->capacity) {
+    list->capacity = list->capacity ? list->capacity * 2 : 16;
+    list->items = realloc(list->items, sizeof(Rss *) * list->capacity);
+    if (!list->items) return 0;
+  }
+  list->items[list->count++] = createRss(item->title, item->link, item->date, item->description);
+  return 1;
+}
+
+static const RssFeed *sortFeed;
+
+static int newestFirst(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  long long tx = parseRssDate(sortFeed->items[x].date), ty = parseRssDate(sortFeed->items[y].date);
+  if (tx != ty) return tx > ty ? -1 : 1;
+  return x - y;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 200000;
+  if (n < NEWEST) {
+    fprintf(stderr, "Usage: %s [numItems >= %d]\n", argv[0], NEWEST);
+    return 1;
+  }
+  size_t len = 0;
+  char *xml = makeSyntheticRss(n, &len);
+  if (!xml) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+  printf("RSS item collection (n = %d, %.1f MB of XML)\n", n, len / 1e6);
+  printf("================================================\n");
+
+  int failures = 0, rounds = 3;
+  double best[6] = { 1e30, 1e30, 1e30, 1e30, 1e30, 1e30 };
+  long calls[4] = { 0, 0, 0, 0 };
+  size_t peaks[2] = { 0, 0 };
+  for (int r = 0; r < rounds; r++) {
+    RssList list = { NULL, 0, 0 };
+    allocations = 0;
+    double start = benchNow();
+    failures += streamRssItems(xml, len, createEach, &list) != n;
+    double secs = benchNow() - start;
+    calls[0] = allocations;
+    if (secs < best[0]) best[0] = secs;
+    start = benchNow();
+    for (int i = 0; i < list.count; i++) freeRss(list.items[i]);
+    free(list.items);
+    secs = benchNow() - start;
+    if (secs < best[1]) best[1] = secs;
+
+    RssFeed feed;
+    initRssFeed(&feed);
+    allocations = 0;
+    start = benchNow();
+    failures += parseRssFeed(xml, len, &feed) != n;
+    secs = benchNow() - start;
+    calls[1] = allocations;
+    if (secs < best[2]) best[2] = secs;
+    start = benchNow();
+    freeRssFeed(&feed);
+    secs = benchNow() - start;
+    if (secs < best[3]) best[3] = secs;
+
+    /* the newest items: collect and sort everything, or keep a heap */
+    RssFeed all, newest;
+    initRssFeed(&all);
+    initRssFeed(&newest);
+    size_t base = liveBytes;
+    peakBytes = liveBytes;
+    allocations = 0;
+    start = benchNow();
+    int *order = NULL;
+    if (parseRssFeed(xml, len, &all) == n && (order = malloc(sizeof(int) * n)) != NULL) {
+      for (int i = 0; i < n; i++) order[i] = i;
+      sortFeed = &all;
+      qsort(order, n, sizeof(int), newestFirst);
+    }
+    secs = benchNow() - start;
+    calls[2] = allocations;
+    peaks[0] = peakBytes - base;
+    if (secs < best[4]) best[4] = secs;
+
+    base = liveBytes;
+    peakBytes = liveBytes;
+    allocations = 0;
+    start = benchNow();
+    int got = parseRssFeedNewest(xml, len, NEWEST, &newest);
+    secs = benchNow() - start;
+    calls[3] = allocations;
+    peaks[1] = peakBytes - base;
+    if (secs < best[5]) best[5] = secs;
+
+    failures += !order || got != NEWEST;
+    for (int i = 0; order && i < got; i++) {
+      const Rss *a = &newest.items[i], *b = &all.items[order[i]];
+      failures += strcmp(a->title, b->title) != 0 || strcmp(a->date, b->date) != 0;
+    }
+    free(order);
+    freeRssFeed(&all);
+    freeRssFeed(&newest);
+  }
+
+  printf("createRss per item      : %9ld heap calls, build %7.1f ms, free %6.1f ms\n",
+         calls[0], best[0] * 1e3, best[1] * 1e3);
+  printf("RssFeed arena           : %9ld heap calls, build %7.1f ms, free %6.1f ms\n",
+         calls[1], best[2] * 1e3, best[3] * 1e3);
+  printf("%d newest, collect+sort : %9ld heap calls, %7.1f ms, peak heap %8.2f MB\n",
+         NEWEST, calls[2], best[4] * 1e3, peaks[0] / 1e6);
+  printf("%d newest, bounded heap : %9ld heap calls, %7.1f ms, peak heap %8.2f MB\n",
+         NEWEST, calls[3], best[5] * 1e3, peaks[1] / 1e6);
+  printf("correctness checks      : %s\n", failures ? "FAILED" : "passed");
+
+  free(xml);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS item collection test
+ *
+ * Description:
+ * Checks RssFeed: RSS and Atom date parsing, collecting every item of
+ * the fixture feeds in data/ (and of a feed too large for the old
+ * 100-item array) with strings that stay put as the feed grows, and the
+ * newest-n mode against a full sort, including ties, undated items and
+ * malformed input.  Exits non-zero on a failure.
+ *
+ * Usage: feedTest [fixtureDirectory]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "rss_feed.h"
+#include "rss_stream.h"
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+  printf("%-44s: %s\n", what, ok ? "passed" : "FAILED");
+  failures += !ok;
+}
+
+static char *readFile(const char *path, size_t *len) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return NULL;
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  *len = text ? fread(text, 1, size, in) : 0;
+  if (text) text[*len] = '\0';
+  fclose(in);
+  return text;
+}
+
+static int sameItem(const Rss *a, const Rss *b) {
+  return strcmp(a->title, b->title) == 0 && strcmp(a->link, b->link) == 0 &&
+         strcmp(a->date, b->date) == 0 && strcmp(a->description, b->description) == 0;
+}
+
+/* Handler: the items of a document must match the feed's, in order. */
+typedef struct {
+  const RssFeed *feed;
+  int next;
+  int mismatches;
+} Compare;
+
+static int compareItem(const Rss *item, void *context) {
+  Compare *compare = context;
+  if (compare->next >= compare->feed->count ||
+      !sameItem(item, &compare->feed->items[compare->next])) {
+    compare->mismatches++;
+  }
+  compare->next++;
+  return 1;
+}
+
+static void checkDates(void) {
+  static const struct { const char *text; long long time; } dates[] = {
+    { "Mon, 02 Mar 2026 15:00:00 -0600", 1772485200LL },
+    { "  Mon, 2 Mar 2026 21:00:00 GMT", 1772485200LL },
+    { "02 mar 26 16:00 EST", 1772485200LL },
+    { "Mon, 02 Mar 2026 16:00:00 CST", 1772488800LL },
+    { "2026-03-02T15:00:00-06:00", 1772485200LL },
+    { "2026-03-02T21:00:00.250Z", 1772485200LL },
+    { "2026-03-02 22:00:00+0000", 1772488800LL },
+    { "Fri, 31 Dec 1999 23:59:59 +0000", 946684799LL },
+    { "1969-07-20T20:17:40Z", -14182940LL },
+    { "", RSS_NO_DATE },
+    { "yesterday", RSS_NO_DATE },
+    { "Mon, 02 Foo 2026 15:00:00 -0600", RSS_NO_DATE },
+    { "2026-13-02T15:00:00Z", RSS_NO_DATE },
+    { "Mon, 02 Mar 2026 15:00:00 Mars", RSS_NO_DATE },
+  };
+  int bad = parseRssDate(NULL) != RSS_NO_DATE;
+  for (size_t i = 0; i < sizeof(dates) / sizeof(dates[0]); i++) {
+    long long got = parseRssDate(dates[i].text);
+    if (got != dates[i].time) {
+      fprintf(stderr, "  \"%s\": %lld, expected %lld\n", dates[i].text, got, dates[i].time);
+      bad++;
+    }
+  }
+  check(!bad, "RSS and Atom dates");
+}
+
+/* A feed whose items have the given dates (NULL: no pubDate). */
+static char *makeDated(const char **dates, int n) {
+  size_t size = 64 + (size_t)n * 160;
+  char *xml = malloc(size);
+  size_t at = snprintf(xml, size, "<rss><channel>");
+  for (int i = 0; i < n; i++) {
+    at += snprintf(xml + at, size - at, "<item><title>item %d</title>", i);
+    if (dates[i]) at += snprintf(xml + at, size - at, "<pubDate>%s</pubDate>", dates[i]);
+    at += snprintf(xml + at, size - at, "</item>");
+  }
+  snprintf(xml + at, size - at, "</channel></rss>");
+  return xml;
+}
+
+/* Whether item a of the full feed belongs before b in newest-first order. */
+static const RssFeed *referenceFeed;
+
+static int compareReference(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  long long tx = parseRssDate(referenceFeed->items[x].date);
+  long long ty = parseRssDate(referenceFeed->items[y].date);
+  if (tx != ty) return tx > ty ? -1 : 1;
+  return x - y;
+}
+
+/* parseRssFeedNewest(n) must equal the first n of a stable sort by date. */
+static int newestMatches(const char *xml, int n) {
+  RssFeed all, newest;
+  initRssFeed(&all);
+  initRssFeed(&newest);
+  int total = parseRssFeed(xml, strlen(xml), &all);
+  int got = parseRssFeedNewest(xml, strlen(xml), n, &newest);
+  int expect = n < total ? n : total;
+  int ok = total >= 0 && got == expect && newest.count == expect;
+  int *order = malloc(sizeof(int) * (total > 0 ? total : 1));
+  for (int i = 0; i < total; i++) order[i] = i;
+  referenceFeed = &all;
+  qsort(order, total, sizeof(int), compareReference);
+  for (int i = 0; ok && i < expect; i++) ok = sameItem(&newest.items[i], &all.items[order[i]]);
+  free(order);
+  freeRssFeed(&all);
+  freeRssFeed(&newest);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  const char *directory = argc > 1 ? argv[1] : "data";
+  checkDates();
+
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  const int counts[] = { 12, 10 };
+  RssFeed feed;
+  initRssFeed(&feed);
+  int ok = 1;
+  size_t lens[2];
+  char *fixtures[2];
+  for (int f = 0; f < 2; f++) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", directory, names[f]);
+    fixtures[f] = readFile(path, &lens[f]);
+    if (!fixtures[f]) {
+      fprintf(stderr, "Usage: %s [fixtureDirectory] (missing %s)\n", argv[0], path);
+      return 1;
+    }
+    int before = feed.count;
+    Compare compare = { &feed, before, 0 };
+    ok = ok && parseRssFeed(fixtures[f], lens[f], &feed) == counts[f] &&
+         feed.count == before + counts[f] &&
+         streamRssItems(fixtures[f], lens[f], compareItem, &compare) == counts[f] &&
+         compare.mismatches == 0;
+  }
+  check(ok, "fixture feeds appended in document order");
+
+  /* far more than 100 items; earlier strings must not move */
+  const char *firstTitle = feed.items[0].title;
+  char *firstCopy = strdup(firstTitle);
+  int before = feed.count;
+  for (int r = 0; r < 200; r++) ok = ok && parseRssFeed(fixtures[r % 2], lens[r % 2], &feed) > 0;
+  check(ok && feed.count == before + 100 * (counts[0] + counts[1]) &&
+        feed.items[0].title == firstTitle && strcmp(firstTitle, firstCopy) == 0,
+        "4400 items, strings stay put as it grows");
+  free(firstCopy);
+
+  before = feed.count;
+  const char *broken = "<rss><channel><item><title>x</title></item><item>";
+  check(parseRssFeed(broken, strlen(broken), &feed) == -1 && feed.count == before &&
+        parseRssFeedNewest(broken, strlen(broken), 3, &feed) == -1 && feed.count == before,
+        "malformed feed leaves the feed unchanged");
+  freeRssFeed(&feed);
+  check(feed.count == 0 && feed.items == NULL, "freeRssFeed empties the feed");
+
+  ok = 1;
+  for (int f = 0; f < 2; f++) {
+    for (int n = 1; n <= 14; n++) ok = ok && newestMatches(fixtures[f], n);
+  }
+  check(ok, "newest n of the fixtures (n = 1..14)");
+
+  /* ties keep document order, undated items are oldest */
+  const char *tied[] = { "Mon, 02 Mar 2026 15:00:00 -0600", NULL, "2026-03-02T21:00:00Z",
+                         "Tue, 03 Mar 2026 00:00:00 GMT", "not a date",
+                         "Mon, 02 Mar 2026 21:00:00 +0000", NULL };
+  char *xml = makeDated(tied, 7);
+  ok = 1;
+  for (int n = 1; n <= 8; n++) ok = ok && newestMatches(xml, n);
+  RssFeed top;
+  initRssFeed(&top);
+  ok = ok && parseRssFeedNewest(xml, strlen(xml), 3, &top) == 3 &&
+       strcmp(top.items[0].title, "item 3") == 0 && strcmp(top.items[1].title, "item 0") == 0 &&
+       strcmp(top.items[2].title, "item 2") == 0 &&
+       parseRssFeedNewest(xml, strlen(xml), 0, &top) == 0 && top.count == 3;
+  freeRssFeed(&top);
+  free(xml);
+  check(ok, "ties in document order, undated last");
+
+  /* many random dates with repeats */
+  enum { RANDOM_ITEMS = 3000 };
+  static char dateText[RANDOM_ITEMS][40];
+  const char *dates[RANDOM_ITEMS];
+  unsigned int state = 5u;
+  for (int i = 0; i < RANDOM_ITEMS; i++) {
+    state = state * 1103515245u + 12345u;
+    snprintf(dateText[i], sizeof(dateText[i]), "2026-%02u-%02uT%02u:00:00Z", 1 + (state >> 8) % 12,
+             1 + (state >> 12) % 28, (state >> 4) % 3);
+    dates[i] = (state >> 20) % 50 ? dateText[i] : NULL;
+  }
+  xml = makeDated(dates, RANDOM_ITEMS);
+  const int sizes[] = { 1, 2, 10, 100, 1000, RANDOM_ITEMS, RANDOM_ITEMS + 5 };
+  ok = 1;
+  for (int s = 0; s < 7; s++) ok = ok && newestMatches(xml, sizes[s]);
+  free(xml);
+  check(ok, "newest n of 3000 random dates");
+
+  free(fixtures[0]);
+  free(fixtures[1]);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,304 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Feed polling cache
+ *
+ * Description:
+ * Implements the per-feed validators, seen-item sets and cache file
+ * declared in feed_cache.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "feed_cache.h"
+
+#define CACHE_MAGIC "RSSCACHE"
+#define BYTE_ORDER_MARK 0x01020304u
+
+/* Limits that a sane cache file stays far below. */
+#define MAX_FIELD_BYTES 65536u
+#define MAX_KEYS (1u << 24)
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t count;          /* entries that follow */
+  uint32_t reserved;
+} CacheHeader;
+
+/* Before each entry's url, etag and lastModified (no NULs) and keys. */
+typedef struct {
+  uint32_t urlLen;
+  uint32_t etagLen;
+  uint32_t lastModifiedLen;
+  uint32_t keys;           /* 64-bit hashes after the strings */
+} EntryHeader;
+
+/* FNV-1a with a final mix, so the low bits used as a slot are spread. */
+static uint64_t hashKey(const char *key) {
+  uint64_t hash = 14695981039346656037ull;
+  for (const unsigned char *at = (const unsigned char *)key; *at; at++) {
+    hash = (hash ^ *at) * 1099511628211ull;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  return hash ? hash : 1;
+}
+
+static int setContains(const FeedKeySet *set, uint64_t hash) {
+  if (set->capacity == 0) return 0;
+  size_t mask = set->capacity - 1;
+  for (size_t at = hash & mask; set->slots[at]; at = (at + 1) & mask) {
+    if (set->slots[at] == hash) return 1;
+  }
+  return 0;
+}
+
+/* Inserts without growing; the set must have a free slot. */
+static void setPlace(FeedKeySet *set, uint64_t hash) {
+  size_t mask = set->capacity - 1;
+  size_t at = hash & mask;
+  while (set->slots[at] && set->slots[at] != hash) at = (at + 1) & mask;
+  if (!set->slots[at]) {
+    set->slots[at] = hash;
+    set->count++;
+  }
+}
+
+/* Adds a hash, keeping the set at most half full.  Returns 0 if out of memory. */
+static int setAdd(FeedKeySet *set, uint64_t hash) {
+  if ((set->count + 1) * 2 > set->capacity) {
+    FeedKeySet grown = { NULL, 0, set->capacity ? set->capacity * 2 : 16 };
+    grown.slots = calloc(grown.capacity, sizeof(uint64_t));
+    if (!grown.slots) return 0;
+    for (size_t i = 0; i < set->capacity; i++) {
+      if (set->slots[i]) setPlace(&grown, set->slots[i]);
+    }
+    free(set->slots);
+    *set = grown;
+  }
+  setPlace(set, hash);
+  return 1;
+}
+
+static void freeSet(FeedKeySet *set) {
+  free(set->slots);
+  set->slots = NULL;
+  set->count = set->capacity = 0;
+}
+
+void initFeedCache(FeedCache *cache) {
+  cache->entries = NULL;
+  cache->count = 0;
+  cache->capacity = 0;
+}
+
+FeedCacheEntry *feedCacheFind(FeedCache *cache, const char *url) {
+  for (int i = 0; i < cache->count; i++) {
+    if (strcmp(cache->entries[i].url, url) == 0) return &cache->entries[i];
+  }
+  return NULL;
+}
+
+FeedCacheEntry *feedCacheEntry(FeedCache *cache, const char *url) {
+  FeedCacheEntry *entry = feedCacheFind(cache, url);
+  if (entry) return entry;
+  if (cache->count == cache->capacity) {
+    int capacity = cache->capacity ? cache->capacity * 2 : 8;
+    FeedCacheEntry *entries = realloc(cache->entries, sizeof(FeedCacheEntry) * capacity);
+    if (!entries) return NULL;
+    cache->entries = entries;
+    cache->capacity = capacity;
+  }
+  entry = &cache->entries[cache->count];
+  entry->url = strdup(url);
+  entry->etag = strdup("");
+  entry->lastModified = strdup("");
+  entry->seen.slots = NULL;
+  entry->seen.count = entry->seen.capacity = 0;
+  if (!entry->url || !entry->etag || !entry->lastModified) {
+    free(entry->url);
+    free(entry->etag);
+    free(entry->lastModified);
+    return NULL;
+  }
+  cache->count++;
+  return entry;
+}
+
+int feedCacheSetValidators(FeedCacheEntry *entry, const char *etag, const char *lastModified) {
+  char *etagCopy = strdup(etag ? etag : "");
+  char *lastModifiedCopy = strdup(lastModified ? lastModified : "");
+  if (!etagCopy || !lastModifiedCopy) {
+    free(etagCopy);
+    free(lastModifiedCopy);
+    return 0;
+  }
+  free(entry->etag);
+  free(entry->lastModified);
+  entry->etag = etagCopy;
+  entry->lastModified = lastModifiedCopy;
+  return 1;
+}
+
+int feedCacheSeen(const FeedCacheEntry *entry, const char *key) {
+  return setContains(&entry->seen, hashKey(key));
+}
+
+/* The state of parseUnseenItems, shared by its key filter and handler. */
+typedef struct {
+  const FeedKeySet *old;
+  FeedKeySet now;          /* keys of this document */
+  RssItemHandler handler;
+  void *context;
+  uint64_t pending;        /* key of the new item being delivered, or 0 */
+  int failed;
+  int stopped;             /* the handler asked to stop */
+} Unseen;
+
+static int seenBefore(const char *key, void *context) {
+  Unseen *unseen = context;
+  uint64_t hash = hashKey(key);
+  /* a key repeated within the document is only new the first time */
+  int seen = setContains(unseen->old, hash) || setContains(&unseen->now, hash);
+  /* a new key counts once its item has been handled */
+  unseen->pending = seen ? 0 : hash;
+  if (seen && !setAdd(&unseen->now, hash)) unseen->failed = 1;
+  return seen;
+}
+
+static int forwardItem(const Rss *item, void *context) {
+  Unseen *unseen = context;
+  uint64_t pending = unseen->pending;
+  unseen->pending = 0;
+  if (unseen->failed) return 0;
+  if (!unseen->handler(item, unseen->context)) {
+    unseen->stopped = 1;
+  } else if (pending && !setAdd(&unseen->now, pending)) {
+    unseen->failed = 1;
+  }
+  return !unseen->stopped && !unseen->failed;
+}
+
+int parseUnseenItems(FeedCacheEntry *entry, const char *xml, size_t len, RssItemHandler handler,
+                     void *context) {
+  Unseen unseen = { &entry->seen, { NULL, 0, 0 }, handler, context, 0, 0, 0 };
+  int delivered = streamUnseenRssItems(xml, len, seenBefore, forwardItem, &unseen);
+  /* stopped early: the keys not reached yet may still be in the old set */
+  for (size_t i = 0; unseen.stopped && !unseen.failed && i < entry->seen.capacity; i++) {
+    if (entry->seen.slots[i] && !setAdd(&unseen.now, entry->seen.slots[i])) unseen.failed = 1;
+  }
+  if (delivered < 0 || unseen.failed) {
+    freeSet(&unseen.now);
+    return -1;
+  }
+  freeSet(&entry->seen);
+  entry->seen = unseen.now;
+  return unseen.stopped ? -1 : delivered;
+}
+
+/* Reads a string of len bytes with no NUL in it; NULL on failure. */
+static char *readField(FILE *in, uint32_t len) {
+  if (len > MAX_FIELD_BYTES) return NULL;
+  char *text = malloc(len + 1);
+  if (!text) return NULL;
+  if (fread(text, 1, len, in) != len || memchr(text, '\0', len)) {
+    free(text);
+    return NULL;
+  }
+  text[len] = '\0';
+  return text;
+}
+
+/* Reads one entry into the cache.  Returns 0 on a bad or short entry. */
+static int readEntry(FeedCache *cache, FILE *in) {
+  EntryHeader header;
+  if (fread(&header, sizeof(header), 1, in) != 1 || header.keys > MAX_KEYS) return 0;
+  char *url = readField(in, header.urlLen);
+  char *etag = url ? readField(in, header.etagLen) : NULL;
+  char *lastModified = etag ? readField(in, header.lastModifiedLen) : NULL;
+  FeedCacheEntry *entry = lastModified && !feedCacheFind(cache, url) ? feedCacheEntry(cache, url)
+                                                                     : NULL;
+  int ok = entry && feedCacheSetValidators(entry, etag, lastModified);
+  free(url);
+  free(etag);
+  free(lastModified);
+  uint64_t hashes[256];
+  for (uint32_t done = 0; ok && done < header.keys;) {
+    uint32_t batch = header.keys - done < 256 ? header.keys - done : 256;
+    ok = fread(hashes, sizeof(uint64_t), batch, in) == batch;
+    for (uint32_t i = 0; ok && i < batch; i++) ok = hashes[i] && setAdd(&entry->seen, hashes[i]);
+    done += batch;
+  }
+  return ok;
+}
+
+int loadFeedCache(FeedCache *cache, const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return errno == ENOENT;
+  CacheHeader header;
+  int ok = fread(&header, sizeof(header), 1, in) == 1 &&
+           memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == FEED_CACHE_VERSION && header.byteOrder == BYTE_ORDER_MARK;
+  for (uint32_t i = 0; ok && i < header.count; i++) ok = readEntry(cache, in);
+  /* nothing may follow the last entry */
+  ok = ok && fgetc(in) == EOF && !ferror(in);
+  fclose(in);
+  if (!ok) freeFeedCache(cache);
+  return ok;
+}
+
+static int writeEntry(const FeedCacheEntry *entry, FILE *out) {
+  EntryHeader header = { strlen(entry->url), strlen(entry->etag), strlen(entry->lastModified),
+                         entry->seen.count };
+  if (header.urlLen > MAX_FIELD_BYTES || header.etagLen > MAX_FIELD_BYTES ||
+      header.lastModifiedLen > MAX_FIELD_BYTES || entry->seen.count > MAX_KEYS) {
+    return 0;
+  }
+  int ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+           fwrite(entry->url, 1, header.urlLen, out) == header.urlLen &&
+           fwrite(entry->etag, 1, header.etagLen, out) == header.etagLen &&
+           fwrite(entry->lastModified, 1, header.lastModifiedLen, out) == header.lastModifiedLen;
+  for (size_t i = 0; ok && i < entry->seen.capacity; i++) {
+    if (entry->seen.slots[i]) ok = fwrite(&entry->seen.slots[i], sizeof(uint64_t), 1, out) == 1;
+  }
+  return ok;
+}
+
+int saveFeedCache(const FeedCache *cache, const char *path) {
+  size_t tmpLen = strlen(path) + 5;
+  char *tmpPath = malloc(tmpLen);
+  if (!tmpPath) return 0;
+  snprintf(tmpPath, tmpLen, "%s.tmp", path);
+  FILE *out = fopen(tmpPath, "wb");
+  CacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+  header.version = FEED_CACHE_VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.count = cache->count;
+  int ok = out && fwrite(&header, sizeof(header), 1, out) == 1;
+  for (int i = 0; ok && i < cache->count; i++) ok = writeEntry(&cache->entries[i], out);
+  if (out && fclose(out) != 0) ok = 0;
+  if (ok) ok = rename(tmpPath, path) == 0;
+  if (!ok && out) remove(tmpPath);
+  free(tmpPath);
+  return ok;
+}
+
+void freeFeedCache(FeedCache *cache) {
+  for (int i = 0; i < cache->count; i++) {
+    free(cache->entries[i].url);
+    free(cache->entries[i].etag);
+    free(cache->entries[i].lastModified);
+    freeSet(&cache->entries[i].seen);
+  }
+  free(cache->entries);
+  initFeedCache(cache);
+}
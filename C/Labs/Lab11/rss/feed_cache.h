@@ -0,0 +1,115 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Feed polling cache
+ *
+ * Description:
+ * Remembers, per feed URL, what the last poll of that feed saw: the
+ * ETag and Last-Modified of its response, for a conditional GET next
+ * time, and a hash set of its item keys (guid, id or link; see
+ * rss_stream.h).  Every item is still parsed; only the new ones are
+ * delivered and printed.  The cache lives in memory and is saved to and
+ * loaded from a small binary file between runs.
+ *
+ * NOTE: the seen set of a feed is replaced by the keys of each document
+ * parsed, so it stays the size of the feed; an item that drops out of a
+ * feed and comes back counts as new.  Cache files are specific to the
+ * machine's byte order and are rejected (not converted) elsewhere.
+ */
+
+#ifndef FEED_CACHE_H
+#define FEED_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rss_stream.h"
+
+/* Bumped whenever the file layout changes; other versions are ignored. */
+#define FEED_CACHE_VERSION 1
+
+/**
+ * A set of 64-bit item key hashes with open addressing.
+ */
+typedef struct {
+  uint64_t *slots;        /* 0 marks a free slot */
+  size_t count;
+  size_t capacity;        /* 0 or a power of two */
+} FeedKeySet;
+
+typedef struct {
+  char *url;
+  char *etag;             /* of the last 200 response, "" if none */
+  char *lastModified;     /* likewise */
+  FeedKeySet seen;        /* keys of the items of that response */
+} FeedCacheEntry;
+
+typedef struct {
+  FeedCacheEntry *entries;
+  int count;
+  int capacity;
+} FeedCache;
+
+/**
+ * Initializes an empty cache.
+ */
+void initFeedCache(FeedCache *cache);
+
+/**
+ * Loads the cache file at path into an empty cache.  A missing file
+ * leaves the cache empty and counts as success.  Returns 0 (with the
+ * cache empty) if the file is unreadable, truncated, corrupt or from
+ * another version or byte order.
+ */
+int loadFeedCache(FeedCache *cache, const char *path);
+
+/**
+ * Writes the cache to path, under a temporary name that is renamed into
+ * place so a reader never sees a partial file.  Returns 1 on success or
+ * 0 on failure.
+ */
+int saveFeedCache(const FeedCache *cache, const char *path);
+
+/**
+ * Returns the entry for url, or NULL if the cache has none.
+ */
+FeedCacheEntry *feedCacheFind(FeedCache *cache, const char *url);
+
+/**
+ * Returns the entry for url, adding an empty one if needed (NULL if out
+ * of memory).  Adding an entry may move the others, so do not hold
+ * entry pointers across calls that add.
+ */
+FeedCacheEntry *feedCacheEntry(FeedCache *cache, const char *url);
+
+/**
+ * Records the validators of a feed's latest 200 response (NULL for a
+ * missing header).  Returns 0 if out of memory.
+ */
+int feedCacheSetValidators(FeedCacheEntry *entry, const char *etag, const char *lastModified);
+
+/**
+ * Returns 1 if the feed's last parsed document had an item with the key.
+ */
+int feedCacheSeen(const FeedCacheEntry *entry, const char *key);
+
+/**
+ * Streams the items of a freshly downloaded feed that its last document
+ * did not have to handler (see streamUnseenRssItems), then makes this
+ * document's keys the feed's seen set.  Returns the number of new items,
+ * or -1 (leaving the entry as it was) if the text is not a well-formed
+ * feed or memory ran out.  Also returns -1 if handler stops the parse:
+ * the seen set then gains only the keys of the items handled, so the
+ * item it stopped at and the ones after it are new again next time, and
+ * the caller should not save the response's validators.
+ */
+int parseUnseenItems(FeedCacheEntry *entry, const char *xml, size_t len, RssItemHandler handler,
+                     void *context);
+
+/**
+ * Frees every entry and empties the cache.
+ */
+void freeFeedCache(FeedCache *cache);
+
+#endif /* FEED_CACHE_H */
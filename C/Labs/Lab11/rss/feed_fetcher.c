@@ -0,0 +1,326 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Concurrent feed fetcher
+ *
+ * Description:
+ * Implements the cURL multi fetcher and result queue declared in
+ * feed_fetcher.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include "feed_fetcher.h"
+#include "byte_buffer.h"
+
+/* A parallel slot: an easy handle reused for one download after another. */
+struct Transfer {
+  CURL *curl;
+  ByteBuffer buffer;
+  int sized;       /* whether Content-Length has been looked at */
+  int index;       /* url being downloaded */
+  double start;
+  struct curl_slist *conditions;  /* If-None-Match / If-Modified-Since */
+  char *etag;      /* validators of the latest response */
+  char *lastModified;
+};
+
+static double nowSeconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* curl write callback, as in getContent: reserve once, then append. */
+static size_t writefunc(void *ptr, size_t size, size_t nmemb, void *userdata) {
+  Transfer *transfer = userdata;
+  size_t bytes = size * nmemb;
+  if (!transfer->sized) {
+    curl_off_t length = -1;
+    transfer->sized = 1;
+    if (curl_easy_getinfo(transfer->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length) == CURLE_OK &&
+        length > 0) {
+      byteBufferReserve(&transfer->buffer, (size_t)length);
+    }
+  }
+  return byteBufferAppend(&transfer->buffer, ptr, bytes) ? bytes : 0;
+}
+
+/* Replaces *field with a copy of the header value at text, trimmed. */
+static void keepHeader(char **field, const char *text, size_t len) {
+  while (len > 0 && (*text == ' ' || *text == '\t')) {
+    text++;
+    len--;
+  }
+  while (len > 0 && (text[len - 1] == '\r' || text[len - 1] == '\n' || text[len - 1] == ' ')) len--;
+  free(*field);
+  *field = strndup(text, len);
+}
+
+/* curl header callback: keeps the validators of the final response. */
+static size_t headerfunc(char *line, size_t size, size_t nmemb, void *userdata) {
+  Transfer *transfer = userdata;
+  size_t bytes = size * nmemb;
+  if (bytes > 5 && strncmp(line, "HTTP/", 5) == 0) {
+    /* a new response (after a redirect): forget the last one's */
+    free(transfer->etag);
+    free(transfer->lastModified);
+    transfer->etag = transfer->lastModified = NULL;
+  } else if (bytes > 5 && strncasecmp(line, "ETag:", 5) == 0) {
+    keepHeader(&transfer->etag, line + 5, bytes - 5);
+  } else if (bytes > 14 && strncasecmp(line, "Last-Modified:", 14) == 0) {
+    keepHeader(&transfer->lastModified, line + 14, bytes - 14);
+  }
+  return bytes;
+}
+
+/* Frees a transfer's per-download state. */
+static void clearTransfer(Transfer *transfer) {
+  freeByteBuffer(&transfer->buffer);
+  curl_slist_free_all(transfer->conditions);
+  free(transfer->etag);
+  free(transfer->lastModified);
+  transfer->conditions = NULL;
+  transfer->etag = transfer->lastModified = NULL;
+  transfer->index = -1;
+}
+
+int initFeedQueue(FeedQueue *queue) {
+  queue->head = queue->tail = NULL;
+  queue->closed = 0;
+  if (pthread_mutex_init(&queue->lock, NULL) != 0) return 0;
+  if (pthread_cond_init(&queue->ready, NULL) != 0) {
+    pthread_mutex_destroy(&queue->lock);
+    return 0;
+  }
+  return 1;
+}
+
+void feedQueuePush(FeedQueue *queue, FeedResult *result) {
+  result->next = NULL;
+  pthread_mutex_lock(&queue->lock);
+  if (queue->tail) queue->tail->next = result;
+  else queue->head = result;
+  queue->tail = result;
+  pthread_cond_signal(&queue->ready);
+  pthread_mutex_unlock(&queue->lock);
+}
+
+FeedResult *feedQueuePop(FeedQueue *queue) {
+  pthread_mutex_lock(&queue->lock);
+  while (!queue->head && !queue->closed) pthread_cond_wait(&queue->ready, &queue->lock);
+  FeedResult *result = queue->head;
+  if (result) {
+    queue->head = result->next;
+    if (!queue->head) queue->tail = NULL;
+    result->next = NULL;
+  }
+  pthread_mutex_unlock(&queue->lock);
+  return result;
+}
+
+void feedQueueClose(FeedQueue *queue) {
+  pthread_mutex_lock(&queue->lock);
+  queue->closed = 1;
+  pthread_cond_broadcast(&queue->ready);
+  pthread_mutex_unlock(&queue->lock);
+}
+
+void freeFeedQueue(FeedQueue *queue) {
+  while (queue->head) {
+    FeedResult *result = queue->head;
+    queue->head = result->next;
+    freeFeedResult(result);
+  }
+  queue->tail = NULL;
+  pthread_cond_destroy(&queue->ready);
+  pthread_mutex_destroy(&queue->lock);
+}
+
+void freeFeedResult(FeedResult *result) {
+  if (!result) return;
+  free(result->body);
+  free(result->etag);
+  free(result->lastModified);
+  free(result);
+}
+
+int initFeedFetcher(FeedFetcher *fetcher, int maxParallel) {
+  memset(fetcher, 0, sizeof(*fetcher));
+  if (maxParallel < 1) maxParallel = 1;
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+  fetcher->multi = curl_multi_init();
+  fetcher->transfers = calloc(maxParallel, sizeof(Transfer));
+  if (!fetcher->multi || !fetcher->transfers) {
+    freeFeedFetcher(fetcher);
+    return 0;
+  }
+  fetcher->maxParallel = maxParallel;
+  /* keep every connection the slots open, several per slot for many hosts */
+  curl_multi_setopt(fetcher->multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)maxParallel);
+  curl_multi_setopt(fetcher->multi, CURLMOPT_MAXCONNECTS, (long)maxParallel * 4);
+
+  for (int i = 0; i < maxParallel; i++) {
+    Transfer *transfer = &fetcher->transfers[i];
+    transfer->index = -1;
+    transfer->curl = curl_easy_init();
+    if (!transfer->curl) {
+      freeFeedFetcher(fetcher);
+      return 0;
+    }
+    curl_easy_setopt(transfer->curl, CURLOPT_USERAGENT, "F your user agent tracking BS");
+    curl_easy_setopt(transfer->curl, CURLOPT_WRITEFUNCTION, writefunc);
+    curl_easy_setopt(transfer->curl, CURLOPT_WRITEDATA, transfer);
+    curl_easy_setopt(transfer->curl, CURLOPT_HEADERFUNCTION, headerfunc);
+    curl_easy_setopt(transfer->curl, CURLOPT_HEADERDATA, transfer);
+    curl_easy_setopt(transfer->curl, CURLOPT_PRIVATE, transfer);
+    curl_easy_setopt(transfer->curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(transfer->curl, CURLOPT_ACCEPT_ENCODING, "");
+    curl_easy_setopt(transfer->curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(transfer->curl, CURLOPT_CONNECTTIMEOUT, 10L);
+    curl_easy_setopt(transfer->curl, CURLOPT_TIMEOUT, 60L);
+  }
+  return 1;
+}
+
+/* Builds the conditional headers for a url's validators (NULL: none). */
+static int addConditions(Transfer *transfer, const FeedValidators *validators) {
+  const char *names[2] = { "If-None-Match", "If-Modified-Since" };
+  const char *values[2] = { validators ? validators->etag : NULL,
+                            validators ? validators->lastModified : NULL };
+  for (int i = 0; i < 2; i++) {
+    if (!values[i] || !values[i][0]) continue;
+    char line[512];
+    snprintf(line, sizeof(line), "%s: %s", names[i], values[i]);
+    struct curl_slist *list = curl_slist_append(transfer->conditions, line);
+    if (!list) return 0;
+    transfer->conditions = list;
+  }
+  return 1;
+}
+
+static int startTransfer(FeedFetcher *fetcher, Transfer *transfer, const char *url, int index,
+                         const FeedValidators *validators) {
+  if (!initByteBuffer(&transfer->buffer, 0)) return 0;
+  transfer->sized = 0;
+  transfer->index = index;
+  transfer->start = nowSeconds();
+  curl_easy_setopt(transfer->curl, CURLOPT_URL, url);
+  int ok = addConditions(transfer, validators);
+  curl_easy_setopt(transfer->curl, CURLOPT_HTTPHEADER, transfer->conditions);
+  if (!ok || curl_multi_add_handle(fetcher->multi, transfer->curl) != CURLM_OK) {
+    clearTransfer(transfer);
+    return 0;
+  }
+  return 1;
+}
+
+/* Hands a finished transfer to the queue and frees its slot. */
+static int finishTransfer(FeedFetcher *fetcher, Transfer *transfer, CURLcode error,
+                          const char *const *urls, FeedQueue *queue) {
+  curl_multi_remove_handle(fetcher->multi, transfer->curl);
+  FeedResult *result = malloc(sizeof(FeedResult));
+  if (!result) {
+    clearTransfer(transfer);
+    return 0;
+  }
+  long status = 0, connects = 0;
+  curl_easy_getinfo(transfer->curl, CURLINFO_RESPONSE_CODE, &status);
+  curl_easy_getinfo(transfer->curl, CURLINFO_NUM_CONNECTS, &connects);
+  fetcher->connections += connects;
+  result->index = transfer->index;
+  result->url = urls[transfer->index];
+  result->error = error;
+  result->status = status;
+  result->seconds = nowSeconds() - transfer->start;
+  result->body = byteBufferRelease(&transfer->buffer, &result->len);
+  result->etag = transfer->etag;
+  result->lastModified = transfer->lastModified;
+  transfer->etag = transfer->lastModified = NULL;
+  clearTransfer(transfer);
+  feedQueuePush(queue, result);
+  return 1;
+}
+
+int fetchFeeds(FeedFetcher *fetcher, const char *const *urls, int n, FeedQueue *queue) {
+  return fetchFeedsConditional(fetcher, urls, NULL, n, queue);
+}
+
+int fetchFeedsConditional(FeedFetcher *fetcher, const char *const *urls,
+                          const FeedValidators *validators, int n, FeedQueue *queue) {
+  int next = 0, active = 0, succeeded = 0, ok = 1;
+  while (ok && (next < n || active > 0)) {
+    for (int i = 0; next < n && i < fetcher->maxParallel; i++) {
+      if (fetcher->transfers[i].index >= 0) continue;
+      if (!startTransfer(fetcher, &fetcher->transfers[i], urls[next], next,
+                         validators ? &validators[next] : NULL)) {
+        ok = 0;
+        break;
+      }
+      next++;
+      active++;
+    }
+    if (!ok) break;
+
+    int running = 0;
+    curl_multi_perform(fetcher->multi, &running);
+    int finished = 0, left = 0;
+    CURLMsg *msg;
+    while ((msg = curl_multi_info_read(fetcher->multi, &left)) != NULL) {
+      if (msg->msg != CURLMSG_DONE) continue;
+      Transfer *transfer = NULL;
+      curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&transfer);
+      CURLcode error = msg->data.result;
+      succeeded += error == CURLE_OK;
+      /* msg is invalid once its handle is removed */
+      if (!finishTransfer(fetcher, transfer, error, urls, queue)) ok = 0;
+      active--;
+      finished++;
+    }
+    if (!finished && active > 0) curl_multi_poll(fetcher->multi, NULL, 0, 1000, NULL);
+  }
+
+  if (!ok) {
+    /* abandon what is still in flight */
+    for (int i = 0; i < fetcher->maxParallel; i++) {
+      Transfer *transfer = &fetcher->transfers[i];
+      if (transfer->index < 0) continue;
+      curl_multi_remove_handle(fetcher->multi, transfer->curl);
+      clearTransfer(transfer);
+    }
+    return -1;
+  }
+  return succeeded;
+}
+
+static void *runFetchJob(void *arg) {
+  FeedFetchJob *job = arg;
+  job->succeeded = fetchFeedsConditional(job->fetcher, job->urls, job->validators, job->n,
+                                         job->queue);
+  feedQueueClose(job->queue);
+  return NULL;
+}
+
+int startFeedFetchJob(FeedFetchJob *job) {
+  job->succeeded = -1;
+  return pthread_create(&job->thread, NULL, runFetchJob, job) == 0;
+}
+
+int joinFeedFetchJob(FeedFetchJob *job) {
+  pthread_join(job->thread, NULL);
+  return job->succeeded;
+}
+
+void freeFeedFetcher(FeedFetcher *fetcher) {
+  for (int i = 0; fetcher->transfers && i < fetcher->maxParallel; i++) {
+    if (fetcher->transfers[i].curl) curl_easy_cleanup(fetcher->transfers[i].curl);
+  }
+  free(fetcher->transfers);
+  if (fetcher->multi) curl_multi_cleanup(fetcher->multi);
+  memset(fetcher, 0, sizeof(*fetcher));
+}
@@ -0,0 +1,161 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Concurrent feed fetcher
+ *
+ * Description:
+ * Downloads many feeds at once with a cURL multi handle.  Up to
+ * maxParallel transfers run together and the fetcher keeps its
+ * connections open between transfers and between calls, so polling the
+ * same hosts again reuses them.  Each download is pushed onto a
+ * FeedQueue as soon as it finishes, so a parser thread can start on the
+ * first feed while the rest are still downloading.
+ *
+ * Given the validators a feed's last response carried (its ETag and
+ * Last-Modified), a fetch is conditional: an unchanged feed comes back
+ * as a 304 with an empty body.
+ *
+ * NOTE: a fetcher is used by one thread at a time; the queue may be
+ * shared by any number of producers and consumers.
+ */
+
+#ifndef FEED_FETCHER_H
+#define FEED_FETCHER_H
+
+#include <stddef.h>
+#include <pthread.h>
+#include <curl/curl.h>
+
+/**
+ * One finished download.
+ */
+typedef struct FeedResult {
+  int index;                /* position of the url in the request */
+  const char *url;          /* the caller's url (not copied) */
+  CURLcode error;           /* CURLE_OK if the transfer completed */
+  long status;              /* HTTP status, 0 without a response */
+  char *body;               /* NUL-terminated response body (malloc'd) */
+  size_t len;               /* bytes in body */
+  char *etag;               /* the response's ETag, or NULL (malloc'd) */
+  char *lastModified;       /* its Last-Modified, or NULL (malloc'd) */
+  double seconds;           /* time the transfer took */
+  struct FeedResult *next;  /* queue link */
+} FeedResult;
+
+/**
+ * A thread-safe FIFO of finished downloads.
+ */
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t ready;
+  FeedResult *head;
+  FeedResult *tail;
+  int closed;
+} FeedQueue;
+
+/**
+ * What a conditional fetch of one url sends: the ETag and Last-Modified
+ * of the copy the caller has (either may be NULL or "").
+ */
+typedef struct {
+  const char *etag;
+  const char *lastModified;
+} FeedValidators;
+
+typedef struct Transfer Transfer;
+
+typedef struct {
+  CURLM *multi;
+  Transfer *transfers;      /* one reusable easy handle per parallel slot */
+  int maxParallel;
+  long connections;         /* connections opened so far */
+} FeedFetcher;
+
+/**
+ * A fetchFeeds call running on its own thread (see startFeedFetchJob).
+ */
+typedef struct {
+  FeedFetcher *fetcher;
+  const char *const *urls;
+  int n;
+  FeedQueue *queue;
+  const FeedValidators *validators;  /* one per url, or NULL */
+  int succeeded;            /* fetchFeeds' result, once joined */
+  pthread_t thread;
+} FeedFetchJob;
+
+/**
+ * Initializes an empty, open queue.  Returns 0 on failure.
+ */
+int initFeedQueue(FeedQueue *queue);
+
+/**
+ * Appends a result and wakes a waiting consumer.
+ */
+void feedQueuePush(FeedQueue *queue, FeedResult *result);
+
+/**
+ * Removes the oldest result, waiting for one if the queue is empty.
+ * Returns <code>NULL</code> once the queue is closed and empty.
+ */
+FeedResult *feedQueuePop(FeedQueue *queue);
+
+/**
+ * Marks the queue closed: consumers drain it and then get
+ * <code>NULL</code>.
+ */
+void feedQueueClose(FeedQueue *queue);
+
+/**
+ * Frees the queue and any results still in it.
+ */
+void freeFeedQueue(FeedQueue *queue);
+
+/**
+ * Frees a result taken from a queue.
+ */
+void freeFeedResult(FeedResult *result);
+
+/**
+ * Initializes a fetcher that runs up to <code>maxParallel</code>
+ * transfers at once.  Returns 1 on success or 0 on failure.
+ */
+int initFeedFetcher(FeedFetcher *fetcher, int maxParallel);
+
+/**
+ * Downloads the n urls and pushes one result per url onto the queue (in
+ * completion order, failures included).  Returns once every transfer
+ * has finished; the queue is left open.  Returns the number of
+ * transfers that got a response, or -1 if the fetcher failed.
+ */
+int fetchFeeds(FeedFetcher *fetcher, const char *const *urls, int n, FeedQueue *queue);
+
+/**
+ * Like fetchFeeds, but each request carries If-None-Match and
+ * If-Modified-Since from the url's validators (<code>validators</code>
+ * may be NULL for unconditional fetches).  A feed that has not changed
+ * gives a result with status 304 and an empty body.
+ */
+int fetchFeedsConditional(FeedFetcher *fetcher, const char *const *urls,
+                          const FeedValidators *validators, int n, FeedQueue *queue);
+
+/**
+ * Runs fetchFeedsConditional for the job on a new thread, which closes the job's
+ * queue when every transfer has finished, so the caller can consume
+ * results as they arrive until feedQueuePop returns <code>NULL</code>.
+ * Returns 0 (closing nothing) if the thread could not be started.
+ */
+int startFeedFetchJob(FeedFetchJob *job);
+
+/**
+ * Waits for the job's thread and returns fetchFeedsConditional's result.
+ */
+int joinFeedFetchJob(FeedFetchJob *job);
+
+/**
+ * Closes the fetcher's connections and frees it.
+ */
+void freeFeedFetcher(FeedFetcher *fetcher);
+
+#endif /* FEED_FETCHER_H */
@@ -0,0 +1,645 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Full-text index of feed items
+ *
+ * Description:
+ * Implements the tokenizer, posting lists, queries and snapshots
+ * declared in feed_index.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "feed_index.h"
+#include "rss_stream.h"
+
+#define INDEX_MAGIC "RSSINDEX"
+#define BYTE_ORDER_MARK 0x01020304u
+
+/* Limits that a sane snapshot stays far below. */
+#define MAX_FIELD_BYTES (1u << 24)
+#define MAX_TERM_TEXT ((uint64_t)1 << 31)
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t docs;
+  uint32_t terms;
+  uint64_t termTextLen;
+} IndexHeader;
+
+/* Before each document's title, link, date and description. */
+typedef struct {
+  int64_t time;
+  uint32_t lens[4];
+} DocHeader;
+
+/* Before each term's postings. */
+typedef struct {
+  uint32_t text;
+  uint32_t length;
+  uint32_t docs;
+  uint32_t lastDoc;
+  uint32_t postingBytes;
+} TermHeader;
+
+static int isTermByte(unsigned char c) {
+  return c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+int forEachFeedTerm(const char *text, int (*onTerm)(const char *term, size_t len, void *context),
+                    void *context) {
+  const unsigned char *at = (const unsigned char *)(text ? text : "");
+  char term[FEED_INDEX_MAX_TERM];
+  while (*at) {
+    unsigned char next = at[1] | 0x20;
+    if (*at == '<' && ((next >= 'a' && next <= 'z') || at[1] == '/' || at[1] == '!')) {
+      /* an HTML tag: none of its names or attributes are terms */
+      const unsigned char *close = (const unsigned char *)strchr((const char *)at, '>');
+      if (close) {
+        at = close + 1;
+        continue;
+      }
+    }
+    if (*at == '&') {
+      /* an HTML entity such as &amp; or &#8217; */
+      size_t len = 1;
+      while (len < 10 && (isTermByte(at[len]) || at[len] == '#')) len++;
+      if (len > 1 && at[len] == ';') {
+        at += len + 1;
+        continue;
+      }
+    }
+    if (!isTermByte(*at)) {
+      at++;
+      continue;
+    }
+    size_t len = 0;
+    for (; isTermByte(*at); at++) {
+      if (len < FEED_INDEX_MAX_TERM) term[len++] = *at >= 'A' && *at <= 'Z' ? *at + 32 : *at;
+    }
+    if (!onTerm(term, len, context)) return 0;
+  }
+  return 1;
+}
+
+static uint32_t hashTerm(const char *term, size_t len) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; i++) hash = (hash ^ (unsigned char)term[i]) * 16777619u;
+  return hash;
+}
+
+/* Returns the number of the term, or -1 if the index does not have it. */
+static int findTerm(const FeedIndex *index, const char *term, size_t len) {
+  if (index->tableCapacity == 0) return -1;
+  size_t mask = index->tableCapacity - 1;
+  for (size_t at = hashTerm(term, len) & mask; index->table[at]; at = (at + 1) & mask) {
+    const FeedTerm *t = &index->terms[index->table[at] - 1];
+    if (t->length == len && memcmp(index->termText + t->text, term, len) == 0) {
+      return index->table[at] - 1;
+    }
+  }
+  return -1;
+}
+
+static void placeTerm(FeedIndex *index, int number) {
+  const FeedTerm *t = &index->terms[number];
+  size_t mask = index->tableCapacity - 1;
+  size_t at = hashTerm(index->termText + t->text, t->length) & mask;
+  while (index->table[at]) at = (at + 1) & mask;
+  index->table[at] = number + 1;
+}
+
+/* Keeps the table at most half full.  Returns 0 if out of memory. */
+static int growTable(FeedIndex *index) {
+  if ((size_t)(index->numTerms + 1) * 2 <= index->tableCapacity) return 1;
+  size_t capacity = index->tableCapacity ? index->tableCapacity * 2 : 1024;
+  int *table = calloc(capacity, sizeof(int));
+  if (!table) return 0;
+  free(index->table);
+  index->table = table;
+  index->tableCapacity = capacity;
+  for (int i = 0; i < index->numTerms; i++) placeTerm(index, i);
+  return 1;
+}
+
+/* Adds a term with an empty posting list.  Returns its number or -1. */
+static int addTerm(FeedIndex *index, const char *term, size_t len) {
+  if (!growTable(index)) return -1;
+  if (index->numTerms == index->termCapacity) {
+    int capacity = index->termCapacity ? index->termCapacity * 2 : 1024;
+    FeedTerm *terms = realloc(index->terms, sizeof(FeedTerm) * capacity);
+    if (!terms) return -1;
+    index->terms = terms;
+    index->termCapacity = capacity;
+  }
+  if (index->termTextLen + len > index->termTextCapacity) {
+    size_t capacity = index->termTextCapacity ? index->termTextCapacity * 2 : 16384;
+    if (capacity > MAX_TERM_TEXT) return -1;
+    char *text = realloc(index->termText, capacity);
+    if (!text) return -1;
+    index->termText = text;
+    index->termTextCapacity = capacity;
+  }
+  FeedTerm *t = &index->terms[index->numTerms];
+  memset(t, 0, sizeof(*t));
+  t->text = (uint32_t)index->termTextLen;
+  t->length = (uint32_t)len;
+  memcpy(index->termText + index->termTextLen, term, len);
+  index->termTextLen += len;
+  placeTerm(index, index->numTerms);
+  return index->numTerms++;
+}
+
+void initFeedIndex(FeedIndex *index) {
+  memset(index, 0, sizeof(*index));
+  initRssFeed(&index->items);
+}
+
+/* Makes room for one more varint in the term's posting list. */
+static int reservePosting(FeedTerm *t) {
+  if (t->postingBytes + 5 <= t->postingCapacity) return 1;
+  uint32_t capacity = t->postingCapacity ? t->postingCapacity * 2 : 8;
+  uint8_t *postings = realloc(t->postings, capacity);
+  if (!postings) return 0;
+  t->postings = postings;
+  t->postingCapacity = capacity;
+  return 1;
+}
+
+static void appendVarint(FeedTerm *t, uint32_t value) {
+  while (value >= 0x80) {
+    t->postings[t->postingBytes++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  t->postings[t->postingBytes++] = (uint8_t)value;
+}
+
+static int compareInts(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+/* The item's terms, gathered before anything is written. */
+typedef struct {
+  FeedIndex *index;
+  int count;
+  int failed;
+} Pending;
+
+static int pendTerm(const char *term, size_t len, void *context) {
+  Pending *pending = context;
+  FeedIndex *index = pending->index;
+  int number = findTerm(index, term, len);
+  if (number < 0) number = addTerm(index, term, len);
+  if (number >= 0 && pending->count == index->pendingCapacity) {
+    int capacity = index->pendingCapacity ? index->pendingCapacity * 2 : 256;
+    int *terms = realloc(index->pending, sizeof(int) * capacity);
+    if (terms) {
+      index->pending = terms;
+      index->pendingCapacity = capacity;
+    } else {
+      number = -1;
+    }
+  }
+  if (number < 0) {
+    pending->failed = 1;
+    return 0;
+  }
+  index->pending[pending->count++] = number;
+  return 1;
+}
+
+int feedIndexAdd(FeedIndex *index, const Rss *item) {
+  if (index->items.count == index->timeCapacity) {
+    int capacity = index->timeCapacity ? index->timeCapacity * 2 : 64;
+    long long *times = realloc(index->times, sizeof(long long) * capacity);
+    if (!times) return -1;
+    index->times = times;
+    index->timeCapacity = capacity;
+  }
+  /* new terms may be added below even on failure; they have no documents */
+  Pending pending = { index, 0, 0 };
+  forEachFeedTerm(item->title, pendTerm, &pending);
+  if (!pending.failed) forEachFeedTerm(item->description, pendTerm, &pending);
+  if (pending.failed) return -1;
+  qsort(index->pending, pending.count, sizeof(int), compareInts);
+  int unique = 0;
+  for (int i = 0; i < pending.count; i++) {
+    if (unique == 0 || index->pending[unique - 1] != index->pending[i]) {
+      index->pending[unique++] = index->pending[i];
+    }
+  }
+  for (int i = 0; i < unique; i++) {
+    if (!reservePosting(&index->terms[index->pending[i]])) return -1;
+  }
+
+  int doc = index->items.count;
+  if (!rssFeedAppend(&index->items, item)) return -1;
+  index->times[doc] = parseRssDate(item->date);
+  for (int i = 0; i < unique; i++) {
+    FeedTerm *t = &index->terms[index->pending[i]];
+    appendVarint(t, t->docs ? (uint32_t)doc - t->lastDoc : (uint32_t)doc);
+    t->lastDoc = (uint32_t)doc;
+    t->docs++;
+  }
+  return doc;
+}
+
+typedef struct {
+  FeedIndex *index;
+  int failed;
+} Indexing;
+
+static int indexItem(const Rss *item, void *context) {
+  Indexing *indexing = context;
+  if (feedIndexAdd(indexing->index, item) >= 0) return 1;
+  indexing->failed = 1;
+  return 0;
+}
+
+int indexFeedXml(FeedIndex *index, const char *xml, size_t len) {
+  Indexing indexing = { index, 0 };
+  int count = streamRssItems(xml, len, indexItem, &indexing);
+  return indexing.failed ? -1 : count;
+}
+
+const Rss *feedIndexItem(const FeedIndex *index, int doc) {
+  return &index->items.items[doc];
+}
+
+/* Reads a posting list one document at a time. */
+typedef struct {
+  const uint8_t *at;
+  const uint8_t *end;
+  uint32_t left;          /* documents not read yet */
+  uint32_t doc;           /* the current one */
+} Cursor;
+
+static void openCursor(Cursor *cursor, const FeedTerm *t) {
+  cursor->at = t->postings;
+  cursor->end = t->postings + t->postingBytes;
+  cursor->left = t->docs;
+  cursor->doc = 0;
+}
+
+/* Moves to the next document.  Returns 0 at the end (or on a bad varint). */
+static int cursorNext(Cursor *cursor, int first) {
+  if (cursor->left == 0) return 0;
+  uint32_t value = 0;
+  int shift = 0;
+  for (;;) {
+    if (cursor->at == cursor->end || shift > 28) return 0;
+    uint8_t byte = *cursor->at++;
+    value |= (uint32_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) break;
+    shift += 7;
+  }
+  cursor->doc = first ? value : cursor->doc + value;
+  cursor->left--;
+  return 1;
+}
+
+/* The k newest matches so far, oldest on top. */
+typedef struct {
+  const long long *times;
+  int *heap;
+  int size;
+  int k;
+  int matches;
+} TopK;
+
+/* Whether document a ranks below (is older than) b. */
+static int older(const TopK *top, int a, int b) {
+  long long ta = top->times[a], tb = top->times[b];
+  return ta < tb || (ta == tb && a > b);
+}
+
+static void siftDown(TopK *top, int at) {
+  for (;;) {
+    int child = 2 * at + 1;
+    if (child >= top->size) break;
+    if (child + 1 < top->size && older(top, top->heap[child + 1], top->heap[child])) child++;
+    if (!older(top, top->heap[child], top->heap[at])) break;
+    int swap = top->heap[at];
+    top->heap[at] = top->heap[child];
+    top->heap[child] = swap;
+    at = child;
+  }
+}
+
+static void offer(TopK *top, int doc) {
+  top->matches++;
+  if (top->k == 0) return;
+  if (top->size < top->k) {
+    int at = top->size++;
+    top->heap[at] = doc;
+    while (at > 0 && older(top, top->heap[at], top->heap[(at - 1) / 2])) {
+      int parent = (at - 1) / 2;
+      int swap = top->heap[at];
+      top->heap[at] = top->heap[parent];
+      top->heap[parent] = swap;
+      at = parent;
+    }
+  } else if (older(top, top->heap[0], doc)) {
+    top->heap[0] = doc;
+    siftDown(top, 0);
+  }
+}
+
+/* The distinct terms of a query, -1 for a term the index lacks. */
+typedef struct {
+  const FeedIndex *index;
+  int *terms;
+  int count;
+  int capacity;
+  int missing;
+} QueryTerms;
+
+static int addQueryTerm(const char *term, size_t len, void *context) {
+  QueryTerms *query = context;
+  int number = findTerm(query->index, term, len);
+  if (number < 0 || query->index->terms[number].docs == 0) {
+    query->missing++;
+    return 1;
+  }
+  for (int i = 0; i < query->count; i++) {
+    if (query->terms[i] == number) return 1;
+  }
+  if (query->count == query->capacity) {
+    int capacity = query->capacity ? query->capacity * 2 : 8;
+    int *terms = realloc(query->terms, sizeof(int) * capacity);
+    if (!terms) return 0;
+    query->terms = terms;
+    query->capacity = capacity;
+  }
+  query->terms[query->count++] = number;
+  return 1;
+}
+
+/* Orders the query's terms rarest first (queries have few terms). */
+static void sortByDocs(const FeedIndex *index, int *terms, int n) {
+  for (int i = 1; i < n; i++) {
+    int term = terms[i], j = i;
+    for (; j > 0 && index->terms[terms[j - 1]].docs > index->terms[term].docs; j--) {
+      terms[j] = terms[j - 1];
+    }
+    terms[j] = term;
+  }
+}
+
+/* AND: walks the rarest list and skips the others forward to it. */
+static void matchAll(const FeedIndex *index, const int *terms, int n, Cursor *cursors, TopK *top) {
+  for (int i = 0; i < n; i++) {
+    openCursor(&cursors[i], &index->terms[terms[i]]);
+    if (!cursorNext(&cursors[i], 1)) return;
+  }
+  for (;;) {
+    uint32_t doc = cursors[0].doc;
+    int agree = 1;
+    for (int i = 1; i < n && agree; i++) {
+      while (cursors[i].doc < doc) {
+        if (!cursorNext(&cursors[i], 0)) return;
+      }
+      if (cursors[i].doc > doc) {
+        agree = 0;
+        /* nothing before cursors[i].doc can match */
+        while (cursors[0].doc < cursors[i].doc) {
+          if (!cursorNext(&cursors[0], 0)) return;
+        }
+      }
+    }
+    if (agree) {
+      offer(top, (int)doc);
+      if (!cursorNext(&cursors[0], 0)) return;
+    }
+  }
+}
+
+/* OR: marks every listed document in a bitmap, then visits it in order. */
+static int matchAny(const FeedIndex *index, const int *terms, int n, TopK *top) {
+  size_t words = (index->items.count + 63) / 64;
+  uint64_t *marks = calloc(words ? words : 1, sizeof(uint64_t));
+  if (!marks) return 0;
+  for (int i = 0; i < n; i++) {
+    Cursor cursor;
+    openCursor(&cursor, &index->terms[terms[i]]);
+    for (int first = 1; cursorNext(&cursor, first); first = 0) {
+      if (cursor.doc < (uint32_t)index->items.count) {
+        marks[cursor.doc / 64] |= 1ull << (cursor.doc % 64);
+      }
+    }
+  }
+  for (size_t w = 0; w < words; w++) {
+    for (uint64_t bits = marks[w]; bits; bits &= bits - 1) {
+      offer(top, (int)(w * 64 + __builtin_ctzll(bits)));
+    }
+  }
+  free(marks);
+  return 1;
+}
+
+int searchFeedIndex(const FeedIndex *index, const char *query, FeedQueryMode mode, int k,
+                    int *docs, int *matches) {
+  if (matches) *matches = 0;
+  if (k < 0) k = 0;
+  QueryTerms terms = { index, NULL, 0, 0, 0 };
+  if (!forEachFeedTerm(query, addQueryTerm, &terms)) {
+    free(terms.terms);
+    return -1;
+  }
+  TopK top = { index->times, docs, 0, k, 0 };
+  int ok = 1;
+  if (terms.count > 0 && (mode == FEED_QUERY_ANY || terms.missing == 0)) {
+    if (mode == FEED_QUERY_ANY) {
+      ok = matchAny(index, terms.terms, terms.count, &top);
+    } else {
+      Cursor *cursors = malloc(sizeof(Cursor) * terms.count);
+      ok = cursors != NULL;
+      if (ok) {
+        sortByDocs(index, terms.terms, terms.count);
+        matchAll(index, terms.terms, terms.count, cursors, &top);
+      }
+      free(cursors);
+    }
+  }
+  free(terms.terms);
+  if (!ok) return -1;
+
+  /* pop the oldest to the back: the heap array ends up newest first */
+  int found = top.size;
+  while (top.size > 1) {
+    int oldest = top.heap[0];
+    top.heap[0] = top.heap[--top.size];
+    top.heap[top.size] = oldest;
+    siftDown(&top, 0);
+  }
+  if (matches) *matches = top.matches;
+  return found;
+}
+
+static int writeIndex(const FeedIndex *index, FILE *out) {
+  IndexHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+  header.version = FEED_INDEX_VERSION;
+  header.byteOrder = BYTE_ORDER_MARK;
+  header.docs = index->items.count;
+  header.terms = index->numTerms;
+  header.termTextLen = index->termTextLen;
+  int ok = fwrite(&header, sizeof(header), 1, out) == 1;
+  for (int d = 0; ok && d < index->items.count; d++) {
+    const Rss *item = &index->items.items[d];
+    const char *fields[4] = { item->title, item->link, item->date, item->description };
+    DocHeader doc;
+    doc.time = index->times[d];
+    for (int f = 0; f < 4; f++) {
+      size_t len = strlen(fields[f]);
+      if (len > MAX_FIELD_BYTES) return 0;
+      doc.lens[f] = (uint32_t)len;
+    }
+    ok = fwrite(&doc, sizeof(doc), 1, out) == 1;
+    for (int f = 0; ok && f < 4; f++) ok = fwrite(fields[f], 1, doc.lens[f], out) == doc.lens[f];
+  }
+  ok = ok && fwrite(index->termText, 1, index->termTextLen, out) == index->termTextLen;
+  for (int i = 0; ok && i < index->numTerms; i++) {
+    const FeedTerm *t = &index->terms[i];
+    TermHeader term = { t->text, t->length, t->docs, t->lastDoc, t->postingBytes };
+    ok = fwrite(&term, sizeof(term), 1, out) == 1 &&
+         fwrite(t->postings, 1, t->postingBytes, out) == t->postingBytes;
+  }
+  return ok;
+}
+
+int saveFeedIndex(const FeedIndex *index, const char *path) {
+  size_t tmpLen = strlen(path) + 5;
+  char *tmpPath = malloc(tmpLen);
+  if (!tmpPath) return 0;
+  snprintf(tmpPath, tmpLen, "%s.tmp", path);
+  FILE *out = fopen(tmpPath, "wb");
+  int ok = out && writeIndex(index, out);
+  if (out && fclose(out) != 0) ok = 0;
+  if (ok) ok = rename(tmpPath, path) == 0;
+  if (!ok && out) remove(tmpPath);
+  free(tmpPath);
+  return ok;
+}
+
+/* Reads the documents of a snapshot. */
+static int readDocs(FeedIndex *index, FILE *in, uint32_t docs) {
+  index->times = malloc(sizeof(long long) * (docs ? docs : 1));
+  if (!index->times) return 0;
+  index->timeCapacity = docs ? docs : 1;
+  int ok = 1;
+  char *fields[4] = { NULL, NULL, NULL, NULL };
+  size_t sizes[4] = { 0, 0, 0, 0 };
+  for (uint32_t d = 0; ok && d < docs; d++) {
+    DocHeader doc;
+    ok = fread(&doc, sizeof(doc), 1, in) == 1;
+    for (int f = 0; ok && f < 4; f++) {
+      if (doc.lens[f] > MAX_FIELD_BYTES) {
+        ok = 0;
+      } else if (doc.lens[f] + 1 > sizes[f]) {
+        char *grown = realloc(fields[f], doc.lens[f] + 1);
+        ok = grown != NULL;
+        if (ok) {
+          fields[f] = grown;
+          sizes[f] = doc.lens[f] + 1;
+        }
+      }
+      ok = ok && fread(fields[f], 1, doc.lens[f], in) == doc.lens[f] &&
+           !memchr(fields[f], '\0', doc.lens[f]);
+      if (ok) fields[f][doc.lens[f]] = '\0';
+    }
+    if (ok) {
+      Rss item = { fields[0], fields[1], fields[2], fields[3] };
+      ok = rssFeedAppend(&index->items, &item);
+      index->times[d] = doc.time;
+    }
+  }
+  for (int f = 0; f < 4; f++) free(fields[f]);
+  return ok;
+}
+
+/* Checks that a posting list holds docs increasing documents below limit. */
+static int validPostings(const FeedTerm *t, uint32_t limit) {
+  Cursor cursor;
+  openCursor(&cursor, t);
+  uint32_t last = 0;
+  for (uint32_t i = 0; i < t->docs; i++) {
+    if (!cursorNext(&cursor, i == 0) || cursor.doc >= limit || (i > 0 && cursor.doc <= last)) {
+      return 0;
+    }
+    last = cursor.doc;
+  }
+  return cursor.at == cursor.end && (t->docs == 0 || last == t->lastDoc);
+}
+
+static int readTerms(FeedIndex *index, FILE *in, uint32_t terms, uint64_t termTextLen) {
+  if (termTextLen > MAX_TERM_TEXT) return 0;
+  index->termText = malloc(termTextLen ? termTextLen : 1);
+  if (!index->termText) return 0;
+  index->termTextCapacity = termTextLen ? termTextLen : 1;
+  index->termTextLen = termTextLen;
+  if (fread(index->termText, 1, termTextLen, in) != termTextLen) return 0;
+  index->terms = malloc(sizeof(FeedTerm) * (terms ? terms : 1));
+  if (!index->terms) return 0;
+  index->termCapacity = terms ? terms : 1;
+  for (uint32_t i = 0; i < terms; i++) {
+    TermHeader header;
+    if (fread(&header, sizeof(header), 1, in) != 1 || header.length == 0 ||
+        header.length > FEED_INDEX_MAX_TERM || header.text > termTextLen ||
+        header.length > termTextLen - header.text || header.postingBytes > 5 * (uint64_t)header.docs ||
+        findTerm(index, index->termText + header.text, header.length) >= 0 || !growTable(index)) {
+      return 0;
+    }
+    FeedTerm *t = &index->terms[index->numTerms];
+    t->text = header.text;
+    t->length = header.length;
+    t->docs = header.docs;
+    t->lastDoc = header.lastDoc;
+    t->postingBytes = t->postingCapacity = header.postingBytes;
+    t->postings = malloc(header.postingBytes ? header.postingBytes : 1);
+    if (!t->postings) return 0;
+    if (header.postingBytes == 0) t->postingCapacity = 1;
+    placeTerm(index, index->numTerms++);
+    if (fread(t->postings, 1, header.postingBytes, in) != header.postingBytes ||
+        !validPostings(t, (uint32_t)index->items.count)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+int loadFeedIndex(FeedIndex *index, const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return errno == ENOENT;
+  IndexHeader header;
+  int ok = fread(&header, sizeof(header), 1, in) == 1 &&
+           memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == FEED_INDEX_VERSION && header.byteOrder == BYTE_ORDER_MARK &&
+           header.docs <= 0x3fffffff && header.terms <= 0x3fffffff;
+  ok = ok && readDocs(index, in, header.docs) &&
+       readTerms(index, in, header.terms, header.termTextLen);
+  /* nothing may follow the last term */
+  ok = ok && fgetc(in) == EOF && !ferror(in);
+  fclose(in);
+  if (!ok) freeFeedIndex(index);
+  return ok;
+}
+
+void freeFeedIndex(FeedIndex *index) {
+  freeRssFeed(&index->items);
+  for (int i = 0; i < index->numTerms; i++) free(index->terms[i].postings);
+  free(index->terms);
+  free(index->times);
+  free(index->termText);
+  free(index->table);
+  free(index->pending);
+  initFeedIndex(index);
+}
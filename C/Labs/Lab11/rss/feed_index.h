@@ -0,0 +1,134 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Full-text index of feed items
+ *
+ * Description:
+ * An in-memory inverted index over feed items, filled as items are
+ * parsed.  Each item is kept (in an RssFeed) under a document number
+ * given in the order added.  Its title and description are split into
+ * terms, and each term keeps a posting list of the documents holding it:
+ * the gaps between increasing document numbers, as LEB128 varints, so a
+ * common term costs about a byte per document.  Queries match all (AND)
+ * or any (OR) of their terms and return the k newest matching items by
+ * date.  The whole index can be saved to and loaded from a binary
+ * snapshot, so a restart does not tokenize anything again.
+ *
+ * NOTE: a term is a run of ASCII letters and digits (lowercased) or of
+ * non-ASCII UTF-8 bytes, cut to FEED_INDEX_MAX_TERM bytes.  HTML tags
+ * and entities in descriptions are skipped.  Snapshots are specific to
+ * the machine's byte order and are rejected (not converted) elsewhere.
+ */
+
+#ifndef FEED_INDEX_H
+#define FEED_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rss.h"
+#include "rss_feed.h"
+
+/* Bumped whenever the snapshot layout changes; other versions are ignored. */
+#define FEED_INDEX_VERSION 1
+
+/* Longest term kept; longer words are indexed (and looked up) by their prefix. */
+#define FEED_INDEX_MAX_TERM 32
+
+typedef enum {
+  FEED_QUERY_ALL,   /* every term must match */
+  FEED_QUERY_ANY    /* at least one term must match */
+} FeedQueryMode;
+
+typedef struct {
+  uint32_t text;          /* offset of the term in the index's termText */
+  uint32_t length;
+  uint32_t docs;          /* documents in the posting list */
+  uint32_t lastDoc;       /* the last of them, the base of the next gap */
+  uint8_t *postings;      /* the first document, then the gaps, as varints */
+  uint32_t postingBytes;
+  uint32_t postingCapacity;
+} FeedTerm;
+
+typedef struct {
+  RssFeed items;          /* document i is items.items[i] */
+  long long *times;       /* parseRssDate of each item's date */
+  int timeCapacity;
+  FeedTerm *terms;
+  int numTerms;
+  int termCapacity;
+  char *termText;         /* the terms' bytes, back to back */
+  size_t termTextLen;
+  size_t termTextCapacity;
+  int *table;             /* open addressing: term number + 1, 0 = free */
+  size_t tableCapacity;   /* 0 or a power of two */
+  int *pending;           /* scratch: the terms of the item being added */
+  int pendingCapacity;
+} FeedIndex;
+
+/**
+ * Initializes an empty index.
+ */
+void initFeedIndex(FeedIndex *index);
+
+/**
+ * Copies the item into the index and adds its title and description
+ * terms.  Returns the item's document number, or -1 (with no item or
+ * posting added) if memory ran out.
+ */
+int feedIndexAdd(FeedIndex *index, const Rss *item);
+
+/**
+ * Streams the items of the given feed text into the index (see
+ * streamRssItems).  Returns the number added, or -1 if the text is not a
+ * well-formed feed or memory ran out (items before the error stay
+ * indexed).
+ */
+int indexFeedXml(FeedIndex *index, const char *xml, size_t len);
+
+/**
+ * Returns the item with the given document number.
+ */
+const Rss *feedIndexItem(const FeedIndex *index, int doc);
+
+/**
+ * Finds the items whose title or description holds all (or any) of the
+ * terms of the query and writes the document numbers of the k newest to
+ * docs, newest first (equal dates in the order added, undated items
+ * last).  If matches is not NULL it gets the number of matching items.
+ * Returns the number written (0 for a query with no terms), or -1 if
+ * memory ran out.
+ */
+int searchFeedIndex(const FeedIndex *index, const char *query, FeedQueryMode mode, int k,
+                    int *docs, int *matches);
+
+/**
+ * Calls onTerm once per term of the text, in order (repeats included),
+ * with the term's bytes (not NUL-terminated) and length, the way the
+ * index splits titles, descriptions and queries.  Stops and returns 0
+ * if onTerm does.
+ */
+int forEachFeedTerm(const char *text, int (*onTerm)(const char *term, size_t len, void *context),
+                    void *context);
+
+/**
+ * Writes the index to a snapshot at path, under a temporary name that is
+ * renamed into place.  Returns 1 on success or 0 on failure.
+ */
+int saveFeedIndex(const FeedIndex *index, const char *path);
+
+/**
+ * Loads the snapshot at path into an empty index.  A missing file leaves
+ * the index empty and counts as success.  Returns 0 (with the index
+ * empty) if the file is unreadable, truncated, corrupt or from another
+ * version or byte order.
+ */
+int loadFeedIndex(FeedIndex *index, const char *path);
+
+/**
+ * Frees the items, terms and postings, leaving the index empty.
+ */
+void freeFeedIndex(FeedIndex *index);
+
+#endif /* FEED_INDEX_H */
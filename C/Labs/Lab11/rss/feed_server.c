@@ -0,0 +1,512 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Loopback feed server
+ *
+ * Description:
+ * Implements the poll-based fixture server declared in feed_server.h.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "feed_server.h"
+
+/* Connections served at once; more wait in the listen backlog. */
+#define MAX_CLIENTS 256
+
+/* Longest request (line and headers) accepted. */
+#define REQUEST_MAX 8192
+
+struct FeedFile {
+  char *name;
+  char *body;
+  size_t len;
+  time_t modified;
+  char etag[32];           /* quoted, as sent */
+  char lastModified[32];   /* an HTTP date */
+};
+
+typedef enum {
+  READING,   /* waiting for a complete request */
+  WAITING,   /* holding the response back until due */
+  WRITING    /* sending the response */
+} ClientState;
+
+typedef struct {
+  int fd;
+  ClientState state;
+  char request[REQUEST_MAX];
+  size_t have;
+  double due;          /* ms, for WAITING */
+  int status;          /* of the response being sent */
+  char header[512];
+  size_t headerLen;
+  const char *body;
+  size_t bodyLen;
+  size_t sent;         /* bytes of header and body sent */
+  int closeAfter;      /* close once the response is out */
+} Client;
+
+static double nowMs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int setNonBlocking(int fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+/* Sets the file's modification time and derives its validators. */
+static void stampFile(FeedFile *file, time_t modified) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < file->len; i++) hash = (hash ^ (unsigned char)file->body[i]) * 16777619u;
+  snprintf(file->etag, sizeof(file->etag), "\"%08x-%zx\"", (unsigned)hash, file->len);
+  struct tm utc;
+  file->modified = modified;
+  gmtime_r(&modified, &utc);
+  strftime(file->lastModified, sizeof(file->lastModified), "%a, %d %b %Y %H:%M:%S GMT", &utc);
+}
+
+static int loadFiles(FeedServer *server, const char *directory) {
+  DIR *dir = opendir(directory);
+  if (!dir) return 0;
+  int capacity = 0, ok = 1;
+  struct dirent *entry;
+  while (ok && (entry = readdir(dir)) != NULL) {
+    char path[4096];
+    struct stat info;
+    snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+    if (stat(path, &info) != 0 || !S_ISREG(info.st_mode)) continue;
+    if (server->numFiles == capacity) {
+      capacity = capacity ? capacity * 2 : 8;
+      FeedFile *files = realloc(server->files, sizeof(FeedFile) * capacity);
+      if (!files) {
+        ok = 0;
+        break;
+      }
+      server->files = files;
+    }
+    FeedFile *file = &server->files[server->numFiles];
+    FILE *in = fopen(path, "rb");
+    file->name = strdup(entry->d_name);
+    file->body = malloc(info.st_size + 1);
+    file->len = in && file->body ? fread(file->body, 1, info.st_size, in) : 0;
+    if (in) fclose(in);
+    if (!file->name || !file->body) {
+      free(file->name);
+      free(file->body);
+      ok = 0;
+      break;
+    }
+    stampFile(file, info.st_mtime);
+    server->numFiles++;
+  }
+  closedir(dir);
+  return ok;
+}
+
+static FeedFile *findFile(FeedServer *server, const char *name, size_t len) {
+  for (int i = 0; i < server->numFiles; i++) {
+    if (strlen(server->files[i].name) == len && memcmp(server->files[i].name, name, len) == 0) {
+      return &server->files[i];
+    }
+  }
+  return NULL;
+}
+
+/*
+ * Case-insensitive search for the header line "name: value" in a
+ * request.  Returns the value (trimmed, its length in *len) or NULL.
+ */
+static const char *headerValue(const char *request, const char *name, size_t *len) {
+  size_t nameLen = strlen(name);
+  for (const char *line = strstr(request, "\r\n"); line; line = strstr(line + 2, "\r\n")) {
+    const char *at = line + 2;
+    if (strncasecmp(at, name, nameLen) != 0 || at[nameLen] != ':') continue;
+    at += nameLen + 1;
+    while (*at == ' ' || *at == '\t') at++;
+    const char *end = strstr(at, "\r\n");
+    while (end > at && (end[-1] == ' ' || end[-1] == '\t')) end--;
+    *len = end - at;
+    return at;
+  }
+  return NULL;
+}
+
+/* Whether a request has a "name: value..." header line. */
+static int hasHeader(const char *request, const char *name, const char *value) {
+  size_t len, valueLen = strlen(value);
+  const char *at = headerValue(request, name, &len);
+  return at && len >= valueLen && strncasecmp(at, value, valueLen) == 0;
+}
+
+/* Whether an If-None-Match list names the etag, weakly or as "*". */
+static int matchesEtag(const char *tags, size_t len, const char *etag) {
+  size_t etagLen = strlen(etag);
+  const char *end = tags + len;
+  while (tags < end) {
+    while (tags < end && (*tags == ' ' || *tags == ',')) tags++;
+    const char *tag = tags;
+    while (tags < end && *tags != ',') tags++;
+    const char *tagEnd = tags;
+    while (tagEnd > tag && tagEnd[-1] == ' ') tagEnd--;
+    if (tagEnd - tag > 2 && strncmp(tag, "W/", 2) == 0) tag += 2;
+    if ((tagEnd - tag == 1 && *tag == '*') ||
+        ((size_t)(tagEnd - tag) == etagLen && memcmp(tag, etag, etagLen) == 0)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Whether a GET of the file may be answered with 304 Not Modified. */
+static int notModified(const char *request, const FeedFile *file) {
+  size_t len;
+  const char *tags = headerValue(request, "If-None-Match", &len);
+  if (tags) return matchesEtag(tags, len, file->etag);
+  const char *since = headerValue(request, "If-Modified-Since", &len);
+  return since && len == strlen(file->lastModified) && memcmp(since, file->lastModified, len) == 0;
+}
+
+/* Builds the response header; a file adds its validators, a 304 has no body. */
+static void respond(Client *client, int status, const char *reason, const char *type,
+                    const char *body, size_t len, const FeedFile *file) {
+  size_t size = sizeof(client->header);
+  int at = snprintf(client->header, size, "HTTP/1.1 %d %s\r\n", status, reason);
+  if (file) {
+    at += snprintf(client->header + at, size - at, "ETag: %s\r\nLast-Modified: %s\r\n",
+                   file->etag, file->lastModified);
+  }
+  if (status != 304) {
+    at += snprintf(client->header + at, size - at, "Content-Type: %s\r\nContent-Length: %zu\r\n",
+                   type, len);
+  }
+  at += snprintf(client->header + at, size - at, "%s\r\n",
+                 client->closeAfter ? "Connection: close\r\n" : "");
+  client->headerLen = at;
+  client->status = status;
+  client->body = body;
+  client->bodyLen = len;
+  client->sent = 0;
+}
+
+/*
+ * Starts the response to the first complete request in the client's
+ * buffer.  Returns 0 if the request is still incomplete.
+ */
+static int takeRequest(FeedServer *server, Client *client) {
+  char *end = NULL;
+  for (size_t i = 3; i < client->have && !end; i++) {
+    if (memcmp(client->request + i - 3, "\r\n\r\n", 4) == 0) end = client->request + i + 1;
+  }
+  if (!end) {
+    if (client->have < REQUEST_MAX) return 0;
+    client->closeAfter = 1;
+    respond(client, 400, "Bad Request", "text/plain", "bad request\n", 12, NULL);
+    client->have = 0;
+    client->state = WRITING;
+    return 1;
+  }
+  char saved = *end;
+  *end = '\0';
+  const char *request = client->request;
+  const char *path = strchr(request, ' ');
+  const char *pathEnd = path ? strpbrk(path + 1, " ?\r") : NULL;
+  client->closeAfter = hasHeader(request, "Connection", "close") ||
+                       (strstr(request, " HTTP/1.0\r\n") && !hasHeader(request, "Connection", "keep-alive"));
+  if (strncmp(request, "GET ", 4) != 0 || !pathEnd || path[1] != '/') {
+    client->closeAfter = 1;
+    respond(client, 405, "Method Not Allowed", "text/plain", "method not allowed\n", 19, NULL);
+  } else {
+    /* a replaced body stays allocated, so the response may outlive the lock */
+    pthread_mutex_lock(&server->filesLock);
+    const FeedFile *file = findFile(server, path + 2, pathEnd - path - 2);
+    if (file && notModified(request, file)) {
+      respond(client, 304, "Not Modified", NULL, NULL, 0, file);
+    } else if (file) {
+      const char *dot = strrchr(file->name, '.');
+      const char *type = dot && strcmp(dot, ".xml") == 0 ? "application/xml" : "text/plain";
+      respond(client, 200, "OK", type, file->body, file->len, file);
+    } else {
+      respond(client, 404, "Not Found", "text/plain", "not found\n", 10, NULL);
+    }
+    pthread_mutex_unlock(&server->filesLock);
+  }
+  *end = saved;
+
+  /* keep any pipelined bytes after the request */
+  size_t used = end - client->request;
+  memmove(client->request, end, client->have - used);
+  client->have -= used;
+  if (server->delayMs > 0) {
+    client->state = WAITING;
+    client->due = nowMs() + server->delayMs;
+  } else {
+    client->state = WRITING;
+  }
+  return 1;
+}
+
+/* Sends what it can of the response.  Returns 0 if the client is done for. */
+static int sendResponse(FeedServer *server, Client *client) {
+  size_t total = client->headerLen + client->bodyLen;
+  while (client->sent < total) {
+    /* header and body in one segment: a lone header would wait on Nagle */
+    struct iovec parts[2];
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = parts;
+    if (client->sent < client->headerLen) {
+      parts[0].iov_base = client->header + client->sent;
+      parts[0].iov_len = client->headerLen - client->sent;
+      parts[1].iov_base = (void *)client->body;
+      parts[1].iov_len = client->bodyLen;
+      message.msg_iovlen = 2;
+    } else {
+      parts[0].iov_base = (void *)(client->body + (client->sent - client->headerLen));
+      parts[0].iov_len = total - client->sent;
+      message.msg_iovlen = 1;
+    }
+    ssize_t sent = sendmsg(client->fd, &message, MSG_NOSIGNAL);
+    if (sent < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+    client->sent += sent;
+  }
+  __atomic_fetch_add(&server->requests, 1, __ATOMIC_RELAXED);
+  if (client->status == 304) __atomic_fetch_add(&server->notModified, 1, __ATOMIC_RELAXED);
+  if (client->closeAfter) return 0;
+  client->state = READING;
+  /* a pipelined request may already be waiting */
+  if (takeRequest(server, client) && client->state == WRITING) return sendResponse(server, client);
+  return 1;
+}
+
+/* Reads what has arrived.  Returns 0 if the client is done for. */
+static int receiveRequest(FeedServer *server, Client *client) {
+  while (client->have < REQUEST_MAX) {
+    ssize_t got = recv(client->fd, client->request + client->have, REQUEST_MAX - client->have, 0);
+    if (got == 0) return 0;
+    if (got < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+      return 0;
+    }
+    client->have += got;
+  }
+  if (takeRequest(server, client) && client->state == WRITING) return sendResponse(server, client);
+  return 1;
+}
+
+static void *serve(void *arg) {
+  FeedServer *server = arg;
+  Client *clients = malloc(sizeof(Client) * MAX_CLIENTS);
+  struct pollfd *fds = malloc(sizeof(struct pollfd) * (MAX_CLIENTS + 2));
+  int *polled = malloc(sizeof(int) * (MAX_CLIENTS + 2));  /* client of each pollfd */
+  int numClients = 0;
+  if (!clients || !fds || !polled) goto done;
+
+  for (;;) {
+    int count = 0, timeout = -1;
+    double now = nowMs();
+    fds[count].fd = server->wakeFds[0];
+    fds[count++].events = POLLIN;
+    if (numClients < MAX_CLIENTS) {
+      fds[count].fd = server->listenFd;
+      fds[count++].events = POLLIN;
+    }
+    for (int c = 0; c < numClients; c++) {
+      if (clients[c].state == WAITING) {
+        int wait = clients[c].due > now ? (int)(clients[c].due - now) + 1 : 0;
+        if (timeout < 0 || wait < timeout) timeout = wait;
+        continue;
+      }
+      fds[count].fd = clients[c].fd;
+      fds[count].events = clients[c].state == READING ? POLLIN : POLLOUT;
+      polled[count++] = c;
+    }
+    if (poll(fds, count, timeout) < 0 && errno != EINTR) break;
+    if (fds[0].revents) break;
+
+    /* mark the clients that polled ready, then serve them and the due ones */
+    int first = numClients < MAX_CLIENTS ? 2 : 1;
+    int marks[MAX_CLIENTS];
+    memset(marks, 0, sizeof(int) * numClients);
+    for (int i = first; i < count; i++) {
+      if (fds[i].revents) marks[polled[i]] = 1;
+    }
+    now = nowMs();
+    for (int c = 0; c < numClients; c++) {
+      Client *client = &clients[c];
+      int alive = 1;
+      if (client->state == WAITING && client->due <= now) {
+        client->state = WRITING;
+        alive = sendResponse(server, client);
+      } else if (marks[c] && client->state == READING) {
+        alive = receiveRequest(server, client);
+      } else if (marks[c] && client->state == WRITING) {
+        alive = sendResponse(server, client);
+      }
+      if (!alive) {
+        close(client->fd);
+        clients[c] = clients[--numClients];
+        marks[c] = marks[numClients];
+        c--;
+      }
+    }
+
+    if (first == 2 && fds[1].revents) {
+      while (numClients < MAX_CLIENTS) {
+        int fd = accept(server->listenFd, NULL, NULL);
+        if (fd < 0) break;
+        if (!setNonBlocking(fd)) {
+          close(fd);
+          continue;
+        }
+        Client *client = &clients[numClients++];
+        client->fd = fd;
+        client->state = READING;
+        client->have = 0;
+        __atomic_fetch_add(&server->connections, 1, __ATOMIC_RELAXED);
+      }
+    }
+  }
+
+done:
+  for (int c = 0; c < numClients; c++) close(clients[c].fd);
+  free(clients);
+  free(fds);
+  free(polled);
+  return NULL;
+}
+
+int startFeedServer(FeedServer *server, const char *directory, int delayMs) {
+  memset(server, 0, sizeof(*server));
+  server->delayMs = delayMs;
+  server->listenFd = server->wakeFds[0] = server->wakeFds[1] = -1;
+  if (pthread_mutex_init(&server->filesLock, NULL) != 0) return 0;
+  if (!loadFiles(server, directory)) goto fail;
+
+  struct sockaddr_in address;
+  socklen_t addressLen = sizeof(address);
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  int reuse = 1;
+  server->listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (server->listenFd < 0 ||
+      setsockopt(server->listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0 ||
+      bind(server->listenFd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+      listen(server->listenFd, 128) != 0 || !setNonBlocking(server->listenFd) ||
+      getsockname(server->listenFd, (struct sockaddr *)&address, &addressLen) != 0) {
+    goto fail;
+  }
+  server->port = ntohs(address.sin_port);
+  if (pipe(server->wakeFds) != 0) {
+    server->wakeFds[0] = server->wakeFds[1] = -1;
+    goto fail;
+  }
+  if (pthread_create(&server->thread, NULL, serve, server) != 0) goto fail;
+  return 1;
+
+fail:
+  if (server->listenFd >= 0) close(server->listenFd);
+  if (server->wakeFds[0] >= 0) close(server->wakeFds[0]);
+  if (server->wakeFds[1] >= 0) close(server->wakeFds[1]);
+  for (int i = 0; i < server->numFiles; i++) {
+    free(server->files[i].name);
+    free(server->files[i].body);
+  }
+  free(server->files);
+  pthread_mutex_destroy(&server->filesLock);
+  memset(server, 0, sizeof(*server));
+  return 0;
+}
+
+long feedServerConnections(FeedServer *server) {
+  return __atomic_load_n(&server->connections, __ATOMIC_RELAXED);
+}
+
+long feedServerRequests(FeedServer *server) {
+  return __atomic_load_n(&server->requests, __ATOMIC_RELAXED);
+}
+
+long feedServerNotModified(FeedServer *server) {
+  return __atomic_load_n(&server->notModified, __ATOMIC_RELAXED);
+}
+
+int feedServerSetFile(FeedServer *server, const char *name, const char *body, size_t len) {
+  char *copy = malloc(len + 1);
+  if (!copy) return 0;
+  memcpy(copy, body, len);
+  copy[len] = '\0';
+  int ok = 0;
+  pthread_mutex_lock(&server->filesLock);
+  FeedFile *file = findFile(server, name, strlen(name));
+  if (file) {
+    /* the old body may be in flight; keep it until the server stops */
+    char **retired = realloc(server->retired, sizeof(char *) * (server->numRetired + 1));
+    if (retired) {
+      server->retired = retired;
+      retired[server->numRetired++] = file->body;
+      time_t now = time(NULL);
+      file->body = copy;
+      file->len = len;
+      stampFile(file, now > file->modified ? now : file->modified + 1);
+      ok = 1;
+    }
+  } else {
+    FeedFile *files = realloc(server->files, sizeof(FeedFile) * (server->numFiles + 1));
+    if (files) {
+      server->files = files;
+      file = &files[server->numFiles];
+      file->name = strdup(name);
+      file->body = copy;
+      file->len = len;
+      if (file->name) {
+        stampFile(file, time(NULL));
+        server->numFiles++;
+        ok = 1;
+      }
+    }
+  }
+  pthread_mutex_unlock(&server->filesLock);
+  if (!ok) free(copy);
+  return ok;
+}
+
+void stopFeedServer(FeedServer *server) {
+  if (write(server->wakeFds[1], "x", 1) == 1) pthread_join(server->thread, NULL);
+  close(server->listenFd);
+  close(server->wakeFds[0]);
+  close(server->wakeFds[1]);
+  for (int i = 0; i < server->numFiles; i++) {
+    free(server->files[i].name);
+    free(server->files[i].body);
+  }
+  free(server->files);
+  server->files = NULL;
+  server->numFiles = 0;
+  for (int i = 0; i < server->numRetired; i++) free(server->retired[i]);
+  free(server->retired);
+  server->retired = NULL;
+  server->numRetired = 0;
+  pthread_mutex_destroy(&server->filesLock);
+}
@@ -0,0 +1,83 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Loopback feed server
+ *
+ * Description:
+ * A small HTTP/1.1 server on 127.0.0.1 that stands in for the RSS
+ * services in tests and benchmarks.  It serves the files of one
+ * directory (loaded into memory at start) from a background thread,
+ * keeps connections alive, and can hold every response back by a fixed
+ * delay to model network latency.
+ *
+ * Every file has an ETag (a hash of its bytes) and a Last-Modified time
+ * (its mtime), sent with each response.  A GET whose If-None-Match names
+ * the current ETag, or that has no If-None-Match and whose
+ * If-Modified-Since equals the file's Last-Modified, gets a 304 with no
+ * body, as a caching feed server would answer a conditional poll.
+ *
+ * NOTE: only GET is supported; the query string of a request is ignored,
+ * so many distinct URLs can name the same fixture.  If-Modified-Since is
+ * compared as text, which is how clients echo Last-Modified.
+ */
+
+#ifndef FEED_SERVER_H
+#define FEED_SERVER_H
+
+#include <pthread.h>
+
+typedef struct FeedFile FeedFile;
+
+typedef struct {
+  int port;            /* the port the server listens on */
+  int delayMs;         /* added before every response */
+  FeedFile *files;     /* the served files */
+  int numFiles;
+  int listenFd;
+  int wakeFds[2];      /* a pipe that stops the server thread */
+  pthread_t thread;
+  pthread_mutex_t filesLock;  /* guards files against feedServerSetFile */
+  char **retired;      /* replaced bodies, freed when the server stops */
+  int numRetired;
+  long connections;    /* accepted so far (see feedServerConnections) */
+  long requests;       /* answered so far (see feedServerRequests) */
+  long notModified;    /* 304 responses so far (see feedServerNotModified) */
+} FeedServer;
+
+/**
+ * Loads every regular file of <code>directory</code> and starts serving
+ * them as <code>/name</code> on an ephemeral loopback port (stored in
+ * <code>server->port</code>).  Returns 1 on success or 0 on failure.
+ */
+int startFeedServer(FeedServer *server, const char *directory, int delayMs);
+
+/**
+ * Returns the number of connections the server has accepted.
+ */
+long feedServerConnections(FeedServer *server);
+
+/**
+ * Returns the number of requests the server has answered.
+ */
+long feedServerRequests(FeedServer *server);
+
+/**
+ * Returns the number of 304 Not Modified responses the server has sent.
+ */
+long feedServerNotModified(FeedServer *server);
+
+/**
+ * Serves len bytes of body (copied) as <code>/name</code> from now on,
+ * replacing the file of that name or adding it, with a new ETag and a
+ * Last-Modified at least a second later than the old one.  Safe to call
+ * while the server runs.  Returns 1 on success or 0 on failure.
+ */
+int feedServerSetFile(FeedServer *server, const char *name, const char *body, size_t len);
+
+/**
+ * Stops the server thread, closes every connection and frees the files.
+ */
+void stopFeedServer(FeedServer *server);
+
+#endif /* FEED_SERVER_H */
@@ -0,0 +1,125 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Concurrent feed fetcher benchmark
+ *
+ * Description:
+ * Measures feeds per second for downloading and parsing the fixture
+ * feeds in data/ from a loopback feed server that holds each response
+ * back by a fixed delay (a stand-in for network latency): one getContent
+ * call per feed, as runRss does, against the concurrent fetcher at
+ * several parallelisms with a parser thread consuming its queue.  Also
+ * reports the connections each run opened.  Exits non-zero if any
+ * download or parse fails.
+ *
+ * Usage: fetchBench [numFeeds [delayMs]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <libxml/parser.h>
+
+#include "curl_utils.h"
+#include "feed_fetcher.h"
+#include "feed_server.h"
+#include "bench_utils.h"
+
+/* The parse work of a feed, without printing its items. */
+static int parseOnly(const char *xml, size_t len) {
+  xmlDocPtr doc = xmlReadMemory(xml, len, "noname.xml", NULL, 0);
+  int ok = doc && xmlDocGetRootElement(doc);
+  xmlFreeDoc(doc);
+  return ok;
+}
+
+/* Fetches and parses with the fetcher; returns the failures. */
+static int runFetcher(const char *const *urls, int n, int parallel) {
+  FeedFetcher fetcher;
+  FeedQueue queue;
+  if (!initFeedFetcher(&fetcher, parallel)) return n;
+  if (!initFeedQueue(&queue)) {
+    freeFeedFetcher(&fetcher);
+    return n;
+  }
+  FeedFetchJob job = { &fetcher, urls, n, &queue };
+  int failures = 0;
+  if (startFeedFetchJob(&job)) {
+    FeedResult *result;
+    while ((result = feedQueuePop(&queue)) != NULL) {
+      failures += result->error != CURLE_OK || result->status != 200 ||
+                  !parseOnly(result->body, result->len);
+      freeFeedResult(result);
+    }
+    failures += joinFeedFetchJob(&job) != n;
+  } else {
+    failures = n;
+  }
+  freeFeedQueue(&queue);
+  freeFeedFetcher(&fetcher);
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 200;
+  int delayMs = argc > 2 ? atoi(argv[2]) : 20;
+  if (n < 1 || delayMs < 0) {
+    fprintf(stderr, "Usage: %s [numFeeds [delayMs]] (run from the rss directory)\n", argv[0]);
+    return 1;
+  }
+  FeedServer server;
+  if (!startFeedServer(&server, "data", delayMs)) {
+    fprintf(stderr, "could not serve data/ (run from the rss directory)\n");
+    return 1;
+  }
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+  xmlInitParser();
+
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  char (*urlText)[128] = malloc(sizeof(*urlText) * n);
+  const char **urls = malloc(sizeof(char *) * n);
+  if (!urlText || !urls) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+  for (int i = 0; i < n; i++) {
+    snprintf(urlText[i], sizeof(urlText[i]), "http://127.0.0.1:%d/%s?feed=%d", server.port,
+             names[i % 2], i);
+    urls[i] = urlText[i];
+  }
+
+  printf("Feed fetching (%d feeds, %d ms per response)\n", n, delayMs);
+  printf("=============================================\n");
+
+  int failures = 0;
+  long before = feedServerConnections(&server);
+  double start = benchNow();
+  for (int i = 0; i < n; i++) {
+    char *xml = getContent(urls[i]);
+    failures += !xml || !parseOnly(xml, strlen(xml));
+    free(xml);
+  }
+  double secs = benchNow() - start;
+  printf("getContent, one at a time : %8.1f feeds/s  %5ld connections\n", n / secs,
+         feedServerConnections(&server) - before);
+
+  const int parallels[] = { 1, 4, 16, 64 };
+  for (int p = 0; p < 4; p++) {
+    before = feedServerConnections(&server);
+    start = benchNow();
+    failures += runFetcher(urls, n, parallels[p]);
+    secs = benchNow() - start;
+    printf("fetcher, %2d in parallel   : %8.1f feeds/s  %5ld connections\n", parallels[p],
+           n / secs, feedServerConnections(&server) - before);
+  }
+  printf("correctness checks        : %s\n", failures ? "FAILED" : "passed");
+
+  stopFeedServer(&server);
+  free(urlText);
+  free(urls);
+  xmlCleanupParser();
+  curl_global_cleanup();
+  return failures ? 1 : 0;
+}
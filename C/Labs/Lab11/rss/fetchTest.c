@@ -0,0 +1,188 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Concurrent feed fetcher test
+ *
+ * Description:
+ * Serves the fixture feeds in data/ from a loopback feed server and
+ * fetches them many times over with the concurrent fetcher while a
+ * consumer takes results off the queue.  Checks that every url gets
+ * exactly one result with the fixture's bytes (or the right error), that
+ * connections are reused within and across calls, and that delayed
+ * responses overlap.  The connection checks count what the server
+ * accepts and do not depend on how fast it answers.  Exits non-zero on
+ * a failure.
+ *
+ * Usage: fetchTest [fixtureDirectory]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "feed_fetcher.h"
+#include "feed_server.h"
+
+#define NUM_URLS 42
+#define PARALLEL 8
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+  printf("%-44s: %s\n", what, ok ? "passed" : "FAILED");
+  failures += !ok;
+}
+
+static double nowSeconds(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static char *readFile(const char *path, size_t *len) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return NULL;
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  *len = text ? fread(text, 1, size, in) : 0;
+  fclose(in);
+  return text;
+}
+
+/*
+ * Fetches the urls on a job thread and checks each result against the
+ * expected body (NULL: a 404; "": a failed connection).  Returns the
+ * number of mismatches.
+ */
+static int fetchAndCheck(FeedFetcher *fetcher, const char *const *urls, const char **bodies,
+                         const size_t *lens, int n) {
+  FeedQueue queue;
+  int seen[NUM_URLS] = { 0 };
+  int bad = 0;
+  if (!initFeedQueue(&queue)) return n;
+  FeedFetchJob job = { fetcher, urls, n, &queue };
+  if (!startFeedFetchJob(&job)) {
+    freeFeedQueue(&queue);
+    return n;
+  }
+  FeedResult *result;
+  while ((result = feedQueuePop(&queue)) != NULL) {
+    int i = result->index;
+    int ok = i >= 0 && i < n && !seen[i] && result->url == urls[i] && result->body;
+    if (ok) {
+      seen[i] = 1;
+      if (!bodies[i]) {
+        ok = result->error == CURLE_OK && result->status == 404;
+      } else if (!bodies[i][0]) {
+        ok = result->error != CURLE_OK && result->status == 0;
+      } else {
+        ok = result->error == CURLE_OK && result->status == 200 && result->len == lens[i] &&
+             memcmp(result->body, bodies[i], lens[i]) == 0;
+      }
+    }
+    if (!ok) fprintf(stderr, "  bad result for %s\n", result->url);
+    bad += !ok;
+    freeFeedResult(result);
+  }
+  int expectFailures = 0;
+  for (int i = 0; i < n; i++) {
+    bad += !seen[i];
+    expectFailures += bodies[i] && !bodies[i][0];
+  }
+  bad += joinFeedFetchJob(&job) != n - expectFailures;
+  freeFeedQueue(&queue);
+  return bad;
+}
+
+int main(int argc, char **argv) {
+  const char *directory = argc > 1 ? argv[1] : "data";
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  char *fixtures[2];
+  size_t fixtureLens[2];
+  for (int f = 0; f < 2; f++) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", directory, names[f]);
+    fixtures[f] = readFile(path, &fixtureLens[f]);
+    if (!fixtures[f]) {
+      fprintf(stderr, "Usage: %s [fixtureDirectory] (missing %s)\n", argv[0], path);
+      return 1;
+    }
+  }
+
+  FeedServer server;
+  if (!startFeedServer(&server, directory, 0)) {
+    fprintf(stderr, "could not start the feed server\n");
+    return 1;
+  }
+
+  /* the fixtures under many urls, one missing file and one dead port */
+  static char urlText[NUM_URLS][128];
+  const char *urls[NUM_URLS];
+  const char *bodies[NUM_URLS];
+  size_t lens[NUM_URLS];
+  for (int i = 0; i < NUM_URLS; i++) {
+    int f = i % 2;
+    snprintf(urlText[i], sizeof(urlText[i]), "http://127.0.0.1:%d/%s?feed=%d", server.port,
+             names[f], i);
+    bodies[i] = fixtures[f];
+    lens[i] = fixtureLens[f];
+    urls[i] = urlText[i];
+  }
+  snprintf(urlText[NUM_URLS - 2], sizeof(urlText[0]), "http://127.0.0.1:%d/missing.xml",
+           server.port);
+  bodies[NUM_URLS - 2] = NULL;
+  snprintf(urlText[NUM_URLS - 1], sizeof(urlText[0]), "http://127.0.0.1:1/feed.xml");
+  bodies[NUM_URLS - 1] = "";
+
+  FeedFetcher fetcher;
+  if (!initFeedFetcher(&fetcher, PARALLEL)) {
+    fprintf(stderr, "could not start the fetcher\n");
+    return 1;
+  }
+  /* the server's urls first; the dead port comes last, since its
+     connect attempt may close an idle connection to stay under the cap */
+  int live = NUM_URLS - 1;
+  int bad = fetchAndCheck(&fetcher, urls, bodies, lens, live);
+  long connections = feedServerConnections(&server);
+  check(bad == 0 && connections >= 1 && connections <= PARALLEL &&
+        feedServerRequests(&server) == live,
+        "every url: one result, right body or error");
+
+  /* every slot finds an idle connection, however quickly the first poll went */
+  bad = fetchAndCheck(&fetcher, urls, bodies, lens, live);
+  bad += fetchAndCheck(&fetcher, urls, bodies, lens, live);
+  check(bad == 0 && feedServerConnections(&server) == connections &&
+        feedServerRequests(&server) == 3 * live,
+        "later polls reuse the open connections");
+  check(fetchAndCheck(&fetcher, urls + live, bodies + live, lens + live, 1) == 0,
+        "a dead port: one failed result");
+  check(fetchAndCheck(&fetcher, urls, bodies, lens, 0) == 0, "empty request list");
+  freeFeedFetcher(&fetcher);
+  stopFeedServer(&server);
+
+  /* 16 responses held back 100 ms each overlap instead of queuing */
+  int delayMs = 100, n = 16;
+  if (startFeedServer(&server, directory, delayMs) && initFeedFetcher(&fetcher, n)) {
+    for (int i = 0; i < n; i++) {
+      snprintf(urlText[i], sizeof(urlText[i]), "http://127.0.0.1:%d/%s?feed=%d", server.port,
+               names[i % 2], i);
+    }
+    double start = nowSeconds();
+    bad = fetchAndCheck(&fetcher, urls, bodies, lens, n);
+    double elapsed = nowSeconds() - start;
+    check(bad == 0 && elapsed < n * delayMs / 1e3 / 4, "delayed responses download in parallel");
+    freeFeedFetcher(&fetcher);
+    stopFeedServer(&server);
+  } else {
+    check(0, "delayed responses download in parallel");
+  }
+
+  free(fixtures[0]);
+  free(fixtures[1]);
+  curl_global_cleanup();
+  return failures ? 1 : 0;
+}
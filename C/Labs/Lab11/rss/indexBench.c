@@ -0,0 +1,198 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Full-text index benchmark
+ *
+ * Description:
+ * Indexes a large synthetic feed and measures what the index costs and
+ * buys: build time against parsing alone, posting list bytes against
+ * plain 4-byte document numbers, query time against a scan that splits
+ * every item again (with the results compared), and loading a snapshot
+ * against parsing and indexing the feed again.  Exits non-zero if the
+ * index and the scan disagree.
+ *
+ * Usage: indexBench [numItems [k]]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "feed_index.h"
+#include "rss_stream.h"
+#include "bench_utils.h"
+
+#define MAX_QUERY_TERMS 8
+#define MAX_K 100
+
+static int countItem(const Rss *item, void *context) {
+  (*(int *)context)++;
+  return 1;
+}
+
+/* The terms of a query, for the scan. */
+typedef struct {
+  char terms[MAX_QUERY_TERMS][FEED_INDEX_MAX_TERM];
+  size_t lens[MAX_QUERY_TERMS];
+  int count;
+  int has;              /* bit i: the current item holds term i */
+} ScanQuery;
+
+static int addScanTerm(const char *term, size_t len, void *context) {
+  ScanQuery *query = context;
+  if (query->count == MAX_QUERY_TERMS) return 0;
+  memcpy(query->terms[query->count], term, len);
+  query->lens[query->count++] = len;
+  return 1;
+}
+
+static int markScanTerm(const char *term, size_t len, void *context) {
+  ScanQuery *query = context;
+  for (int i = 0; i < query->count; i++) {
+    if (query->lens[i] == len && memcmp(query->terms[i], term, len) == 0) query->has |= 1 << i;
+  }
+  return 1;
+}
+
+/* What searchFeedIndex does, by splitting every item again. */
+static int scanSearch(const FeedIndex *index, const char *text, FeedQueryMode mode, int k,
+                      int *docs, int *matches) {
+  ScanQuery query;
+  query.count = 0;
+  forEachFeedTerm(text, addScanTerm, &query);
+  int all = (1 << query.count) - 1, found = 0;
+  *matches = 0;
+  for (int d = 0; query.count > 0 && d < index->items.count; d++) {
+    const Rss *item = feedIndexItem(index, d);
+    query.has = 0;
+    forEachFeedTerm(item->title, markScanTerm, &query);
+    forEachFeedTerm(item->description, markScanTerm, &query);
+    if (mode == FEED_QUERY_ALL ? query.has != all : query.has == 0) continue;
+    (*matches)++;
+    int at = found < k ? found++ : k;
+    while (at > 0 && index->times[docs[at - 1]] < index->times[d]) {
+      if (at < k) docs[at] = docs[at - 1];
+      at--;
+    }
+    if (at < k) docs[at] = d;
+  }
+  return found;
+}
+
+int main(int argc, char **argv) {
+  int numItems = argc > 1 ? atoi(argv[1]) : 100000;
+  int k = argc > 2 ? atoi(argv[2]) : 10;
+  if (numItems < 1 || k < 1 || k > MAX_K) {
+    fprintf(stderr, "Usage: %s [numItems [k (1 to %d)]]\n", argv[0], MAX_K);
+    return 1;
+  }
+  size_t len = 0;
+  char *xml = makeSyntheticRss(numItems, &len);
+  if (!xml) {
+    fprintf(stderr, "setup failed\n");
+    return 1;
+  }
+  int failures = 0;
+
+  printf("Indexing a %d-item feed (%.1f MB)\n", numItems, len / 1e6);
+  printf("==========================================================================\n");
+  double best[2] = { 1e30, 1e30 };
+  FeedIndex index;
+  initFeedIndex(&index);
+  for (int r = 0; r < 3; r++) {
+    int items = 0;
+    double start = benchNow();
+    failures += streamRssItems(xml, len, countItem, &items) != numItems;
+    double secs = benchNow() - start;
+    if (secs < best[0]) best[0] = secs;
+
+    freeFeedIndex(&index);
+    start = benchNow();
+    failures += indexFeedXml(&index, xml, len) != numItems;
+    secs = benchNow() - start;
+    if (secs < best[1]) best[1] = secs;
+  }
+  uint64_t postings = 0, postingBytes = 0;
+  for (int i = 0; i < index.numTerms; i++) {
+    postings += index.terms[i].docs;
+    postingBytes += index.terms[i].postingBytes;
+  }
+  printf("parse only          : %7.1f ms\n", best[0] * 1e3);
+  printf("parse and index     : %7.1f ms  (%.0f items/s)\n", best[1] * 1e3, numItems / best[1]);
+  printf("terms               : %7d  postings: %llu\n", index.numTerms,
+         (unsigned long long)postings);
+  printf("varint gaps         : %7.2f MB  (%.2f bytes per posting)\n", postingBytes / 1e6,
+         (double)postingBytes / postings);
+  printf("4-byte doc numbers  : %7.2f MB  (%.1fx)\n", postings * 4 / 1e6,
+         postings * 4.0 / postingBytes);
+
+  const char *queries[] = { "word17", "campus", "word17 word400", "campus word5 word6",
+                            "announcement 4242", "word17 word400", "word1 word2 word3",
+                            "word998 department" };
+  const FeedQueryMode modes[] = { FEED_QUERY_ALL, FEED_QUERY_ALL, FEED_QUERY_ALL, FEED_QUERY_ALL,
+                                  FEED_QUERY_ALL, FEED_QUERY_ANY, FEED_QUERY_ANY, FEED_QUERY_ANY };
+  int numQueries = sizeof(queries) / sizeof(queries[0]);
+  printf("\nTop %d newest matches: index vs splitting every item again\n", k);
+  printf("==========================================================================\n");
+  for (int q = 0; q < numQueries; q++) {
+    int docs[MAX_K], expected[MAX_K], matches = 0, expectedMatches = 0, found = 0, want = 0;
+    int runs = 0;
+    double start = benchNow(), secs;
+    do {
+      found = searchFeedIndex(&index, queries[q], modes[q], k, docs, &matches);
+      runs++;
+    } while ((secs = benchNow() - start) < 0.2);
+    double indexSecs = secs / runs;
+    start = benchNow();
+    want = scanSearch(&index, queries[q], modes[q], k, expected, &expectedMatches);
+    double scanSecs = benchNow() - start;
+    int same = found == want && matches == expectedMatches &&
+               memcmp(docs, expected, sizeof(int) * found) == 0;
+    failures += !same;
+    printf("%-20s %-3s: %6d matches  index %8.3f ms  scan %7.1f ms  (%.0fx)%s\n", queries[q],
+           modes[q] == FEED_QUERY_ALL ? "AND" : "OR", matches, indexSecs * 1e3, scanSecs * 1e3,
+           scanSecs / indexSecs, same ? "" : "  MISMATCH");
+  }
+
+  printf("\nRestarting: loading a snapshot vs parsing and indexing again\n");
+  printf("==========================================================================\n");
+  char path[] = "/tmp/rssIndexBenchXXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    fprintf(stderr, "could not create a snapshot file\n");
+    return 1;
+  }
+  close(fd);
+  double start = benchNow();
+  failures += !saveFeedIndex(&index, path);
+  double saveSecs = benchNow() - start;
+  FILE *snapshot = fopen(path, "rb");
+  long size = 0;
+  if (snapshot) {
+    fseek(snapshot, 0, SEEK_END);
+    size = ftell(snapshot);
+    fclose(snapshot);
+  }
+  double loadSecs = 1e30;
+  for (int r = 0; r < 3; r++) {
+    FeedIndex loaded;
+    initFeedIndex(&loaded);
+    start = benchNow();
+    failures += !loadFeedIndex(&loaded, path) || loaded.items.count != numItems;
+    double secs = benchNow() - start;
+    if (secs < loadSecs) loadSecs = secs;
+    freeFeedIndex(&loaded);
+  }
+  unlink(path);
+  printf("snapshot            : %7.1f MB  (feed text %.1f MB)\n", size / 1e6, len / 1e6);
+  printf("save                : %7.1f ms\n", saveSecs * 1e3);
+  printf("load                : %7.1f ms  (%.1fx faster than re-indexing)\n", loadSecs * 1e3,
+         best[1] / loadSecs);
+  printf("correctness checks  : %s\n", failures ? "FAILED" : "passed");
+
+  freeFeedIndex(&index);
+  free(xml);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,269 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Full-text index test
+ *
+ * Description:
+ * Checks the feed index: how text is split into terms, AND and OR
+ * queries ranked newest first on a few handmade items, and every
+ * one- and two-term query over the fixture feeds in data/ against a
+ * scan that splits each item again.  Then saves a snapshot, loads it
+ * back and repeats the queries, and checks that truncated, padded or
+ * foreign snapshots are rejected.  Exits non-zero on a failure.
+ *
+ * Usage: indexTest [fixtureDirectory]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "feed_index.h"
+
+#define MAX_RESULTS 8
+
+static int failures = 0;
+
+static void check(int ok, const char *what) {
+  printf("%-44s: %s\n", what, ok ? "passed" : "FAILED");
+  failures += !ok;
+}
+
+static char *readFile(const char *path, size_t *len) {
+  FILE *in = fopen(path, "rb");
+  if (!in) return NULL;
+  fseek(in, 0, SEEK_END);
+  long size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  char *text = malloc(size + 1);
+  *len = text ? fread(text, 1, size, in) : 0;
+  if (text) text[*len] = '\0';
+  fclose(in);
+  return text;
+}
+
+/* Term callback: appends the term and a '|' to a string. */
+static int joinTerm(const char *term, size_t len, void *context) {
+  char *joined = context;
+  strncat(joined, term, len);
+  strcat(joined, "|");
+  return 1;
+}
+
+static void checkTerms(void) {
+  char joined[512] = "";
+  forEachFeedTerm("Hello, World! <a href=\"x.html\">Link</a> &amp; caf\xc3\xa9 R2-D2 a < b "
+                  "&#8217;s &nope 0123456789abcdefghijklmnopqrstuvwxyz", joinTerm, joined);
+  check(strcmp(joined, "hello|world|link|caf\xc3\xa9|r2|d2|a|b|s|nope|"
+                       "0123456789abcdefghijklmnopqrstuv|") == 0,
+        "terms: case, tags, entities, long words");
+  joined[0] = '\0';
+  forEachFeedTerm("<p><br/><!-- x --></p>", joinTerm, joined);
+  check(joined[0] == '\0', "markup alone has no terms");
+}
+
+/* Returns 1 if the document numbers are exactly the expected ones. */
+static int sameDocs(const int *docs, int found, const int *expected, int n) {
+  if (found != n) return 0;
+  for (int i = 0; i < n; i++) {
+    if (docs[i] != expected[i]) return 0;
+  }
+  return 1;
+}
+
+static void checkQueries(void) {
+  FeedIndex index;
+  initFeedIndex(&index);
+  Rss items[] = {
+    { "Rain in Lincoln", "http://x/0", "Mon, 06 Jan 2026 10:00:00 -0600", "" },
+    { "Lincoln sun", "http://x/1", "Tue, 07 Jan 2026 10:00:00 -0600", "<b>Clear</b> skies" },
+    { "Rain and sun", "http://x/2", "", "no date" },
+    { "rain rain RAIN", "http://x/3", "Tue, 07 Jan 2026 16:00:00 GMT", "Rain." },
+  };
+  int ok = 1;
+  for (int i = 0; i < 4; i++) ok = ok && feedIndexAdd(&index, &items[i]) == i;
+  check(ok && strcmp(feedIndexItem(&index, 1)->description, "<b>Clear</b> skies") == 0,
+        "items added in order");
+
+  int docs[MAX_RESULTS];
+  int matches = -1;
+  int found = searchFeedIndex(&index, "RAIN", FEED_QUERY_ALL, MAX_RESULTS, docs, &matches);
+  check(matches == 3 && sameDocs(docs, found, (int[]){ 3, 0, 2 }, 3),
+        "one term, newest first, undated last");
+  found = searchFeedIndex(&index, "rain sun", FEED_QUERY_ALL, MAX_RESULTS, docs, &matches);
+  check(matches == 1 && sameDocs(docs, found, (int[]){ 2 }, 1), "AND of two terms");
+  found = searchFeedIndex(&index, "rain sun", FEED_QUERY_ANY, MAX_RESULTS, docs, &matches);
+  check(matches == 4 && sameDocs(docs, found, (int[]){ 1, 3, 0, 2 }, 4),
+        "OR of two terms, equal dates in order added");
+  found = searchFeedIndex(&index, "sun rain", FEED_QUERY_ANY, 2, docs, &matches);
+  check(matches == 4 && sameDocs(docs, found, (int[]){ 1, 3 }, 2), "k limits the results");
+  found = searchFeedIndex(&index, "rain hail", FEED_QUERY_ALL, MAX_RESULTS, docs, &matches);
+  int anyFound = searchFeedIndex(&index, "rain hail", FEED_QUERY_ANY, MAX_RESULTS, docs, NULL);
+  check(found == 0 && matches == 0 && anyFound == 3, "a missing term: AND empty, OR not");
+  found = searchFeedIndex(&index, " <b> ", FEED_QUERY_ANY, MAX_RESULTS, docs, &matches);
+  check(found == 0 && matches == 0, "a query with no terms matches nothing");
+
+  int rainDocs = -1;
+  for (int i = 0; i < index.numTerms; i++) {
+    const FeedTerm *t = &index.terms[i];
+    if (t->length == 4 && memcmp(index.termText + t->text, "rain", 4) == 0) rainDocs = t->docs;
+  }
+  check(rainDocs == 3, "repeated words posted once per item");
+  freeFeedIndex(&index);
+}
+
+/* Term callback of the scan: sets *found if the term is the wanted one. */
+typedef struct {
+  const char *term;
+  int found;
+} Wanted;
+
+static int findWanted(const char *term, size_t len, void *context) {
+  Wanted *wanted = context;
+  if (strlen(wanted->term) == len && memcmp(term, wanted->term, len) == 0) wanted->found = 1;
+  return !wanted->found;
+}
+
+static int itemHas(const Rss *item, const char *term) {
+  Wanted wanted = { term, 0 };
+  forEachFeedTerm(item->title, findWanted, &wanted);
+  if (!wanted.found) forEachFeedTerm(item->description, findWanted, &wanted);
+  return wanted.found;
+}
+
+/*
+ * The scan: the k newest items holding both terms (or either, for
+ * any), found by splitting every item again.  b may be NULL.
+ */
+static int scanSearch(const FeedIndex *index, const char *a, const char *b, int any, int k,
+                      int *docs, int *matches) {
+  int found = 0;
+  *matches = 0;
+  for (int d = 0; d < index->items.count; d++) {
+    const Rss *item = feedIndexItem(index, d);
+    int hasA = itemHas(item, a), hasB = b ? itemHas(item, b) : hasA;
+    if (!(any ? hasA || hasB : hasA && hasB)) continue;
+    (*matches)++;
+    /* insert by date, newest first; a later equal date goes after */
+    int at = found < k ? found++ : k;
+    while (at > 0 && index->times[docs[at - 1]] < index->times[d]) {
+      if (at < k) docs[at] = docs[at - 1];
+      at--;
+    }
+    if (at < k) docs[at] = d;
+  }
+  return found;
+}
+
+/* Runs every one-term query and a pair per term against the scan. */
+static int matchesScan(const FeedIndex *index, const FeedIndex *terms) {
+  int ok = terms->numTerms > 0;
+  for (int i = 0; ok && i < terms->numTerms; i++) {
+    char a[FEED_INDEX_MAX_TERM + 1], b[FEED_INDEX_MAX_TERM + 1];
+    char query[2 * FEED_INDEX_MAX_TERM + 2];
+    const FeedTerm *ta = &terms->terms[i], *tb = &terms->terms[(i * 7 + 3) % terms->numTerms];
+    snprintf(a, sizeof(a), "%.*s", (int)ta->length, terms->termText + ta->text);
+    snprintf(b, sizeof(b), "%.*s", (int)tb->length, terms->termText + tb->text);
+    snprintf(query, sizeof(query), "%s %s", a, b);
+    for (int mode = 0; ok && mode < 3; mode++) {
+      int docs[MAX_RESULTS], expected[MAX_RESULTS], matches = -1, expectedMatches = 0;
+      int found = searchFeedIndex(index, mode == 0 ? a : query,
+                                  mode == 2 ? FEED_QUERY_ANY : FEED_QUERY_ALL, MAX_RESULTS, docs,
+                                  &matches);
+      int want = scanSearch(index, a, mode == 0 ? NULL : b, mode == 2, MAX_RESULTS, expected,
+                            &expectedMatches);
+      /* every term comes from an item, so only a pair's AND may be empty */
+      ok = matches == expectedMatches && sameDocs(docs, found, expected, want) &&
+           (mode == 1 || matches > 0);
+    }
+  }
+  return ok;
+}
+
+static void checkSnapshot(const FeedIndex *index) {
+  char path[] = "/tmp/rssIndexTestXXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0) {
+    check(0, "snapshot round trip");
+    return;
+  }
+  close(fd);
+  FeedIndex loaded;
+  initFeedIndex(&loaded);
+  int ok = saveFeedIndex(index, path) && loadFeedIndex(&loaded, path) &&
+           loaded.items.count == index->items.count && loaded.numTerms == index->numTerms;
+  for (int d = 0; ok && d < index->items.count; d++) {
+    const Rss *x = feedIndexItem(index, d), *y = feedIndexItem(&loaded, d);
+    ok = strcmp(x->title, y->title) == 0 && strcmp(x->link, y->link) == 0 &&
+         strcmp(x->date, y->date) == 0 && strcmp(x->description, y->description) == 0 &&
+         index->times[d] == loaded.times[d];
+  }
+  check(ok && matchesScan(&loaded, index), "snapshot round trip, same results");
+  /* a loaded index keeps growing */
+  Rss extra = { "Snapshot extra", "http://x/extra", "", "" };
+  int docs[MAX_RESULTS];
+  check(feedIndexAdd(&loaded, &extra) == index->items.count &&
+        searchFeedIndex(&loaded, "snapshot", FEED_QUERY_ALL, MAX_RESULTS, docs, NULL) == 1 &&
+        docs[0] == index->items.count, "items added after a load");
+  freeFeedIndex(&loaded);
+
+  size_t len = 0;
+  char *bytes = readFile(path, &len);
+  ok = bytes && len > 40;
+  for (int cut = 0; ok && cut < 4; cut++) {
+    /* truncated, trailing garbage, bad magic, another version */
+    FILE *out = fopen(path, "wb");
+    size_t keep = cut == 0 ? len - 3 : len;
+    ok = out && fwrite(bytes, 1, keep, out) == keep;
+    if (ok && cut == 1) ok = fputc('x', out) != EOF;
+    if (ok && cut == 2) ok = fseek(out, 0, SEEK_SET) == 0 && fputc('X', out) != EOF;
+    if (ok && cut == 3) {
+      ok = fseek(out, 8, SEEK_SET) == 0 && fputc(FEED_INDEX_VERSION + 1, out) != EOF;
+    }
+    if (out) fclose(out);
+    initFeedIndex(&loaded);
+    ok = ok && !loadFeedIndex(&loaded, path) && loaded.items.count == 0 && loaded.numTerms == 0;
+    freeFeedIndex(&loaded);
+  }
+  free(bytes);
+  unlink(path);
+  initFeedIndex(&loaded);
+  ok = ok && loadFeedIndex(&loaded, path) && loaded.items.count == 0;
+  check(ok, "bad snapshots rejected, missing is empty");
+}
+
+int main(int argc, char **argv) {
+  const char *directory = argc > 1 ? argv[1] : "data";
+  const char *names[] = { "bits_and_bytes.xml", "unl_events.xml" };
+  const int counts[] = { 12, 10 };
+
+  checkTerms();
+  checkQueries();
+
+  FeedIndex index;
+  initFeedIndex(&index);
+  int ok = 1;
+  for (int i = 0; i < 2; i++) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", directory, names[i]);
+    size_t len = 0;
+    char *xml = readFile(path, &len);
+    if (!xml) {
+      fprintf(stderr, "Usage: %s [fixtureDirectory] (could not read %s)\n", argv[0], path);
+      return 1;
+    }
+    ok = ok && indexFeedXml(&index, xml, len) == counts[i];
+    free(xml);
+  }
+  check(ok && index.items.count == 22, "fixture feeds indexed");
+  check(matchesScan(&index, &index), "fixture queries match a scan");
+  check(indexFeedXml(&index, "<rss><channel><item><title>x</title></item>", 44) < 0,
+        "malformed feed reported");
+
+  checkSnapshot(&index);
+
+  freeFeedIndex(&index);
+  return failures ? 1 : 0;
+}
@@ -4,22 +4,61 @@
 
 #include "rss.h"
 
+static char *copyOrEmpty(const char *str) {
+  if (str == NULL) str = "";
+  size_t len = strlen(str);
+  char *copy = malloc(len + 1);
+  if (copy) memcpy(copy, str, len + 1);
+  return copy;
+}
+
 Rss * createEmptyRss() {
-  // TODO: implement this functions
+  return createRss(NULL, NULL, NULL, NULL);
 }
 
 Rss * createRss(const char * title, const char * link, const char * date, const char * description) {
-  // TODO: implement this functions
+  Rss *item = malloc(sizeof(Rss));
+  if (item == NULL) return NULL;
+  initRss(item, title, link, date, description);
+  return item;
 }
 
 void initRss(Rss *feed, const char* title, const char* link, const char* date, const char* description) {
-  // TODO: implement this functions
+  if (feed == NULL) return;
+  feed->title = copyOrEmpty(title);
+  feed->link = copyOrEmpty(link);
+  feed->date = copyOrEmpty(date);
+  feed->description = copyOrEmpty(description);
 }
 
 char *rssToString(const Rss *item) {
-  // TODO: implement this functions
+  const char *title = item->title ? item->title : "";
+  const char *link = item->link ? item->link : "";
+  const char *date = item->date ? item->date : "";
+  const char *description = item->description ? item->description : "";
+  const char *format = "%s\n  %s\n  %s\n  %s\n";
+  int len = snprintf(NULL, 0, format, title, date, link, description);
+  char *result = malloc(len + 1);
+  if (result) snprintf(result, len + 1, format, title, date, link, description);
+  return result;
 }
 
 void printRss(const Rss * item) {
-  // TODO: implement this functions
+  char *str = rssToString(item);
+  if (str) fputs(str, stdout);
+  free(str);
+}
+
+void freeRssFields(Rss *item) {
+  if (item == NULL) return;
+  free(item->title);
+  free(item->link);
+  free(item->date);
+  free(item->description);
+  item->title = item->link = item->date = item->description = NULL;
+}
+
+void freeRss(Rss *item) {
+  freeRssFields(item);
+  free(item);
 }
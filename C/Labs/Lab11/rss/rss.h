@@ -1,9 +1,16 @@
+#ifndef RSS_H
+#define RSS_H
 
 /**
- * TODO: provide documentation for your structure
+ * A single item of an RSS (or Atom) feed.  Every field is a malloc'd,
+ * NUL-terminated string (never <code>NULL</code>); a field missing from
+ * the feed is the empty string.
  */
 typedef struct {
-  // TODO: define your structure here
+  char *title;
+  char *link;
+  char *date;         /* as given by the feed (pubDate or updated) */
+  char *description;
 } Rss;
 
 /**
@@ -23,7 +30,7 @@ Rss* createRss(const char* title,
 
 /**
  * An initialization function to initialize an RSS feed with the
- * given values.
+ * given values.  <code>NULL</code> values are stored as empty strings.
  */
 void initRss(Rss *feed,
              const char* title,
@@ -33,7 +40,7 @@ void initRss(Rss *feed,
 
 /**
  * A function to construct a (human-readable) string representation
- * of the given RSS item.
+ * of the given RSS item.  The caller frees the result.
  */
 char *rssToString(const Rss *item);
 
@@ -42,3 +49,15 @@ char *rssToString(const Rss *item);
  * to the standard output.
  */
 void printRss(const Rss* item);
+
+/**
+ * Frees the strings of the given item (but not the item itself).
+ */
+void freeRssFields(Rss *item);
+
+/**
+ * Frees an item made by createRss or createEmptyRss.
+ */
+void freeRss(Rss *item);
+
+#endif /* RSS_H */
@@ -0,0 +1,262 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS parser benchmark
+ *
+ * Description:
+ * Times parsing a large synthetic RSS feed two ways: the DOM walk of
+ * parseRssXml (xmlReadMemory, strcmp on node names, xmlNodeGetContent
+ * per field) and streamRssItems.  Reports the peak heap libxml2 uses
+ * for each, at the full size and at a tenth of it, by routing libxml2's
+ * allocator through counters.  Both must produce the same items, for
+ * the synthetic feed and for the fixture feeds in data/; a set of small
+ * documents checks namespaces, CDATA, repeated fields, Atom links and
+ * fallbacks and malformed input.  Exits non-zero on a mismatch.
+ *
+ * Usage: rssBench [numItems]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+
+#include "rss.h"
+#include "rss_stream.h"
+#include "byte_buffer.h"
+#include "bench_utils.h"
+
+static size_t liveBytes, peakBytes;
+static long allocations;
+
+/* libxml2 allocator that keeps the size in front of each block */
+typedef union {
+  size_t size;
+  long double align;
+} BlockHeader;
+
+static void *countingMalloc(size_t size) {
+  BlockHeader *block = malloc(sizeof(BlockHeader) + size);
+  if (!block) return NULL;
+  block->size = size;
+  allocations++;
+  liveBytes += size;
+  if (liveBytes > peakBytes) peakBytes = liveBytes;
+  return block + 1;
+}
+
+static void countingFree(void *ptr) {
+  if (!ptr) return;
+  BlockHeader *block = (BlockHeader *)ptr - 1;
+  liveBytes -= block->size;
+  free(block);
+}
+
+static void *countingRealloc(void *ptr, size_t size) {
+  if (!ptr) return countingMalloc(size);
+  BlockHeader *block = (BlockHeader *)ptr - 1;
+  size_t old = block->size;
+  block = realloc(block, sizeof(BlockHeader) + size);
+  if (!block) return NULL;
+  block->size = size;
+  allocations++;
+  liveBytes += size - old;
+  if (liveBytes > peakBytes) peakBytes = liveBytes;
+  return block + 1;
+}
+
+static char *countingStrdup(const char *str) {
+  size_t len = strlen(str) + 1;
+  char *copy = countingMalloc(len);
+  if (copy) memcpy(copy, str, len);
+  return copy;
+}
+
+/*
+ * The DOM walk of parseRssXml and parseAtomXml, without the 100-item
+ * limit and handing each item to a handler instead of printing it.
+ */
+static int domItems(const char *xml, size_t len, RssItemHandler handler, void *context) {
+  xmlDocPtr doc = xmlReadMemory(xml, len, "noname.xml", NULL, 0);
+  xmlNode *root = xmlDocGetRootElement(doc);
+  if (!root) {
+    xmlFreeDoc(doc);
+    return -1;
+  }
+  int atom = strcmp((const char *)root->name, "feed") == 0;
+  xmlNode *parent = root;
+  if (!atom) parent = root->children->next != NULL ? root->children->next : root->last;
+  const char *itemName = atom ? "entry" : "item";
+  int count = 0;
+  for (xmlNode *cur = parent->children; cur; cur = cur->next) {
+    if (cur->type != XML_ELEMENT_NODE || strcmp((const char *)cur->name, itemName) != 0) continue;
+    xmlChar *fields[4] = { NULL, NULL, NULL, NULL };
+    for (xmlNode *inner = cur->children; inner; inner = inner->next) {
+      if (inner->type != XML_ELEMENT_NODE) continue;
+      const char *name = (const char *)inner->name;
+      int f = strcmp(name, "title") == 0 ? 0 : strcmp(name, "link") == 0 ? 1 :
+              strcmp(name, atom ? "updated" : "pubDate") == 0 ? 2 :
+              strcmp(name, atom ? "content" : "description") == 0 ? 3 : -1;
+      /* the first occurrence of a field wins */
+      if (f < 0 || fields[f]) continue;
+      fields[f] = xmlNodeGetContent(inner);
+    }
+    Rss item = { (char *)(fields[0] ? fields[0] : BAD_CAST ""),
+                 (char *)(fields[1] ? fields[1] : BAD_CAST ""),
+                 (char *)(fields[2] ? fields[2] : BAD_CAST ""),
+                 (char *)(fields[3] ? fields[3] : BAD_CAST "") };
+    count++;
+    int more = handler(&item, context);
+    for (int f = 0; f < 4; f++) xmlFree(fields[f]);
+    if (!more) break;
+  }
+  xmlFreeDoc(doc);
+  return count;
+}
+
+/* Handler: appends the printed form of each item to a ByteBuffer. */
+static int collect(const Rss *item, void *context) {
+  char *text = rssToString(item);
+  int ok = text && byteBufferAppend(context, text, strlen(text));
+  free(text);
+  return ok;
+}
+
+/* Handler: touches each field, as cheaply as a consumer could. */
+static int touch(const Rss *item, void *context) {
+  *(size_t *)context += strlen(item->title) + strlen(item->link) + strlen(item->date) +
+                        strlen(item->description);
+  return 1;
+}
+
+/* Handler: stops after the first item. */
+static int firstOnly(const Rss *item, void *context) {
+  return 0;
+}
+
+/* Parses with both paths and compares the printed items. */
+static int sameItems(const char *xml, size_t len, int *count) {
+  ByteBuffer dom, stream;
+  if (!initByteBuffer(&dom, 0) || !initByteBuffer(&stream, 0)) return 0;
+  int domCount = domItems(xml, len, collect, &dom);
+  int streamCount = streamRssItems(xml, len, collect, &stream);
+  int same = domCount >= 0 && domCount == streamCount && dom.len == stream.len &&
+             memcmp(dom.ptr, stream.ptr, dom.len) == 0;
+  if (count) *count = streamCount;
+  freeByteBuffer(&dom);
+  freeByteBuffer(&stream);
+  return same;
+}
+
+/* The stream parser's items of a small document, printed. */
+static int streamIs(const char *xml, int expectCount, const char *expect) {
+  ByteBuffer out;
+  if (!initByteBuffer(&out, 0)) return 0;
+  int count = streamRssItems(xml, strlen(xml), collect, &out);
+  int ok = count == expectCount && (!expect || strcmp(out.ptr, expect) == 0);
+  if (!ok) fprintf(stderr, "unexpected items (%d):\n%s", count, out.ptr);
+  freeByteBuffer(&out);
+  return ok;
+}
+
+static int checkEdges(void) {
+  int failures = 0;
+  /* namespaced extensions, CDATA, entities and markup inside a field */
+  failures += !streamIs(
+      "<rss xmlns:media=\"http://search.yahoo.com/mrss/\"><channel><item>"
+      "<media:title>not this</media:title><title>A &amp; B</title>"
+      "<description><![CDATA[<p>raw</p>]]> and <b>bold</b></description>"
+      "<title>second title</title></item></channel></rss>",
+      1, "A & B\n  \n  \n  <p>raw</p> and bold\n");
+  /* missing fields, an empty item, RSS 1.0 items outside the channel */
+  failures += !streamIs(
+      "<rdf:RDF xmlns:rdf=\"http://www.w3.org/1999/02/22-rdf-syntax-ns#\" "
+      "xmlns=\"http://purl.org/rss/1.0/\"><channel><title>c</title></channel>"
+      "<item><link>l</link></item><item/></rdf:RDF>",
+      2, "\n  \n  l\n  \n\n  \n  \n  \n");
+  /* Atom: alternate link, summary and published fallbacks */
+  failures += !streamIs(
+      "<feed xmlns=\"http://www.w3.org/2005/Atom\"><entry><title type=\"text\">t</title>"
+      "<link rel=\"self\" href=\"s\"/><link rel=\"alternate\" href=\"a\"/>"
+      "<summary>sum</summary><published>p</published></entry>"
+      "<entry><link href=\"only\"/><content>c</content><summary>s</summary>"
+      "<updated>u</updated><published>p</published></entry></feed>",
+      2, "t\n  p\n  a\n  sum\n\n  u\n  only\n  c\n");
+  /* repeated fields: the first wins on both paths, even when it is empty */
+  const char *repeated =
+      "<rss><channel><item><title>first</title><link>l1</link><title>second</title>"
+      "<pubDate>d1</pubDate><link>l2</link><description/><description>two</description>"
+      "<pubDate>d2</pubDate></item></channel></rss>";
+  failures += !streamIs(repeated, 1, "first\n  d1\n  l1\n  \n");
+  failures += !sameItems(repeated, strlen(repeated), NULL);
+  failures += !streamIs("<rss><channel><item><title>x</title></item><item>", -1, NULL);
+  failures += !streamIs("not xml at all", -1, NULL);
+  failures += !streamIs("<rss><channel></channel></rss>", 0, "");
+  const char *two = "<rss><channel><item/><item/></channel></rss>";
+  failures += streamRssItems(two, strlen(two), firstOnly, NULL) != 1;
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? atoi(argv[1]) : 100000;
+  if (n < 10) {
+    fprintf(stderr, "Usage: %s [numItems >= 10] (run from the rss directory)\n", argv[0]);
+    return 1;
+  }
+  xmlMemSetup(countingFree, countingMalloc, countingRealloc, countingStrdup);
+  xmlInitParser();
+
+  int failures = checkEdges();
+  const char *fixtures[] = { "data/bits_and_bytes.xml", "data/unl_events.xml" };
+  for (int f = 0; f < 2; f++) {
+    size_t len = 0;
+    char *xml = readFile(fixtures[f], &len);
+    int count = 0;
+    /* Atom links differ: the DOM walk reads the (empty) text of <link> */
+    if (!xml || (f == 0 && !sameItems(xml, len, &count))) failures++;
+    if (xml && f == 1 && streamRssItems(xml, len, touch, &(size_t){ 0 }) != 10) failures++;
+    free(xml);
+  }
+
+  printf("RSS parsing (n = %d items)\n", n);
+  printf("=========================\n");
+  int sizes[] = { n / 10, n };
+  for (int s = 0; s < 2; s++) {
+    size_t len = 0;
+    char *xml = makeSyntheticRss(sizes[s], &len);
+    int count = 0;
+    if (!xml || !sameItems(xml, len, &count) || count != sizes[s]) failures++;
+
+    double best[2] = { 1e30, 1e30 };
+    size_t peak[2] = { 0, 0 };
+    long calls[2] = { 0, 0 };
+    size_t sink = 0;
+    for (int round = 0; xml && round < 3; round++) {
+      for (int path = 0; path < 2; path++) {
+        peakBytes = liveBytes;
+        size_t base = liveBytes;
+        allocations = 0;
+        double start = benchNow();
+        int got = path ? streamRssItems(xml, len, touch, &sink) : domItems(xml, len, touch, &sink);
+        double secs = benchNow() - start;
+        failures += got != sizes[s];
+        if (secs < best[path]) best[path] = secs;
+        peak[path] = peakBytes - base;
+        calls[path] = allocations;
+      }
+    }
+    printf("%7d items, %6.1f MB of XML\n", sizes[s], len / 1e6);
+    printf("  DOM walk        : %8.1f ms  peak libxml2 heap %8.2f MB  %9ld allocations\n",
+           best[0] * 1e3, peak[0] / 1e6, calls[0]);
+    printf("  streamRssItems  : %8.1f ms  peak libxml2 heap %8.2f MB  %9ld allocations (%.1fx)\n",
+           best[1] * 1e3, peak[1] / 1e6, calls[1], best[0] / best[1]);
+    free(xml);
+  }
+  printf("correctness checks: %s\n", failures ? "FAILED" : "passed");
+
+  xmlCleanupParser();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,351 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS item collection
+ *
+ * Description:
+ * Implements the arena-backed feed, the newest-n heap and the date
+ * parser declared in rss_feed.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "rss_feed.h"
+#include "rss_stream.h"
+#include "byte_buffer.h"
+
+/* Arena blocks start small and double up to this size; longer strings
+ * get a block of their own. */
+#define ARENA_FIRST_BLOCK 4096
+#define ARENA_MAX_BLOCK (1 << 20)
+
+struct RssArenaBlock {
+  struct RssArenaBlock *next;
+  size_t size;
+  size_t used;
+  char text[];
+};
+
+static char *arenaCopy(RssFeed *feed, const char *str) {
+  if (str == NULL) str = "";
+  size_t len = strlen(str) + 1;
+  RssArenaBlock *block = feed->blocks;
+  if (!block || block->size - block->used < len) {
+    size_t size = feed->nextBlockSize;
+    if (size < len) size = len;
+    block = malloc(sizeof(RssArenaBlock) + size);
+    if (block == NULL) return NULL;
+    block->size = size;
+    block->used = 0;
+    block->next = feed->blocks;
+    feed->blocks = block;
+    if (feed->nextBlockSize < ARENA_MAX_BLOCK) feed->nextBlockSize *= 2;
+  }
+  char *copy = block->text + block->used;
+  memcpy(copy, str, len);
+  block->used += len;
+  return copy;
+}
+
+void initRssFeed(RssFeed *feed) {
+  feed->items = NULL;
+  feed->count = 0;
+  feed->capacity = 0;
+  feed->blocks = NULL;
+  feed->nextBlockSize = ARENA_FIRST_BLOCK;
+}
+
+int rssFeedAppend(RssFeed *feed, const Rss *item) {
+  if (feed->count == feed->capacity) {
+    int capacity = feed->capacity ? feed->capacity * 2 : 16;
+    Rss *items = realloc(feed->items, sizeof(Rss) * capacity);
+    if (items == NULL) return 0;
+    feed->items = items;
+    feed->capacity = capacity;
+  }
+  Rss *copy = &feed->items[feed->count];
+  copy->title = arenaCopy(feed, item->title);
+  copy->link = arenaCopy(feed, item->link);
+  copy->date = arenaCopy(feed, item->date);
+  copy->description = arenaCopy(feed, item->description);
+  if (!copy->title || !copy->link || !copy->date || !copy->description) return 0;
+  feed->count++;
+  return 1;
+}
+
+typedef struct {
+  RssFeed *feed;
+  int failed;
+} AppendContext;
+
+static int appendItem(const Rss *item, void *context) {
+  AppendContext *append = context;
+  if (rssFeedAppend(append->feed, item)) return 1;
+  append->failed = 1;
+  return 0;
+}
+
+int parseRssFeed(const char *xml, size_t len, RssFeed *feed) {
+  int before = feed->count;
+  AppendContext context = { feed, 0 };
+  if (streamRssItems(xml, len, appendItem, &context) < 0 || context.failed) {
+    feed->count = before;
+    return -1;
+  }
+  return feed->count - before;
+}
+
+/* An item held by the newest-n heap, its strings packed in one buffer. */
+typedef struct {
+  long long time;
+  int seq;               /* document order, to break ties */
+  ByteBuffer text;
+  size_t offsets[4];     /* title, link, date, description */
+} Kept;
+
+typedef struct {
+  Kept *kept;
+  int *heap;             /* indexes into kept; the oldest item on top */
+  int size;
+  int n;
+  int seq;
+  int failed;
+} Newest;
+
+/* Whether kept item a should leave the heap before b. */
+static int older(const Kept *a, const Kept *b) {
+  return a->time < b->time || (a->time == b->time && a->seq > b->seq);
+}
+
+static void siftUp(Newest *newest, int at) {
+  while (at > 0) {
+    int parent = (at - 1) / 2;
+    if (!older(&newest->kept[newest->heap[at]], &newest->kept[newest->heap[parent]])) break;
+    int swap = newest->heap[at];
+    newest->heap[at] = newest->heap[parent];
+    newest->heap[parent] = swap;
+    at = parent;
+  }
+}
+
+static void siftDown(Newest *newest, int at) {
+  for (;;) {
+    int child = 2 * at + 1;
+    if (child >= newest->size) break;
+    if (child + 1 < newest->size &&
+        older(&newest->kept[newest->heap[child + 1]], &newest->kept[newest->heap[child]])) {
+      child++;
+    }
+    if (!older(&newest->kept[newest->heap[child]], &newest->kept[newest->heap[at]])) break;
+    int swap = newest->heap[at];
+    newest->heap[at] = newest->heap[child];
+    newest->heap[child] = swap;
+    at = child;
+  }
+}
+
+static int keep(Kept *kept, const Rss *item, long long time, int seq) {
+  const char *fields[4] = { item->title, item->link, item->date, item->description };
+  kept->time = time;
+  kept->seq = seq;
+  kept->text.len = 0;
+  for (int f = 0; f < 4; f++) {
+    kept->offsets[f] = kept->text.len;
+    if (!byteBufferAppend(&kept->text, fields[f], strlen(fields[f]) + 1)) return 0;
+  }
+  return 1;
+}
+
+static int offerItem(const Rss *item, void *context) {
+  Newest *newest = context;
+  long long time = parseRssDate(item->date);
+  int seq = newest->seq++;
+  int slot;
+  if (newest->size < newest->n) {
+    slot = newest->size;
+    if (!initByteBuffer(&newest->kept[slot].text, 0)) {
+      newest->failed = 1;
+      return 0;
+    }
+    newest->heap[newest->size++] = slot;
+    if (!keep(&newest->kept[slot], item, time, seq)) newest->failed = 1;
+    siftUp(newest, newest->size - 1);
+  } else if (time > newest->kept[newest->heap[0]].time) {
+    /* newer than the oldest kept item: it takes that item's place */
+    slot = newest->heap[0];
+    if (!keep(&newest->kept[slot], item, time, seq)) newest->failed = 1;
+    siftDown(newest, 0);
+  }
+  return !newest->failed;
+}
+
+/* Heap-sorts the kept items in place, leaving heap[] newest first. */
+static void sortNewestFirst(Newest *newest) {
+  int count = newest->size;
+  while (newest->size > 1) {
+    int oldest = newest->heap[0];
+    newest->heap[0] = newest->heap[--newest->size];
+    newest->heap[newest->size] = oldest;
+    siftDown(newest, 0);
+  }
+  newest->size = count;
+}
+
+int parseRssFeedNewest(const char *xml, size_t len, int n, RssFeed *feed) {
+  if (n <= 0) return 0;
+  Newest newest = { malloc(sizeof(Kept) * n), malloc(sizeof(int) * n), 0, n, 0, 0 };
+  int before = feed->count;
+  int ok = newest.kept && newest.heap && streamRssItems(xml, len, offerItem, &newest) >= 0 &&
+           !newest.failed;
+  if (ok) {
+    sortNewestFirst(&newest);
+    for (int i = 0; ok && i < newest.size; i++) {
+      const Kept *kept = &newest.kept[newest.heap[i]];
+      Rss item = { kept->text.ptr + kept->offsets[0], kept->text.ptr + kept->offsets[1],
+                   kept->text.ptr + kept->offsets[2], kept->text.ptr + kept->offsets[3] };
+      ok = rssFeedAppend(feed, &item);
+    }
+  }
+  for (int i = 0; newest.kept && i < newest.size; i++) {
+    freeByteBuffer(&newest.kept[newest.heap[i]].text);
+  }
+  free(newest.kept);
+  free(newest.heap);
+  if (!ok) {
+    feed->count = before;
+    return -1;
+  }
+  return feed->count - before;
+}
+
+/* Days from 1970-01-01 to the given civil date (proleptic Gregorian). */
+static long long daysFromCivil(long long year, int month, int day) {
+  year -= month <= 2;
+  long long era = (year >= 0 ? year : year - 399) / 400;
+  long long yearOfEra = year - era * 400;
+  int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+/* Reads up to max digits (at least one); returns the value or -1. */
+static long readNumber(const char **at, int max) {
+  long value = 0;
+  int digits = 0;
+  while (digits < max && isdigit((unsigned char)**at)) {
+    value = value * 10 + (**at - '0');
+    (*at)++;
+    digits++;
+  }
+  return digits ? value : -1;
+}
+
+/* Reads "+hhmm", "-hh:mm", "Z" or a zone name; returns its offset in seconds. */
+static int readZone(const char *at, long *offset) {
+  static const struct { const char *name; int hours; } zones[] = {
+    { "UT", 0 }, { "UTC", 0 }, { "GMT", 0 }, { "Z", 0 },
+    { "EST", -5 }, { "EDT", -4 }, { "CST", -6 }, { "CDT", -5 },
+    { "MST", -7 }, { "MDT", -6 }, { "PST", -8 }, { "PDT", -7 },
+  };
+  while (*at == ' ') at++;
+  *offset = 0;
+  if (*at == '\0') return 1;
+  if (*at == '+' || *at == '-') {
+    int sign = *at == '-' ? -1 : 1;
+    at++;
+    long hours = readNumber(&at, 2);
+    if (*at == ':') at++;
+    long minutes = readNumber(&at, 2);
+    if (hours < 0 || minutes < 0 || hours > 23 || minutes > 59) return 0;
+    *offset = sign * (hours * 3600 + minutes * 60);
+    return 1;
+  }
+  for (size_t i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+    size_t len = strlen(zones[i].name);
+    if (strncasecmp(at, zones[i].name, len) == 0 && !isalpha((unsigned char)at[len])) {
+      *offset = zones[i].hours * 3600L;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+long long parseRssDate(const char *date) {
+  static const char *months = "janfebmaraprmayjunjulaugsepoctnovdec";
+  if (date == NULL) return RSS_NO_DATE;
+  const char *at = date;
+  while (isspace((unsigned char)*at)) at++;
+  long year, month, day, hour = 0, minute = 0, second = 0;
+
+  if (isdigit((unsigned char)at[0]) && isdigit((unsigned char)at[1]) &&
+      isdigit((unsigned char)at[2]) && isdigit((unsigned char)at[3]) && at[4] == '-') {
+    /* RFC 3339: 2026-03-02T15:00:00.5-06:00 (the time is optional) */
+    year = readNumber(&at, 4);
+    at++;
+    month = readNumber(&at, 2);
+    if (*at++ != '-') return RSS_NO_DATE;
+    day = readNumber(&at, 2);
+    if (*at == 'T' || *at == 't' || *at == ' ') {
+      at++;
+      hour = readNumber(&at, 2);
+      if (*at++ != ':') return RSS_NO_DATE;
+      minute = readNumber(&at, 2);
+      if (*at == ':') {
+        at++;
+        second = readNumber(&at, 2);
+        if (*at == '.') {
+          at++;
+          while (isdigit((unsigned char)*at)) at++;
+        }
+      }
+    }
+  } else {
+    /* RFC 822: [Mon, ]02 Mar 2026 15:00[:00] -0600 */
+    while (isalpha((unsigned char)*at)) at++;
+    if (*at == ',') at++;
+    while (*at == ' ') at++;
+    day = readNumber(&at, 2);
+    while (*at == ' ') at++;
+    month = -1;
+    for (int m = 0; m < 12 && isalpha((unsigned char)*at); m++) {
+      if (strncasecmp(at, months + 3 * m, 3) == 0) month = m + 1;
+    }
+    while (isalpha((unsigned char)*at)) at++;
+    while (*at == ' ') at++;
+    const char *yearStart = at;
+    year = readNumber(&at, 4);
+    if (at - yearStart == 2) year += year < 50 ? 2000 : 1900;
+    while (*at == ' ') at++;
+    if (isdigit((unsigned char)*at)) {
+      hour = readNumber(&at, 2);
+      if (*at++ != ':') return RSS_NO_DATE;
+      minute = readNumber(&at, 2);
+      if (*at == ':') {
+        at++;
+        second = readNumber(&at, 2);
+      }
+    }
+  }
+
+  long offset;
+  if (year < 0 || month < 1 || month > 12 || day < 1 || day > 31 || hour < 0 || hour > 23 ||
+      minute < 0 || minute > 59 || second < 0 || second > 60 || !readZone(at, &offset)) {
+    return RSS_NO_DATE;
+  }
+  return daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+}
+
+void freeRssFeed(RssFeed *feed) {
+  RssArenaBlock *block = feed->blocks;
+  while (block) {
+    RssArenaBlock *next = block->next;
+    free(block);
+    block = next;
+  }
+  free(feed->items);
+  initRssFeed(feed);
+}
@@ -0,0 +1,77 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - RSS item collection
+ *
+ * Description:
+ * An RssFeed holds any number of items in one growable array, with all
+ * of their strings copied into a single arena owned by the feed, so a
+ * whole parsed feed is released by one freeRssFeed.  A feed can also be
+ * filled with just the newest n items of a document, chosen with a
+ * bounded heap while streaming, so a huge feed is never materialized.
+ *
+ * NOTE: the items' strings point into the arena; they stay valid until
+ * the feed is freed, however much the feed grows.
+ */
+
+#ifndef RSS_FEED_H
+#define RSS_FEED_H
+
+#include <stddef.h>
+
+#include "rss.h"
+
+/* The time of an item whose date is missing or unreadable. */
+#define RSS_NO_DATE (-0x7fffffffffffffffLL - 1)
+
+typedef struct RssArenaBlock RssArenaBlock;
+
+typedef struct {
+  Rss *items;              /* count items, in feed order or newest first */
+  int count;
+  int capacity;
+  RssArenaBlock *blocks;   /* the string arena, newest block first */
+  size_t nextBlockSize;
+} RssFeed;
+
+/**
+ * Initializes an empty feed.
+ */
+void initRssFeed(RssFeed *feed);
+
+/**
+ * Appends a copy of the item (strings included; <code>NULL</code>
+ * fields become empty strings).  Returns 1 on success or 0 on
+ * allocation failure (the feed is unchanged).
+ */
+int rssFeedAppend(RssFeed *feed, const Rss *item);
+
+/**
+ * Appends every item of the given feed text (see streamRssItems) in
+ * document order.  Returns the number of items appended, or -1 if the
+ * text is not a well-formed feed or memory ran out.
+ */
+int parseRssFeed(const char *xml, size_t len, RssFeed *feed);
+
+/**
+ * Appends the n newest items of the given feed text, newest first
+ * (items with equal dates keep document order, undated items count as
+ * oldest).  Only n items are kept at any time.  Returns the number of
+ * items appended, or -1 as for parseRssFeed.
+ */
+int parseRssFeedNewest(const char *xml, size_t len, int n, RssFeed *feed);
+
+/**
+ * Returns the time of an RSS (RFC 822, "Mon, 02 Mar 2026 15:00:00
+ * -0600") or Atom (RFC 3339, "2026-03-02T15:00:00-06:00") date in
+ * seconds since 1970-01-01 UTC, or RSS_NO_DATE if it cannot be read.
+ */
+long long parseRssDate(const char *date);
+
+/**
+ * Frees the items and every string of the feed, leaving it empty.
+ */
+void freeRssFeed(RssFeed *feed);
+
+#endif /* RSS_FEED_H */
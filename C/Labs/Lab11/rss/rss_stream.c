@@ -0,0 +1,204 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Streaming RSS/Atom parser
+ *
+ * Description:
+ * Implements the xmlTextReader item stream declared in rss_stream.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <libxml/xmlreader.h>
+
+#include "rss_stream.h"
+#include "byte_buffer.h"
+
+/* The fields of an item and its guid, plus a scratch slot for text being skipped. */
+enum { TITLE, LINK, DATE, DESCRIPTION, GUID, SKIPPED, NUM_FIELDS };
+
+/* Rank of a field's source: a lower rank replaces a higher one. */
+#define RANK_NONE 3
+
+/* Tag names interned in the reader's dictionary, compared by pointer. */
+typedef struct {
+  const xmlChar *item, *entry;
+  const xmlChar *title, *link, *description, *pubDate;
+  const xmlChar *content, *summary, *updated, *published;
+  const xmlChar *guid, *id;
+  const xmlChar *href, *rel, *alternate;
+} Names;
+
+typedef struct {
+  ByteBuffer fields[NUM_FIELDS];
+  int rank[NUM_FIELDS];
+} Item;
+
+static void internNames(xmlTextReaderPtr reader, Names *names) {
+  names->item = xmlTextReaderConstString(reader, BAD_CAST "item");
+  names->entry = xmlTextReaderConstString(reader, BAD_CAST "entry");
+  names->title = xmlTextReaderConstString(reader, BAD_CAST "title");
+  names->link = xmlTextReaderConstString(reader, BAD_CAST "link");
+  names->description = xmlTextReaderConstString(reader, BAD_CAST "description");
+  names->pubDate = xmlTextReaderConstString(reader, BAD_CAST "pubDate");
+  names->content = xmlTextReaderConstString(reader, BAD_CAST "content");
+  names->summary = xmlTextReaderConstString(reader, BAD_CAST "summary");
+  names->updated = xmlTextReaderConstString(reader, BAD_CAST "updated");
+  names->published = xmlTextReaderConstString(reader, BAD_CAST "published");
+  names->guid = xmlTextReaderConstString(reader, BAD_CAST "guid");
+  names->id = xmlTextReaderConstString(reader, BAD_CAST "id");
+  names->href = xmlTextReaderConstString(reader, BAD_CAST "href");
+  names->rel = xmlTextReaderConstString(reader, BAD_CAST "rel");
+  names->alternate = xmlTextReaderConstString(reader, BAD_CAST "alternate");
+}
+
+static void clearBuffer(ByteBuffer *buffer) {
+  buffer->len = 0;
+  buffer->ptr[0] = '\0';
+}
+
+static int appendText(ByteBuffer *buffer, const xmlChar *text) {
+  return !text || byteBufferAppend(buffer, text, strlen((const char *)text));
+}
+
+/*
+ * The field an element of an item fills and its rank, or SKIPPED.  The
+ * names work for RSS and Atom alike since the item's own namespace is
+ * checked by the caller.
+ */
+static int fieldOf(const Names *names, const xmlChar *name, int *rank) {
+  *rank = 0;
+  if (name == names->title) return TITLE;
+  if (name == names->link) return LINK;
+  if (name == names->pubDate || name == names->updated) return DATE;
+  if (name == names->description || name == names->content) return DESCRIPTION;
+  if (name == names->guid || name == names->id) return GUID;
+  *rank = 1;
+  if (name == names->published) return DATE;
+  if (name == names->summary) return DESCRIPTION;
+  return SKIPPED;
+}
+
+static int deliver(Item *item, RssItemHandler handler, void *context) {
+  Rss rss;
+  rss.title = item->fields[TITLE].ptr;
+  rss.link = item->fields[LINK].ptr;
+  rss.date = item->fields[DATE].ptr;
+  rss.description = item->fields[DESCRIPTION].ptr;
+  return handler(&rss, context);
+}
+
+/* The key of an item read so far: its guid, link or title, or NULL. */
+static const char *keyOf(const Item *item) {
+  static const int order[] = { GUID, LINK, TITLE };
+  for (int k = 0; k < 3; k++) {
+    const char *text = item->fields[order[k]].ptr;
+    if (text[0]) return text;
+  }
+  return NULL;
+}
+
+static int streamItems(const char *xml, size_t len, RssKeyFilter seen, RssItemHandler handler,
+                       void *context) {
+  if (!xml || len > (size_t)0x7fffffff) return -1;
+  xmlTextReaderPtr reader = xmlReaderForMemory(xml, (int)len, NULL, NULL, XML_PARSE_NONET);
+  if (!reader) return -1;
+  Names names;
+  internNames(reader, &names);
+
+  Item item;
+  int ok = 1;
+  for (int f = 0; f < NUM_FIELDS; f++) {
+    ok = initByteBuffer(&item.fields[f], 256) && ok;
+  }
+
+  int count = 0, result = 0;
+  int itemDepth = -1, field = -1, fieldDepth = -1, running = ok;
+  const xmlChar *itemNamespace = NULL;
+  while (running && (result = xmlTextReaderRead(reader)) == 1) {
+    int type = xmlTextReaderNodeType(reader);
+    if (type == XML_READER_TYPE_ELEMENT) {
+      const xmlChar *name = xmlTextReaderConstLocalName(reader);
+      int depth = xmlTextReaderDepth(reader);
+      int empty = xmlTextReaderIsEmptyElement(reader);
+      if (itemDepth < 0) {
+        if (name != names.item && name != names.entry) continue;
+        itemDepth = depth;
+        itemNamespace = xmlTextReaderConstNamespaceUri(reader);
+        for (int f = 0; f < NUM_FIELDS; f++) {
+          clearBuffer(&item.fields[f]);
+          item.rank[f] = RANK_NONE;
+        }
+        if (empty) {
+          count++;
+          running = deliver(&item, handler, context);
+          itemDepth = -1;
+        }
+        continue;
+      }
+      if (field >= 0 || depth != itemDepth + 1 ||
+          xmlTextReaderConstNamespaceUri(reader) != itemNamespace) {
+        continue;
+      }
+      int rank;
+      int target = fieldOf(&names, name, &rank);
+      if (target == LINK && xmlTextReaderHasAttributes(reader)) {
+        /* Atom: <link rel="alternate" href="..."/>; other rels are a fallback */
+        xmlChar *rel = xmlTextReaderGetAttribute(reader, names.rel);
+        xmlChar *href = xmlTextReaderGetAttribute(reader, names.href);
+        rank = rel && !xmlStrEqual(rel, names.alternate) ? 1 : 0;
+        if (href && rank < item.rank[LINK]) {
+          clearBuffer(&item.fields[LINK]);
+          ok = appendText(&item.fields[LINK], href);
+          item.rank[LINK] = rank;
+        }
+        xmlFree(rel);
+        xmlFree(href);
+        if (href) target = SKIPPED;
+      }
+      if (target != SKIPPED && rank < item.rank[target]) {
+        clearBuffer(&item.fields[target]);
+        item.rank[target] = rank;
+      } else {
+        target = SKIPPED;
+      }
+      if (!empty) {
+        field = target;
+        fieldDepth = depth;
+      }
+    } else if (type == XML_READER_TYPE_END_ELEMENT) {
+      int depth = xmlTextReaderDepth(reader);
+      if (field >= 0 && depth == fieldDepth) {
+        field = -1;
+      } else if (itemDepth >= 0 && depth == itemDepth) {
+        const char *key = seen ? keyOf(&item) : NULL;
+        if (!key || !seen(key, context)) {
+          count++;
+          running = deliver(&item, handler, context);
+        }
+        itemDepth = -1;
+      }
+    } else if (field >= 0 && field != SKIPPED &&
+               (type == XML_READER_TYPE_TEXT || type == XML_READER_TYPE_CDATA ||
+                type == XML_READER_TYPE_WHITESPACE ||
+                type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE)) {
+      ok = appendText(&item.fields[field], xmlTextReaderConstValue(reader));
+    }
+    if (!ok) running = 0;
+  }
+
+  xmlFreeTextReader(reader);
+  for (int f = 0; f < NUM_FIELDS; f++) freeByteBuffer(&item.fields[f]);
+  return ok && result >= 0 ? count : -1;
+}
+
+int streamRssItems(const char *xml, size_t len, RssItemHandler handler, void *context) {
+  return streamItems(xml, len, NULL, handler, context);
+}
+
+int streamUnseenRssItems(const char *xml, size_t len, RssKeyFilter seen, RssItemHandler handler,
+                         void *context) {
+  return streamItems(xml, len, seen, handler, context);
+}
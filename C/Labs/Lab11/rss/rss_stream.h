@@ -0,0 +1,64 @@
+/*
+ * Name: Anthony Candelas
+ * Email: tsallinger2@unl.edu
+ * Date: 17OCT2026
+ * Lab/Task: Lab11 - Streaming RSS/Atom parser
+ *
+ * Description:
+ * Parses an RSS 2.0 (or 1.0) or Atom feed with libxml2's xmlTextReader,
+ * a pull parser, instead of building a DOM.  Each <item> or <entry> is
+ * handed to a callback as soon as its end tag is read, so memory use
+ * does not grow with the number of items.  Tag names are matched by
+ * comparing pointers into the reader's name dictionary.
+ *
+ * NOTE: fields are read from the direct children of an item that share
+ * its namespace, so extensions such as <media:title> are ignored.  The
+ * first occurrence of a field wins, as in the DOM walk of rss_utils.c.
+ * Atom links are taken from the href of the alternate (or only) <link>,
+ * and Atom entries fall back to <summary> and <published> when
+ * <content> or <updated> is missing.
+ *
+ * An item's key, used to recognize items already seen, is its RSS
+ * <guid> or Atom <id>, else its link, else its title.
+ */
+
+#ifndef RSS_STREAM_H
+#define RSS_STREAM_H
+
+#include <stddef.h>
+
+#include "rss.h"
+
+/**
+ * Called once per item.  The item and its strings are only valid during
+ * the call (copy them to keep them).  Returns nonzero to go on or 0 to
+ * stop parsing.
+ */
+typedef int (*RssItemHandler)(const Rss *item, void *context);
+
+/**
+ * Streams the items of the feed in the given text (which need not be
+ * NUL-terminated) to <code>handler</code>.  Returns the number of items
+ * delivered, or -1 if the text is not a well-formed feed (items before
+ * the error have already been delivered).
+ */
+int streamRssItems(const char *xml, size_t len, RssItemHandler handler, void *context);
+
+/**
+ * Called once per item with its key (never empty).  Returns nonzero if
+ * the item was seen before, so it is not delivered.
+ */
+typedef int (*RssKeyFilter)(const char *key, void *context);
+
+/**
+ * Like streamRssItems, but asks <code>seen</code> about each item's key
+ * at its end tag and delivers only the items it has not seen.  A seen
+ * item is still parsed (a pull parser cannot skip markup unread); it is
+ * just not delivered.  Items with no key at all are always delivered.
+ * Returns the number of items delivered, or -1 if the text is not a
+ * well-formed feed.
+ */
+int streamUnseenRssItems(const char *xml, size_t len, RssKeyFilter seen, RssItemHandler handler,
+                         void *context);
+
+#endif /* RSS_STREAM_H */
@@ -10,103 +10,133 @@
 #include <libxml/tree.h>
 
 #include "rss.h"
+#include "feed_cache.h"
+#include "feed_index.h"
 #include "rss_utils.h"
+#include "rss_stream.h"
+#include "rss_feed.h"
 
-void parseRssXml(xmlNode *rootNode) {
-  // we limit the number of items to a maximum of 100
-  int n = 100;
-  int i = 0, numItems = 0;
-  Rss items[100];
+/*
+ * Appends each <itemName> child of parent to the feed, reading its
+ * fields with xmlNodeGetContent.  As in the stream parser, the first
+ * occurrence of a field wins.
+ */
+static void collectItems(xmlNode *parent, const char *itemName, const char *dateName,
+                         const char *descriptionName, RssFeed *feed) {
   xmlNode *cur_node = NULL;
   xmlNode *inner_node = NULL;
-  xmlNode *channel = NULL;
-  if(rootNode->children->next != NULL) {
-    channel = rootNode->children->next;
-  } else {
-    channel = rootNode->last;
-  }
 
-  for (cur_node = channel->children; cur_node; cur_node = cur_node->next) {
+  for (cur_node = parent->children; cur_node; cur_node = cur_node->next) {
     if (cur_node->type == XML_ELEMENT_NODE &&
-        strcmp(cur_node->name, "item") == 0) {
-      Rss *anRss = NULL;
-
-      char *title = NULL;
-      char *link = NULL;
-      char *date = NULL;
-      char *description = NULL;
+        strcmp(cur_node->name, itemName) == 0) {
+      xmlChar *title = NULL;
+      xmlChar *link = NULL;
+      xmlChar *date = NULL;
+      xmlChar *description = NULL;
 
       for (inner_node = cur_node->children; inner_node;
            inner_node = inner_node->next) {
         if (inner_node->type == XML_ELEMENT_NODE) {
+          xmlChar **field = NULL;
           if (strcmp(inner_node->name, "title") == 0) {
-            title = xmlNodeGetContent(inner_node);
+            field = &title;
           } else if (strcmp(inner_node->name, "link") == 0) {
-            link = xmlNodeGetContent(inner_node);
-          } else if (strcmp(inner_node->name, "description") == 0) {
-            description = xmlNodeGetContent(inner_node);
-          } else if (strcmp(inner_node->name, "pubDate") == 0) {
-            date = xmlNodeGetContent(inner_node);
+            field = &link;
+          } else if (strcmp(inner_node->name, descriptionName) == 0) {
+            field = &description;
+          } else if (strcmp(inner_node->name, dateName) == 0) {
+            field = &date;
+          }
+          if (field && !*field) {
+            *field = xmlNodeGetContent(inner_node);
           }
         }
       }
-      anRss = createRss(title, link, date, description);
 
-      if (numItems < n) {
-        items[numItems] = *anRss;
-        i++;
-        numItems++;
-      }
+      Rss item = { (char *) title, (char *) link, (char *) date, (char *) description };
+      rssFeedAppend(feed, &item);
+      xmlFree(title);
+      xmlFree(link);
+      xmlFree(date);
+      xmlFree(description);
     }
   }
-  for (i = 0; i < numItems; i++) {
-    printRss(&items[i]);
+}
+
+static void printFeed(RssFeed *feed) {
+  for (int i = 0; i < feed->count; i++) {
+    printRss(&feed->items[i]);
+  }
+  freeRssFeed(feed);
+}
+
+void parseRssXml(xmlNode *rootNode) {
+  RssFeed feed;
+  xmlNode *channel = NULL;
+  if(rootNode->children->next != NULL) {
+    channel = rootNode->children->next;
+  } else {
+    channel = rootNode->last;
   }
+
+  initRssFeed(&feed);
+  collectItems(channel, "item", "pubDate", "description", &feed);
+  printFeed(&feed);
 }
 
 void parseAtomXml(xmlNode *rootNode) {
-  // we limit the number of items to a maximum of 100
-  int n = 100;
-  int i = 0, numItems = 0;
-  Rss items[100];
-  xmlNode *cur_node = NULL;
-  xmlNode *inner_node = NULL;
+  RssFeed feed;
 
   // there is no <channel> element, so we go directly to the children,
   // matching <entry> tags
-  for (cur_node = rootNode->children; cur_node; cur_node = cur_node->next) {
-    if (cur_node->type == XML_ELEMENT_NODE &&
-        strcmp(cur_node->name, "entry") == 0) {
+  initRssFeed(&feed);
+  collectItems(rootNode, "entry", "updated", "content", &feed);
+  printFeed(&feed);
+}
 
-      char *title = NULL;
-      char *link = NULL;
-      char *date = NULL;
-      char *description = NULL;
+static int printItem(const Rss *item, void *context) {
+  printRss(item);
+  return 1;
+}
 
-      for (inner_node = cur_node->children; inner_node;
-           inner_node = inner_node->next) {
-        if (inner_node->type == XML_ELEMENT_NODE) {
-          if (strcmp(inner_node->name, "title") == 0) {
-            title = xmlNodeGetContent(inner_node);
-          } else if (strcmp(inner_node->name, "link") == 0) {
-            link = xmlNodeGetContent(inner_node);
-          } else if (strcmp(inner_node->name, "content") == 0) {
-            description = xmlNodeGetContent(inner_node);
-          } else if (strcmp(inner_node->name, "updated") == 0) {
-            date = xmlNodeGetContent(inner_node);
-          }
-        }
-      }
+int parseFeedXml(const char *xml, size_t len, Version type) {
+  if (type != RSS2 && type != ATOM1) {
+    fprintf(stderr, "Undefined Service Type: %d\n", type);
+    return 0;
+  }
+  /* the stream parser reads both formats without building a DOM */
+  return streamRssItems(xml, len, printItem, NULL) >= 0;
+}
 
-      if (numItems < n) {
-        items[numItems] = *createRss(title, link, date, description);
-        i++;
-        numItems++;
-      }
-    }
+int parseFeedXmlNewest(const char *xml, size_t len, Version type, int n) {
+  if (type != RSS2 && type != ATOM1) {
+    fprintf(stderr, "Undefined Service Type: %d\n", type);
+    return 0;
+  }
+  RssFeed feed;
+  initRssFeed(&feed);
+  if (parseRssFeedNewest(xml, len, n, &feed) < 0) {
+    freeRssFeed(&feed);
+    return 0;
   }
+  printFeed(&feed);
+  return 1;
+}
+
+/* Adds an item to the index given as context, then prints it, so every
+ * printed item is searchable. */
+static int printAndIndexItem(const Rss *item, void *context) {
+  if (feedIndexAdd(context, item) < 0) return 0;
+  printRss(item);
+  return 1;
+}
 
-  for (i = 0; i < numItems; i++) {
-    printRss(&items[i]);
+int parseFeedXmlUnseen(const char *xml, size_t len, Version type, FeedCacheEntry *entry,
+                       FeedIndex *index) {
+  if (type != RSS2 && type != ATOM1) {
+    fprintf(stderr, "Undefined Service Type: %d\n", type);
+    return -1;
   }
+  if (index) return parseUnseenItems(entry, xml, len, printAndIndexItem, index);
+  return parseUnseenItems(entry, xml, len, printItem, NULL);
 }
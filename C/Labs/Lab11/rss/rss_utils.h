@@ -63,3 +63,28 @@ void parseRssXml(xmlNode *rootNode);
  * A utility function to parse an XML feed from an Atom feed
  */
 void parseAtomXml(xmlNode *rootNode);
+
+/**
+ * Parses a downloaded feed of the given type and prints its items as
+ * they are read (see streamRssItems).  Returns 0 if the text is not a
+ * well-formed feed.
+ */
+int parseFeedXml(const char *xml, size_t len, Version type);
+
+/**
+ * Parses a downloaded feed of the given type and prints only its n
+ * newest items, newest first (see parseRssFeedNewest).  Returns 0 if
+ * the text is not a well-formed feed.
+ */
+int parseFeedXmlNewest(const char *xml, size_t len, Version type, int n);
+
+/**
+ * Parses a downloaded feed of the given type and prints only the items
+ * that the feed's previous document (per its cache entry) did not have
+ * (see parseUnseenItems), adding each to the index unless it is NULL.
+ * Returns the number printed, or -1 if the text is not a well-formed
+ * feed or an item could not be indexed (the items after it are then
+ * new again next time).
+ */
+int parseFeedXmlUnseen(const char *xml, size_t len, Version type, FeedCacheEntry *entry,
+                       FeedIndex *index);
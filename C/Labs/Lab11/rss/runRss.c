@@ -6,16 +6,197 @@
 #include <libxml/tree.h>
 
 #include "curl_utils.h"
+#include "feed_fetcher.h"
+#include "feed_cache.h"
+#include "feed_index.h"
 #include "rss_utils.h"
 #include "rss.h"
 
+/**
+ * Prints the items of a downloaded feed, or only its newest items when
+ * newest is positive.
+ */
+static int printFeedItems(const char *xml, size_t len, Version type, int newest) {
+  if (newest > 0) return parseFeedXmlNewest(xml, len, type, newest);
+  return parseFeedXml(xml, len, type);
+}
+
+/**
+ * Fetches every service at once and parses each feed as soon as its
+ * download finishes.
+ */
+static int runAll(const RssService *services, int n, int newest) {
+  const char *urls[n];
+  for (int i = 0; i < n; i++) urls[i] = services[i].url;
+
+  FeedFetcher fetcher;
+  FeedQueue queue;
+  if (!initFeedFetcher(&fetcher, n)) return 1;
+  if (!initFeedQueue(&queue)) {
+    freeFeedFetcher(&fetcher);
+    return 1;
+  }
+  FeedFetchJob job = { &fetcher, urls, n, &queue };
+  if (!startFeedFetchJob(&job)) {
+    freeFeedQueue(&queue);
+    freeFeedFetcher(&fetcher);
+    return 1;
+  }
+
+  FeedResult *result;
+  while ((result = feedQueuePop(&queue)) != NULL) {
+    const RssService *s = &services[result->index];
+    printf("Using RSS Service: %s (%s)\n", s->name, s->url);
+    if (result->error != CURLE_OK) {
+      fprintf(stderr, "cURL encountered an error: %s\n", curl_easy_strerror(result->error));
+    } else if (!printFeedItems(result->body, result->len, s->type, newest)) {
+      fprintf(stderr, "Could not parse the feed (HTTP %ld)\n", result->status);
+    }
+    freeFeedResult(result);
+  }
+
+  joinFeedFetchJob(&job);
+  freeFeedQueue(&queue);
+  freeFeedFetcher(&fetcher);
+  return 0;
+}
+
+/**
+ * Polls every service at once, asking each server only for a feed that
+ * changed since the last poll (ETag / Last-Modified), and prints just
+ * the items the last poll did not see.  What was seen is kept in the
+ * cache file between runs.
+ */
+static int runPoll(const RssService *services, int n, const char *cachePath,
+                   const char *indexPath) {
+  FeedCache cache;
+  FeedIndex index;
+  initFeedCache(&cache);
+  initFeedIndex(&index);
+  if (!loadFeedCache(&cache, cachePath)) {
+    fprintf(stderr, "Ignoring unreadable cache %s\n", cachePath);
+  }
+  if (!loadFeedIndex(&index, indexPath)) {
+    fprintf(stderr, "Ignoring unreadable index %s\n", indexPath);
+  }
+
+  /* copies, as the parser below replaces the entries' validators */
+  const char *urls[n];
+  FeedValidators validators[n];
+  for (int i = 0; i < n; i++) {
+    FeedCacheEntry *entry = feedCacheFind(&cache, services[i].url);
+    urls[i] = services[i].url;
+    validators[i].etag = entry ? strdup(entry->etag) : NULL;
+    validators[i].lastModified = entry ? strdup(entry->lastModified) : NULL;
+  }
+
+  FeedFetcher fetcher;
+  FeedQueue queue;
+  int status = 1;
+  if (initFeedFetcher(&fetcher, n)) {
+    if (initFeedQueue(&queue)) {
+      FeedFetchJob job = { &fetcher, urls, n, &queue, validators };
+      if (startFeedFetchJob(&job)) {
+        FeedResult *result;
+        while ((result = feedQueuePop(&queue)) != NULL) {
+          const RssService *s = &services[result->index];
+          FeedCacheEntry *entry = feedCacheEntry(&cache, s->url);
+          int fresh = -1;
+          printf("Using RSS Service: %s (%s)\n", s->name, s->url);
+          if (result->error != CURLE_OK) {
+            fprintf(stderr, "cURL encountered an error: %s\n", curl_easy_strerror(result->error));
+          } else if (result->status == 304) {
+            printf("  not modified since the last poll\n");
+          } else if (!entry ||
+                     (fresh = parseFeedXmlUnseen(result->body, result->len, s->type, entry,
+                                                 &index)) < 0) {
+            fprintf(stderr, "Could not parse the feed (HTTP %ld)\n", result->status);
+          } else {
+            /* only a feed that parsed and was fully indexed may be skipped next time */
+            feedCacheSetValidators(entry, result->etag, result->lastModified);
+            printf("  %d new item%s\n", fresh, fresh == 1 ? "" : "s");
+          }
+          freeFeedResult(result);
+        }
+        joinFeedFetchJob(&job);
+        status = saveFeedCache(&cache, cachePath) ? 0 : 1;
+        if (status) fprintf(stderr, "Could not save cache %s\n", cachePath);
+        if (!saveFeedIndex(&index, indexPath)) {
+          fprintf(stderr, "Could not save index %s\n", indexPath);
+          status = 1;
+        }
+      }
+      freeFeedQueue(&queue);
+    }
+    freeFeedFetcher(&fetcher);
+  }
+
+  for (int i = 0; i < n; i++) {
+    free((char *)validators[i].etag);
+    free((char *)validators[i].lastModified);
+  }
+  freeFeedCache(&cache);
+  freeFeedIndex(&index);
+  return status;
+}
+
+/*
+ * Prints the ten newest items in the index snapshot that match all (or
+ * any) of the query's words.
+ */
+static int runSearch(const char *query, FeedQueryMode mode, const char *indexPath) {
+  FeedIndex index;
+  initFeedIndex(&index);
+  if (!loadFeedIndex(&index, indexPath)) {
+    fprintf(stderr, "Could not read index %s\n", indexPath);
+    return 1;
+  }
+  int docs[10];
+  int matches = 0;
+  int found = searchFeedIndex(&index, query, mode, 10, docs, &matches);
+  if (found < 0) {
+    fprintf(stderr, "Out of memory\n");
+  } else {
+    printf("%d item%s of %d match \"%s\"\n", matches, matches == 1 ? "" : "s",
+           index.items.count, query);
+    for (int i = 0; i < found; i++) printRss(feedIndexItem(&index, docs[i]));
+  }
+  freeFeedIndex(&index);
+  return found < 0 ? 1 : 0;
+}
+
 /**
  * Main driver program for the RSS feed demo.  You can provide
- * command line arguments 1 - 3 to connect to different feeds.
+ * command line arguments 1 - 4 to connect to different feeds, or
+ * "all" to fetch every feed concurrently.  An optional second argument
+ * prints only that many of the newest items of each feed.  "poll
+ * [cacheFile [indexFile]]" fetches every feed, prints only items that
+ * are new since the last poll and adds them to a search index; "search
+ * <query> [all|any [indexFile]]" prints the newest items of that index
+ * with all (or any) of the query's words.
  */
 int main(int argc, char **argv) {
   // default: School of Computing News
   RssService s = cseBitsAndBytes;
+  int newest = argc > 2 ? atoi(argv[2]) : 0;
+
+  const RssService services[] = { cseBitsAndBytes, unlNews, reddit, pintrest };
+  int numServices = sizeof(services) / sizeof(services[0]);
+  if (argc > 1 && strcmp(argv[1], "all") == 0) {
+    int status = runAll(services, numServices, newest);
+    xmlCleanupParser();
+    return status;
+  }
+  if (argc > 1 && strcmp(argv[1], "poll") == 0) {
+    int status = runPoll(services, numServices, argc > 2 ? argv[2] : "rss_cache.bin",
+                         argc > 3 ? argv[3] : "rss_index.bin");
+    xmlCleanupParser();
+    return status;
+  }
+  if (argc > 2 && strcmp(argv[1], "search") == 0) {
+    FeedQueryMode mode = argc > 3 && strcmp(argv[3], "any") == 0 ? FEED_QUERY_ANY : FEED_QUERY_ALL;
+    return runSearch(argv[2], mode, argc > 4 ? argv[4] : "rss_index.bin");
+  }
 
   if (argc > 1) {
     int choice = atoi(argv[1]);
@@ -31,17 +212,10 @@ int main(int argc, char **argv) {
   printf("Using RSS Service: %s (%s)\n", s.name, s.url);
 
   char *rawXml = getContent(s.url);
-
-  xmlDocPtr doc = xmlReadMemory(rawXml, strlen(rawXml), "noname.xml", NULL, 0);
-  xmlNode *rootElement = xmlDocGetRootElement(doc);
-
-  if (s.type == RSS2) {
-    parseRssXml(rootElement);
-  } else if (s.type == ATOM1) {
-    parseAtomXml(rootElement);
-  } else {
-    fprintf(stderr, "Undefined Service Type: %d\n", s.type);
+  if (rawXml == NULL || !printFeedItems(rawXml, strlen(rawXml), s.type, newest)) {
+    fprintf(stderr, "Could not parse the feed\n");
   }
+  free(rawXml);
 
   xmlCleanupParser();
   return 0;